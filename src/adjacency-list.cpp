@@ -31,14 +31,61 @@ INIT_LOGGER(AdjacencyList);
 bool
 AdjacencyList::insert(const Adjacent& adjacent)
 {
-  auto it = find(adjacent.getName());
-  if (it != m_adjList.end()) {
+  if (m_byName.count(adjacent.getName()) > 0) {
     return false;
   }
   m_adjList.push_back(adjacent);
+  addToIndexes(m_adjList.size() - 1);
+  return true;
+}
+
+bool
+AdjacencyList::erase(const ndn::Name& adjName)
+{
+  auto it = m_byName.find(adjName);
+  if (it == m_byName.end()) {
+    return false;
+  }
+
+  size_t index = it->second;
+  size_t last = m_adjList.size() - 1;
+  removeFromIndexes(index);
+  if (index != last) {
+    removeFromIndexes(last);
+    m_adjList[index] = std::move(m_adjList[last]);
+    addToIndexes(index);
+  }
+  m_adjList.pop_back();
   return true;
 }
 
+void
+AdjacencyList::addToIndexes(size_t index)
+{
+  const Adjacent& adjacent = m_adjList[index];
+  m_byName.emplace(adjacent.getName(), index);
+  if (adjacent.getFaceId() != 0) {
+    m_byFaceId.emplace(adjacent.getFaceId(), index);
+  }
+  m_byFaceUri.emplace(adjacent.getFaceUri().toString(), index);
+}
+
+void
+AdjacencyList::removeFromIndexes(size_t index)
+{
+  const Adjacent& adjacent = m_adjList[index];
+  m_byName.erase(adjacent.getName());
+
+  auto byFaceId = m_byFaceId.find(adjacent.getFaceId());
+  if (byFaceId != m_byFaceId.end() && byFaceId->second == index) {
+    m_byFaceId.erase(byFaceId);
+  }
+  auto byFaceUri = m_byFaceUri.find(adjacent.getFaceUri().toString());
+  if (byFaceUri != m_byFaceUri.end() && byFaceUri->second == index) {
+    m_byFaceUri.erase(byFaceUri);
+  }
+}
+
 Adjacent
 AdjacencyList::getAdjacent(const ndn::Name& adjName) const
 {
@@ -118,13 +165,13 @@ AdjacencyList::setStatusOfNeighbor(const ndn::Name& neighbor, Adjacent::Status s
   }
 }
 
-std::list<Adjacent>&
+std::vector<Adjacent>&
 AdjacencyList::getAdjList()
 {
   return m_adjList;
 }
 
-const std::list<Adjacent>&
+const std::vector<Adjacent>&
 AdjacencyList::getAdjList() const
 {
   return m_adjList;
@@ -147,6 +194,15 @@ AdjacencyList::isAdjLsaBuildable(const uint32_t interestRetryNo) const
   return nTimedOutNeighbors == m_adjList.size();
 }
 
+bool
+AdjacencyList::isEveryNeighborProbed(uint32_t interestRetryNo) const
+{
+  return std::all_of(m_adjList.begin(), m_adjList.end(), [=] (const Adjacent& adjacent) {
+    return adjacent.getStatus() == Adjacent::STATUS_ACTIVE ||
+           adjacent.getInterestTimedOutNo() >= interestRetryNo;
+  });
+}
+
 int32_t
 AdjacencyList::getNumOfActiveNeighbor() const
 {
@@ -159,49 +215,75 @@ AdjacencyList::getNumOfActiveNeighbor() const
   return actNbrCount;
 }
 
-std::list<Adjacent>::iterator
+AdjacencyList::iterator
 AdjacencyList::find(const ndn::Name& adjName)
 {
-  return std::find_if(m_adjList.begin(), m_adjList.end(),
-                      std::bind(&Adjacent::compare, _1, std::cref(adjName)));
+  auto it = m_byName.find(adjName);
+  return it != m_byName.end() ? m_adjList.begin() + it->second : m_adjList.end();
 }
 
-std::list<Adjacent>::const_iterator
+AdjacencyList::const_iterator
 AdjacencyList::find(const ndn::Name& adjName) const
 {
-  return std::find_if(m_adjList.cbegin(), m_adjList.cend(),
-                      std::bind(&Adjacent::compare, _1, std::cref(adjName)));
+  auto it = m_byName.find(adjName);
+  return it != m_byName.end() ? m_adjList.cbegin() + it->second : m_adjList.cend();
 }
 
 AdjacencyList::iterator
 AdjacencyList::findAdjacent(const ndn::Name& adjName)
 {
-  return std::find_if(m_adjList.begin(), m_adjList.end(),
-                      std::bind(&Adjacent::compare, _1, std::cref(adjName)));
+  return find(adjName);
 }
 
 AdjacencyList::iterator
 AdjacencyList::findAdjacent(uint64_t faceId)
 {
-  return std::find_if(m_adjList.begin(), m_adjList.end(),
-                      std::bind(&Adjacent::compareFaceId, _1, faceId));
+  if (faceId == 0) {
+    // adjacencies without a face are not indexed
+    return std::find_if(m_adjList.begin(), m_adjList.end(),
+                        std::bind(&Adjacent::compareFaceId, _1, faceId));
+  }
+  auto it = m_byFaceId.find(faceId);
+  if (it == m_byFaceId.end() || !m_adjList[it->second].compareFaceId(faceId)) {
+    return m_adjList.end();
+  }
+  return m_adjList.begin() + it->second;
 }
 
 AdjacencyList::iterator
 AdjacencyList::findAdjacent(const ndn::FaceUri& faceUri)
 {
-  return std::find_if(m_adjList.begin(), m_adjList.end(),
-                      std::bind(&Adjacent::compareFaceUri, _1, faceUri));
+  return findAdjacentByFaceUri(faceUri.toString());
+}
+
+AdjacencyList::iterator
+AdjacencyList::findAdjacentByFaceUri(const std::string& faceUri)
+{
+  auto it = m_byFaceUri.find(faceUri);
+  return it != m_byFaceUri.end() ? m_adjList.begin() + it->second : m_adjList.end();
 }
 
 uint64_t
 AdjacencyList::getFaceId(const ndn::FaceUri& faceUri)
 {
-  auto it = std::find_if(m_adjList.begin(), m_adjList.end(),
-                         std::bind(&Adjacent::compareFaceUri, _1, faceUri));
+  auto it = findAdjacent(faceUri);
   return it != m_adjList.end() ? it->getFaceId() : 0;
 }
 
+void
+AdjacencyList::setFaceId(iterator it, uint64_t faceId)
+{
+  size_t index = static_cast<size_t>(it - m_adjList.begin());
+  auto old = m_byFaceId.find(it->getFaceId());
+  if (old != m_byFaceId.end() && old->second == index) {
+    m_byFaceId.erase(old);
+  }
+  it->setFaceId(faceId);
+  if (faceId != 0) {
+    m_byFaceId[faceId] = index;
+  }
+}
+
 void
 AdjacencyList::writeLog()
 {
@@ -25,23 +25,44 @@
 #include "adjacent.hpp"
 #include "common.hpp"
 
-#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace nlsr {
 
+/*! \brief The neighbors of a router.
+ *
+ * Adjacencies are stored contiguously and indexed by name, Face ID and FaceUri,
+ * so that the lookups done per hello, per face event and per FIB registration
+ * do not scan the list.
+ *
+ * \note The Face ID of an adjacency must be changed through setFaceId(),
+ *       otherwise it cannot be found by its new Face ID.
+ */
 class AdjacencyList
 {
 public:
-  using const_iterator = std::list<Adjacent>::const_iterator;
-  using iterator = std::list<Adjacent>::iterator;
+  using const_iterator = std::vector<Adjacent>::const_iterator;
+  using iterator = std::vector<Adjacent>::iterator;
 
   bool
   insert(const Adjacent& adjacent);
 
-  std::list<Adjacent>&
+  /*! \brief Removes the adjacency named \p adjName.
+   *
+   * The last adjacency takes the place of the removed one, so iterators to
+   * either of them are invalidated.
+   *
+   * \retval false there is no such adjacency
+   */
+  bool
+  erase(const ndn::Name& adjName);
+
+  std::vector<Adjacent>&
   getAdjList();
 
-  const std::list<Adjacent>&
+  const std::vector<Adjacent>&
   getAdjList() const;
 
   bool
@@ -80,6 +101,12 @@ public:
   bool
   isAdjLsaBuildable(const uint32_t interestRetryNo) const;
 
+  /*! \brief Determines whether every neighbor has either answered a hello
+   *         or failed \p interestRetryNo hello interests in a row.
+   */
+  bool
+  isEveryNeighborProbed(uint32_t interestRetryNo) const;
+
   int32_t
   getNumOfActiveNeighbor() const;
 
@@ -99,6 +126,9 @@ public:
   reset()
   {
     m_adjList.clear();
+    m_byName.clear();
+    m_byFaceId.clear();
+    m_byFaceUri.clear();
   }
 
   AdjacencyList::iterator
@@ -110,9 +140,20 @@ public:
   AdjacencyList::iterator
   findAdjacent(const ndn::FaceUri& faceUri);
 
+  /*! \brief Find an adjacency by the string form of its FaceUri,
+   *         e.g. the remote URI of a face dataset entry.
+   */
+  AdjacencyList::iterator
+  findAdjacentByFaceUri(const std::string& faceUri);
+
   uint64_t
   getFaceId(const ndn::FaceUri& faceUri);
 
+  /*! \brief Set the Face ID of adjacency \p it and update the Face ID index.
+   */
+  void
+  setFaceId(iterator it, uint64_t faceId);
+
   void
   writeLog();
 
@@ -133,11 +174,21 @@ private:
   iterator
   find(const ndn::Name& adjName);
 
+  void
+  addToIndexes(size_t index);
+
+  void
+  removeFromIndexes(size_t index);
+
   const_iterator
   find(const ndn::Name& adjName) const;
 
 private:
-  std::list<Adjacent> m_adjList;
+  std::vector<Adjacent> m_adjList;
+  // Indexes into m_adjList
+  std::unordered_map<ndn::Name, size_t> m_byName;
+  std::unordered_map<uint64_t, size_t> m_byFaceId;
+  std::unordered_map<std::string, size_t> m_byFaceUri;
 };
 
 } // namespace nlsr
@@ -76,6 +76,24 @@ Adjacent::setLinkCost(double lc)
   m_linkCost = lc;
 }
 
+double
+Adjacent::getTopologyCost(const std::string& topology) const
+{
+  auto it = m_topologyCosts.find(topology);
+  return it == m_topologyCosts.end() ? getLinkCost() : it->second;
+}
+
+void
+Adjacent::setTopologyCost(const std::string& topology, double cost)
+{
+  if (cost < 0) {
+    NDN_THROW(ndn::tlv::Error("Neighbor's topology cost cannot be negative"));
+  }
+
+  m_wire.reset();
+  m_topologyCosts[topology] = cost;
+}
+
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(Adjacent);
 
 template<ndn::encoding::Tag TAG>
@@ -84,6 +102,14 @@ Adjacent::wireEncode(ndn::EncodingImpl<TAG>& encoder) const
 {
   size_t totalLength = 0;
 
+  for (auto it = m_topologyCosts.rbegin(); it != m_topologyCosts.rend(); ++it) {
+    size_t costLength = prependDoubleBlock(encoder, nlsr::tlv::Cost, it->second);
+    costLength += prependStringBlock(encoder, nlsr::tlv::TopologyName, it->first);
+    costLength += encoder.prependVarNumber(costLength);
+    costLength += encoder.prependVarNumber(nlsr::tlv::TopologyCost);
+    totalLength += costLength;
+  }
+
   totalLength += prependDoubleBlock(encoder, nlsr::tlv::Cost, m_linkCost);
 
   totalLength += prependStringBlock(encoder, nlsr::tlv::Uri, m_faceUri.toString());
@@ -120,6 +146,7 @@ Adjacent::wireDecode(const ndn::Block& wire)
   m_name.clear();
   m_faceUri = ndn::FaceUri();
   m_linkCost = 0;
+  m_topologyCosts.clear();
 
   m_wire = wire;
 
@@ -154,6 +181,16 @@ Adjacent::wireDecode(const ndn::Block& wire)
   else {
     NDN_THROW(Error("Missing required Cost field"));
   }
+
+  for (; val != m_wire.elements_end() && val->type() == nlsr::tlv::TopologyCost; ++val) {
+    val->parse();
+    if (val->elements_size() != 2 ||
+        val->elements()[0].type() != nlsr::tlv::TopologyName ||
+        val->elements()[1].type() != nlsr::tlv::Cost) {
+      NDN_THROW(Error("Malformed TopologyCost field"));
+    }
+    m_topologyCosts[readString(val->elements()[0])] = ndn::encoding::readDouble(val->elements()[1]);
+  }
 }
 
 bool
@@ -161,7 +198,8 @@ Adjacent::operator==(const Adjacent& adjacent) const
 {
   return m_name == adjacent.getName() &&
          m_faceUri == adjacent.getFaceUri() &&
-         util::diffInEpsilon(m_linkCost, adjacent.getLinkCost());
+         util::diffInEpsilon(m_linkCost, adjacent.getLinkCost()) &&
+         m_topologyCosts == adjacent.getTopologyCosts();
 }
 
 bool
@@ -177,8 +215,14 @@ operator<<(std::ostream& os, const Adjacent& adjacent)
 {
   os << "Adjacent: " << adjacent.m_name
      << "\n\t\tConnecting FaceUri: " << adjacent.m_faceUri
-     << "\n\t\tLink cost: " << adjacent.m_linkCost
-     << "\n\t\tStatus: " << adjacent.m_status
+     << "\n\t\tLink cost: " << adjacent.m_linkCost;
+  for (const auto& [topology, cost] : adjacent.m_topologyCosts) {
+    os << "\n\t\tLink cost in topology " << topology << ": " << cost;
+  }
+  if (adjacent.isHelloMulticast()) {
+    os << "\n\t\tHello FaceUri: " << adjacent.m_helloFaceUri;
+  }
+  os << "\n\t\tStatus: " << adjacent.m_status
      << "\n\t\tInterest Timed Out: " << adjacent.m_interestTimedOutNo << std::endl;
   return os;
 }
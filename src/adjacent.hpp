@@ -22,7 +22,10 @@
 #ifndef NLSR_ADJACENT_HPP
 #define NLSR_ADJACENT_HPP
 
+#include "statistics.hpp"
+
 #include <cmath>
+#include <map>
 #include <string>
 
 #include <ndn-cxx/face.hpp>
@@ -40,8 +43,14 @@ namespace nlsr {
  *               Name
  *               FaceUri
  *               LinkCost
- *               AdjacencyStatus
- *               AdjacencyInterestTimedOutNo
+ *               TopologyCost*
+ *
+ *  TopologyCost := TOPOLOGY-COST-TYPE TLV-LENGTH
+ *                    TopologyName
+ *                    Cost
+ *
+ * The status, the number of timed out Hello Interests, the Hello face and the traffic
+ * exchanged with the neighbor are not encoded.
  */
 class Adjacent
 {
@@ -94,6 +103,29 @@ public:
     m_faceUri = faceUri;
   }
 
+  /*! \brief Returns the multicast face on which Hellos are exchanged with this neighbor.
+   *
+   * Neighbors sharing a multicast face are probed with one Hello per interval on that
+   * face instead of a unicast Hello each. The URI is empty for unicast Hellos.
+   */
+  const ndn::FaceUri&
+  getHelloFaceUri() const
+  {
+    return m_helloFaceUri;
+  }
+
+  void
+  setHelloFaceUri(const ndn::FaceUri& faceUri)
+  {
+    m_helloFaceUri = faceUri;
+  }
+
+  bool
+  isHelloMulticast() const
+  {
+    return !m_helloFaceUri.getScheme().empty();
+  }
+
   double
   getLinkCost() const
   {
@@ -103,6 +135,29 @@ public:
   void
   setLinkCost(double lc);
 
+  /*! \brief Returns the cost of this link in \p topology, which defaults to the link cost.
+   */
+  double
+  getTopologyCost(const std::string& topology) const;
+
+  /*! \brief Returns the costs of this link in the topologies where it differs from the link cost.
+   */
+  const std::map<std::string, double>&
+  getTopologyCosts() const
+  {
+    return m_topologyCosts;
+  }
+
+  void
+  setTopologyCost(const std::string& topology, double cost);
+
+  void
+  setTopologyCosts(const std::map<std::string, double>& costs)
+  {
+    m_wire.reset();
+    m_topologyCosts = costs;
+  }
+
   Status
   getStatus() const
   {
@@ -141,7 +196,21 @@ public:
     return m_faceId;
   }
 
-  /*! \brief Equality is when name, Face URI, and link cost are all equal. */
+  /*! \brief Returns the packets and bytes exchanged with this neighbor.
+   */
+  NeighborTraffic&
+  getTraffic()
+  {
+    return m_traffic;
+  }
+
+  const NeighborTraffic&
+  getTraffic() const
+  {
+    return m_traffic;
+  }
+
+  /*! \brief Equality is when name, Face URI, link cost, and topology costs are all equal. */
   bool
   operator==(const Adjacent& adjacent) const;
 
@@ -193,6 +262,8 @@ private:
   ndn::FaceUri m_faceUri;
   /*! m_linkCost The semi-arbitrary cost to traverse the link. */
   double m_linkCost;
+  /*! m_topologyCosts The cost to traverse the link in other routing topologies */
+  std::map<std::string, double> m_topologyCosts;
   /*! m_status Whether the neighbor is active or not */
   Status m_status = STATUS_UNKNOWN;
   /*! m_interestTimedOutNo How many failed Hello interests we have sent since the last reply */
@@ -200,6 +271,10 @@ private:
   /*! m_faceId The NFD-assigned ID for the neighbor, used to
    * determine whether a Face is available */
   uint64_t m_faceId;
+  /*! m_helloFaceUri The multicast Face shared with the neighbor for Hellos, if any */
+  ndn::FaceUri m_helloFaceUri;
+  /*! m_traffic The packets exchanged with the neighbor, not encoded */
+  NeighborTraffic m_traffic;
 
   mutable ndn::Block m_wire;
 
@@ -0,0 +1,261 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "admission-controller.hpp"
+#include "conf-parameter.hpp"
+#include "logger.hpp"
+#include "metrics/metrics-registry.hpp"
+
+#include <ndn-cxx/lp/tags.hpp>
+
+#include <sstream>
+
+namespace nlsr {
+
+INIT_LOGGER(AdmissionController);
+
+namespace {
+
+constexpr size_t RESULT_COUNT = static_cast<size_t>(AdmissionController::Result::EXPIRED) + 1;
+
+std::ostream&
+operator<<(std::ostream& os, AdmissionController::Result result)
+{
+  switch (result) {
+  case AdmissionController::Result::ADMITTED:
+    return os << "admitted";
+  case AdmissionController::Result::RATE_LIMITED:
+    return os << "rate-limited";
+  case AdmissionController::Result::SHED:
+    return os << "shed";
+  case AdmissionController::Result::QUEUE_FULL:
+    return os << "queue-full";
+  case AdmissionController::Result::EXPIRED:
+    return os << "expired";
+  }
+  return os << static_cast<int>(result);
+}
+
+struct ClassMetrics
+{
+  std::array<metrics::Counter*, RESULT_COUNT> results;
+  metrics::Gauge* queueSize;
+};
+
+const ClassMetrics&
+getClassMetrics(AdmissionClass admissionClass)
+{
+  static const auto all = [] {
+    std::array<ClassMetrics, ADMISSION_CLASS_COUNT> metrics;
+    auto& registry = metrics::Registry::get();
+    for (size_t i = 0; i < ADMISSION_CLASS_COUNT; ++i) {
+      std::ostringstream classLabel;
+      classLabel << "class=\"" << static_cast<AdmissionClass>(i) << '"';
+      for (size_t j = 0; j < RESULT_COUNT; ++j) {
+        std::ostringstream labels;
+        labels << classLabel.str() << ",result=\"" << static_cast<AdmissionController::Result>(j) << '"';
+        metrics[i].results[j] = &registry.addCounter("nlsr_admission_interests_total",
+          "Incoming Interests by admission class and outcome", labels.str());
+      }
+      metrics[i].queueSize = &registry.addGauge("nlsr_admission_queue_size",
+        "Interests waiting to be handled, by admission class", classLabel.str());
+    }
+    return metrics;
+  }();
+  return all[static_cast<size_t>(admissionClass)];
+}
+
+uint64_t
+getSource(const ndn::Interest& interest)
+{
+  auto incomingFaceIdTag = interest.getTag<ndn::lp::IncomingFaceIdTag>();
+  return incomingFaceIdTag == nullptr ? 0 : incomingFaceIdTag->get();
+}
+
+} // namespace
+
+std::ostream&
+operator<<(std::ostream& os, AdmissionClass admissionClass)
+{
+  switch (admissionClass) {
+  case AdmissionClass::HELLO:
+    return os << "hello";
+  case AdmissionClass::LSA:
+    return os << "lsa";
+  case AdmissionClass::DATASET:
+    return os << "dataset";
+  }
+  return os << static_cast<int>(admissionClass);
+}
+
+AdmissionController::AdmissionController(boost::asio::io_context& io,
+                                         const ConfParameter& confParam,
+                                         LagSource lagSource)
+  : m_scheduler(io)
+  , m_lagSource(std::move(lagSource))
+  , m_shedLag(confParam.getAdmissionShedLag())
+  , m_sourceRate(confParam.getAdmissionSourceRate())
+  , m_sourceBurst(confParam.getAdmissionSourceBurst())
+  , m_maxQueueLength(confParam.getAdmissionMaxQueueLength())
+{
+}
+
+ndn::InterestCallback
+AdmissionController::wrap(AdmissionClass admissionClass, ndn::InterestCallback handler)
+{
+  return [this, admissionClass, handler = std::make_shared<ndn::InterestCallback>(std::move(handler))]
+         (const ndn::InterestFilter& filter, const ndn::Interest& interest) {
+    enqueue(admissionClass, getSource(interest), interest.getInterestLifetime(),
+            [handler, filter, interest] { (*handler)(filter, interest); });
+  };
+}
+
+ndn::mgmt::Authorization
+AdmissionController::makeDatasetAuthorization()
+{
+  return [this] (const ndn::Name&, const ndn::Interest& interest,
+                 const ndn::mgmt::ControlParametersBase*,
+                 const ndn::mgmt::AcceptContinuation& accept,
+                 const ndn::mgmt::RejectContinuation& reject) {
+    auto result = enqueue(AdmissionClass::DATASET, getSource(interest),
+                          interest.getInterestLifetime(), [accept] { accept(""); });
+    if (result != Result::ADMITTED) {
+      reject(ndn::mgmt::RejectReply::SILENT);
+    }
+  };
+}
+
+AdmissionController::Result
+AdmissionController::enqueue(AdmissionClass admissionClass, uint64_t source,
+                             ndn::time::milliseconds lifetime, std::function<void()> handler)
+{
+  auto result = Result::ADMITTED;
+  if (admissionClass != AdmissionClass::HELLO) {
+    auto lag = std::max(m_lagSource ? m_lagSource() : 0_ns, getQueueDelay());
+    auto shedLag = admissionClass == AdmissionClass::LSA ? 2 * m_shedLag : m_shedLag;
+    if (m_shedLag > 0_ms && lag > shedLag) {
+      result = Result::SHED;
+    }
+    else if (!consumeToken(source)) {
+      result = Result::RATE_LIMITED;
+    }
+  }
+
+  auto& queue = m_queues[static_cast<size_t>(admissionClass)];
+  if (result == Result::ADMITTED && queue.size() >= m_maxQueueLength) {
+    result = Result::QUEUE_FULL;
+  }
+  count(admissionClass, result);
+  if (result != Result::ADMITTED) {
+    NLSR_LOG_TRACE("Dropping " << admissionClass << " Interest from face " << source << ": " << result);
+    return result;
+  }
+
+  auto now = ndn::time::steady_clock::now();
+  queue.push_back({std::move(handler), now, now + lifetime});
+  getClassMetrics(admissionClass).queueSize->add(1);
+  if (!m_drainEvent) {
+    m_drainEvent = m_scheduler.schedule(0_ns, [this] { drain(); });
+  }
+  return result;
+}
+
+void
+AdmissionController::drain()
+{
+  size_t nHandled = 0;
+  for (size_t i = 0; i < ADMISSION_CLASS_COUNT && nHandled < DRAIN_BATCH; ++i) {
+    auto& queue = m_queues[i];
+    while (!queue.empty() && nHandled < DRAIN_BATCH) {
+      Pending pending = std::move(queue.front());
+      queue.pop_front();
+      getClassMetrics(static_cast<AdmissionClass>(i)).queueSize->add(-1);
+      if (pending.deadline < ndn::time::steady_clock::now()) {
+        count(static_cast<AdmissionClass>(i), Result::EXPIRED);
+        continue;
+      }
+      // a handler may enqueue more Interests, e.g. when it receives one synchronously
+      pending.handler();
+      ++nHandled;
+    }
+  }
+
+  m_drainEvent.cancel();
+  for (const auto& queue : m_queues) {
+    if (!queue.empty()) {
+      m_drainEvent = m_scheduler.schedule(0_ns, [this] { drain(); });
+      break;
+    }
+  }
+}
+
+bool
+AdmissionController::consumeToken(uint64_t source)
+{
+  if (m_sourceRate <= 0) {
+    return true;
+  }
+
+  auto now = ndn::time::steady_clock::now();
+  auto it = m_buckets.find(source);
+  if (it == m_buckets.end()) {
+    if (m_buckets.size() >= MAX_SOURCES) {
+      // forget sources that have been idle long enough to refill their bucket
+      auto refillTime = ndn::time::duration_cast<ndn::time::nanoseconds>(
+        ndn::time::duration<double>(m_sourceBurst / m_sourceRate));
+      for (auto bucket = m_buckets.begin(); bucket != m_buckets.end();) {
+        bucket = now - bucket->second.lastRefill >= refillTime ? m_buckets.erase(bucket) : ++bucket;
+      }
+    }
+    it = m_buckets.emplace(source, TokenBucket{m_sourceBurst, now}).first;
+  }
+
+  auto& bucket = it->second;
+  double elapsed = ndn::time::duration<double>(now - bucket.lastRefill).count();
+  bucket.tokens = std::min(m_sourceBurst, bucket.tokens + elapsed * m_sourceRate);
+  bucket.lastRefill = now;
+  if (bucket.tokens < 1) {
+    return false;
+  }
+  bucket.tokens -= 1;
+  return true;
+}
+
+ndn::time::nanoseconds
+AdmissionController::getQueueDelay() const
+{
+  ndn::time::nanoseconds delay = 0_ns;
+  auto now = ndn::time::steady_clock::now();
+  for (const auto& queue : m_queues) {
+    if (!queue.empty()) {
+      delay = std::max<ndn::time::nanoseconds>(delay, now - queue.front().arrival);
+    }
+  }
+  return delay;
+}
+
+void
+AdmissionController::count(AdmissionClass admissionClass, Result result)
+{
+  getClassMetrics(admissionClass).results[static_cast<size_t>(result)]->increment();
+}
+
+} // namespace nlsr
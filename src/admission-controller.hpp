@@ -0,0 +1,178 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_ADMISSION_CONTROLLER_HPP
+#define NLSR_ADMISSION_CONTROLLER_HPP
+
+#include "common.hpp"
+#include "test-access-control.hpp"
+
+#include <ndn-cxx/face.hpp>
+#include <ndn-cxx/mgmt/dispatcher.hpp>
+#include <ndn-cxx/util/scheduler.hpp>
+
+#include <boost/noncopyable.hpp>
+
+#include <array>
+#include <deque>
+#include <functional>
+#include <unordered_map>
+
+namespace nlsr {
+
+class ConfParameter;
+
+/*! \brief Priority classes of incoming Interests, highest priority first.
+ */
+enum class AdmissionClass {
+  /// Hello and link-cost probe Interests, which keep adjacencies up
+  HELLO,
+  /// LSA Interests from neighbors
+  LSA,
+  /// Management datasets, e.g. from nlsrc
+  DATASET,
+};
+
+inline constexpr size_t ADMISSION_CLASS_COUNT = static_cast<size_t>(AdmissionClass::DATASET) + 1;
+
+std::ostream&
+operator<<(std::ostream& os, AdmissionClass admissionClass);
+
+/*! \brief Admission control in front of the Interest filters of NLSR.
+ *
+ * Admitted Interests are queued per class and handed to their handler from the
+ * event loop, highest class first and a few at a time, so that a burst of LSA or
+ * dataset Interests cannot delay Hello processing or timers indefinitely.
+ *
+ * An Interest is dropped on arrival if:
+ *  - its incoming face exceeded the per-source rate limit (HELLO is exempt);
+ *  - the event loop lags by more than the shedding threshold (DATASET), or by
+ *    more than twice the threshold (LSA); HELLO is never shed. The lag is the larger
+ *    of the one reported by the LagSource and the time the oldest queued Interest
+ *    has been waiting;
+ *  - the queue of its class is full.
+ * A queued Interest whose lifetime elapsed before it could be handled is dropped
+ * as well, since its consumer has given up on it.
+ *
+ * Sync Interests are served by the filters of the sync library, ahead of any
+ * queued Interest, and are not subject to admission control.
+ */
+class AdmissionController : boost::noncopyable
+{
+public:
+  /*! \brief Returns the current event-loop lag.
+   */
+  using LagSource = std::function<ndn::time::nanoseconds()>;
+
+  enum class Result {
+    ADMITTED,
+    RATE_LIMITED,
+    SHED,
+    QUEUE_FULL,
+    EXPIRED,
+  };
+
+  /*! \param lagSource measures the event-loop lag; shedding is disabled if empty
+   */
+  AdmissionController(boost::asio::io_context& io, const ConfParameter& confParam,
+                      LagSource lagSource = nullptr);
+
+  /*! \brief Returns an Interest filter callback that admits Interests into \p admissionClass
+   *         before passing them to \p handler.
+   */
+  ndn::InterestCallback
+  wrap(AdmissionClass admissionClass, ndn::InterestCallback handler);
+
+  /*! \brief Returns a dispatcher authorization that admits Interests into the DATASET class.
+   *
+   * Accepted Interests are processed by the dispatcher when their turn comes;
+   * dropped ones are rejected silently.
+   */
+  ndn::mgmt::Authorization
+  makeDatasetAuthorization();
+
+  size_t
+  getQueueSize(AdmissionClass admissionClass) const
+  {
+    return m_queues[static_cast<size_t>(admissionClass)].size();
+  }
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /*! \brief Queues \p handler unless the Interest is dropped by admission control.
+   *
+   * \param source the incoming face of the Interest, or 0 if unknown
+   * \param lifetime the Interest lifetime, after which \p handler is no longer invoked
+   */
+  Result
+  enqueue(AdmissionClass admissionClass, uint64_t source, ndn::time::milliseconds lifetime,
+          std::function<void()> handler);
+
+  /*! \brief Invokes up to DRAIN_BATCH queued handlers in priority order.
+   */
+  void
+  drain();
+
+private:
+  bool
+  consumeToken(uint64_t source);
+
+  /*! \brief Returns how long the oldest queued Interest has been waiting.
+   */
+  ndn::time::nanoseconds
+  getQueueDelay() const;
+
+  void
+  count(AdmissionClass admissionClass, Result result);
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  static constexpr size_t DRAIN_BATCH = 8;
+  /// Token buckets are pruned once more sources than this have been seen
+  static constexpr size_t MAX_SOURCES = 1024;
+
+private:
+  struct Pending
+  {
+    std::function<void()> handler;
+    ndn::time::steady_clock::time_point arrival;
+    ndn::time::steady_clock::time_point deadline;
+  };
+
+  struct TokenBucket
+  {
+    double tokens;
+    ndn::time::steady_clock::time_point lastRefill;
+  };
+
+  ndn::Scheduler m_scheduler;
+  LagSource m_lagSource;
+  ndn::time::milliseconds m_shedLag;
+  double m_sourceRate;
+  double m_sourceBurst;
+  size_t m_maxQueueLength;
+
+  std::array<std::deque<Pending>, ADMISSION_CLASS_COUNT> m_queues;
+  std::unordered_map<uint64_t, TokenBucket> m_buckets;
+  ndn::scheduler::ScopedEventId m_drainEvent;
+};
+
+} // namespace nlsr
+
+#endif // NLSR_ADMISSION_CONTROLLER_HPP
@@ -0,0 +1,80 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_AREA_HPP
+#define NLSR_AREA_HPP
+
+#include "common.hpp"
+
+#include <optional>
+
+namespace nlsr::area {
+
+/*! \brief The area that every area border router is attached to.
+ */
+inline const std::string BACKBONE{"0"};
+
+/*! \brief Marks the origin of a summary LSA, e.g.
+ *         /<network>/<site>/%C1.Router/<router>/%C1.Summary/<area>
+ */
+inline const ndn::name::Component SUMMARY_COMPONENT{ndn::Name("/%C1.Summary")[0]};
+
+/*! \brief Returns the sync prefix of the routers in \p area.
+ *
+ * Routers that are not configured with any area keep using \p syncPrefix itself.
+ */
+inline ndn::Name
+makeSyncPrefix(const ndn::Name& syncPrefix, const std::string& area)
+{
+  return area.empty() ? syncPrefix : ndn::Name(syncPrefix).append(area);
+}
+
+/*! \brief Returns the origin of the summary of \p area originated by \p router.
+ */
+inline ndn::Name
+makeSummaryOrigin(const ndn::Name& router, const std::string& area)
+{
+  return ndn::Name(router).append(SUMMARY_COMPONENT).append(area);
+}
+
+/*! \brief Returns the area summarized by an LSA with origin \p origin,
+ *         or nullopt if the LSA is not a summary.
+ */
+inline std::optional<std::string>
+getSummarizedArea(const ndn::Name& origin)
+{
+  if (origin.size() < 2 || origin[-2] != SUMMARY_COMPONENT) {
+    return std::nullopt;
+  }
+  return origin[-1].toUri();
+}
+
+/*! \brief Returns the router that originated an LSA with origin \p origin.
+ */
+inline ndn::Name
+getAdvertisingRouter(const ndn::Name& origin)
+{
+  return getSummarizedArea(origin) ? origin.getPrefix(-2) : origin;
+}
+
+} // namespace nlsr::area
+
+#endif // NLSR_AREA_HPP
@@ -20,8 +20,11 @@
  */
 
 #include "sync-logic-handler.hpp"
+#include "area.hpp"
 #include "hello-protocol.hpp"
 #include "logger.hpp"
+#include "metrics/event-loop-monitor.hpp"
+#include "metrics/metrics-registry.hpp"
 #include "utility/name-helper.hpp"
 
 namespace nlsr {
@@ -30,31 +33,84 @@ INIT_LOGGER(SyncLogicHandler);
 
 const std::string LSA_COMPONENT{"LSA"};
 
+namespace {
+
+auto& syncUpdatesReceived = metrics::Registry::get().addCounter("nlsr_sync_updates_total",
+  "Sync updates exchanged with other routers", "direction=\"received\"");
+auto& syncUpdatesPublished = metrics::Registry::get().addCounter("nlsr_sync_updates_total",
+  "Sync updates exchanged with other routers", "direction=\"published\"");
+
+} // namespace
+
 SyncLogicHandler::SyncLogicHandler(ndn::Face& face, ndn::KeyChain& keyChain,
                                    IsLsaNew isLsaNew, const SyncLogicOptions& opts)
   : m_isLsaNew(std::move(isLsaNew))
   , m_routerPrefix(opts.routerPrefix)
   , m_hyperbolicState(opts.hyperbolicState)
+  , m_userPrefix(opts.userPrefix)
+  , m_areas(opts.areas)
   , m_nameLsaUserPrefix(makeLsaUserPrefix(opts.userPrefix, Lsa::Type::NAME))
   , m_adjLsaUserPrefix(makeLsaUserPrefix(opts.userPrefix, Lsa::Type::ADJACENCY))
   , m_coorLsaUserPrefix(makeLsaUserPrefix(opts.userPrefix, Lsa::Type::COORDINATE))
-  , m_syncLogic(face, keyChain, opts.syncProtocol, opts.syncPrefix,
+  , m_syncLogic(face, keyChain, opts.syncProtocol,
+                area::makeSyncPrefix(opts.syncPrefix, m_areas.empty() ? "" : m_areas.front()),
                 m_nameLsaUserPrefix, opts.syncInterestLifetime,
-                std::bind(&SyncLogicHandler::processUpdate, this, _1, _2, _3))
+                [this, area = m_areas.empty() ? "" : m_areas.front()] (auto&&... args) {
+                  processUpdate(area, std::forward<decltype(args)>(args)...);
+                })
 {
-  if (m_hyperbolicState != HYPERBOLIC_STATE_ON) {
-    m_syncLogic.addUserNode(m_adjLsaUserPrefix);
+  for (size_t i = 1; i < m_areas.size(); ++i) {
+    const auto& area = m_areas[i];
+    m_areaSyncLogic.emplace(area, std::make_unique<SyncProtocolAdapter>(
+      face, keyChain, opts.syncProtocol, area::makeSyncPrefix(opts.syncPrefix, area),
+      m_nameLsaUserPrefix, opts.syncInterestLifetime,
+      [this, area] (auto&&... args) {
+        processUpdate(area, std::forward<decltype(args)>(args)...);
+      }));
   }
 
-  if (m_hyperbolicState != HYPERBOLIC_STATE_OFF) {
-    m_syncLogic.addUserNode(m_coorLsaUserPrefix);
+  forEachGroup([this] (const std::string& groupArea, SyncProtocolAdapter& group) {
+    if (m_hyperbolicState != HYPERBOLIC_STATE_ON) {
+      group.addUserNode(m_adjLsaUserPrefix);
+    }
+
+    if (m_hyperbolicState != HYPERBOLIC_STATE_OFF) {
+      group.addUserNode(m_coorLsaUserPrefix);
+    }
+
+    // Each group carries the summaries of the other areas of this router
+    for (const auto& area : m_areas) {
+      if (m_areas.size() > 1 && area != groupArea) {
+        group.addUserNode(makeSummaryUserPrefix(area));
+      }
+    }
+  });
+}
+
+template<typename Function>
+void
+SyncLogicHandler::forEachGroup(const Function& f)
+{
+  f(m_areas.empty() ? "" : m_areas.front(), m_syncLogic);
+  for (auto& [area, group] : m_areaSyncLogic) {
+    f(area, *group);
   }
 }
 
+ndn::Name
+SyncLogicHandler::makeSummaryUserPrefix(const std::string& area) const
+{
+  return makeLsaUserPrefix(ndn::Name(m_userPrefix).append(area::SUMMARY_COMPONENT).append(area),
+                           Lsa::Type::NAME);
+}
+
 void
-SyncLogicHandler::processUpdate(const ndn::Name& updateName, uint64_t highSeq, uint64_t incomingFaceId)
+SyncLogicHandler::processUpdate(const std::string& area, const ndn::Name& updateName,
+                                uint64_t highSeq, uint64_t incomingFaceId)
 {
+  metrics::HandlerScope scope(metrics::HandlerTag::SYNC, "processUpdate");
   NLSR_LOG_DEBUG("Update Name: " << updateName << " Seq no: " << highSeq);
+  syncUpdatesReceived.increment();
 
   int32_t nlsrPosition = util::getNameComponentPosition(updateName, HelloProtocol::NLSR_COMPONENT);
   int32_t lsaPosition = util::getNameComponentPosition(updateName, LSA_COMPONENT);
@@ -69,9 +125,20 @@ SyncLogicHandler::processUpdate(const ndn::Name& updateName, uint64_t highSeq, u
   ndn::Name originRouter = networkName;
   originRouter.append(routerName);
 
+  if (m_areas.size() > 1) {
+    m_routerAreas[originRouter].insert(area);
+  }
+
   processUpdateFromSync(originRouter, updateName, highSeq, incomingFaceId);
 }
 
+bool
+SyncLogicHandler::isInArea(const ndn::Name& originRouter, const std::string& area) const
+{
+  auto it = m_routerAreas.find(originRouter);
+  return it != m_routerAreas.end() && it->second.count(area) > 0;
+}
+
 void
 SyncLogicHandler::processUpdateFromSync(const ndn::Name& originRouter,
                                         const ndn::Name& updateName, uint64_t seqNo,
@@ -79,7 +146,7 @@ SyncLogicHandler::processUpdateFromSync(const ndn::Name& originRouter,
 {
   NLSR_LOG_DEBUG("Origin Router of update: " << originRouter);
 
-  if (originRouter == m_routerPrefix) {
+  if (area::getAdvertisingRouter(originRouter) == m_routerPrefix) {
     // A router should not try to fetch its own LSA
     return;
   }
@@ -110,19 +177,37 @@ SyncLogicHandler::processUpdateFromSync(const ndn::Name& originRouter,
 void
 SyncLogicHandler::publishRoutingUpdate(Lsa::Type type, uint64_t seqNo)
 {
+  const ndn::Name* userPrefix = nullptr;
   switch (type) {
   case Lsa::Type::ADJACENCY:
-    m_syncLogic.publishUpdate(m_adjLsaUserPrefix, seqNo);
+    userPrefix = &m_adjLsaUserPrefix;
     break;
   case Lsa::Type::COORDINATE:
-    m_syncLogic.publishUpdate(m_coorLsaUserPrefix, seqNo);
+    userPrefix = &m_coorLsaUserPrefix;
     break;
   case Lsa::Type::NAME:
-    m_syncLogic.publishUpdate(m_nameLsaUserPrefix, seqNo);
+    userPrefix = &m_nameLsaUserPrefix;
     break;
   default:
-    break;
+    return;
   }
+
+  forEachGroup([&] (const std::string&, SyncProtocolAdapter& group) {
+    syncUpdatesPublished.increment();
+    group.publishUpdate(*userPrefix, seqNo);
+  });
+}
+
+void
+SyncLogicHandler::publishSummaryUpdate(const std::string& area, uint64_t seqNo)
+{
+  auto userPrefix = makeSummaryUserPrefix(area);
+  forEachGroup([&] (const std::string& groupArea, SyncProtocolAdapter& group) {
+    if (groupArea != area) {
+      syncUpdatesPublished.increment();
+      group.publishUpdate(userPrefix, seqNo);
+    }
+  });
 }
 
 } // namespace nlsr
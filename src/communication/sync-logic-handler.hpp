@@ -30,6 +30,9 @@
 
 #include <boost/lexical_cast.hpp>
 
+#include <map>
+#include <set>
+
 namespace nlsr {
 
 struct SyncLogicOptions
@@ -40,6 +43,8 @@ struct SyncLogicOptions
   ndn::time::milliseconds syncInterestLifetime;
   ndn::Name routerPrefix;
   HyperbolicState hyperbolicState;
+  /// Areas this router is attached to; empty if the network is not divided into areas
+  std::vector<std::string> areas = {};
 };
 
 inline ndn::Name
@@ -52,6 +57,11 @@ makeLsaUserPrefix(const ndn::Name& userPrefix, Lsa::Type lsaType)
  *
  * This class serves as the abstraction for the syncing portion of
  * NLSR and its components.
+ *
+ * When the network is divided into areas, each area has its own sync group and a
+ * router joins the group of every area it is attached to, so that its LSAs are
+ * only flooded within those areas. Area border routers additionally publish in
+ * each group the summaries of their other areas.
  */
 class SyncLogicHandler
 {
@@ -81,6 +91,18 @@ public:
   void
   publishRoutingUpdate(Lsa::Type type, uint64_t seqNo);
 
+  /*! \brief Publish a new version of the summary of \p area in every other area.
+   */
+  void
+  publishSummaryUpdate(const std::string& area, uint64_t seqNo);
+
+  /*! \brief Returns whether LSAs of \p originRouter have been received in the group of \p area.
+   *
+   * Only tracked on area border routers, which summarize each area separately.
+   */
+  bool
+  isInArea(const ndn::Name& originRouter, const std::string& area) const;
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /*! \brief Callback from Sync protocol
    *
@@ -89,7 +111,8 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
    * \param highSeq The latest sequence number of the update
    */
   void
-  processUpdate(const ndn::Name& updateName, uint64_t highSeq, uint64_t incomingFaceId);
+  processUpdate(const std::string& area, const ndn::Name& updateName, uint64_t highSeq,
+                uint64_t incomingFaceId);
 
   /*! \brief Determine which kind of LSA was updated and fetch it.
    *
@@ -106,17 +129,33 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 public:
   OnNewLsa onNewLsa;
 
+private:
+  ndn::Name
+  makeSummaryUserPrefix(const std::string& area) const;
+
+  template<typename Function>
+  void
+  forEachGroup(const Function& f);
+
 private:
   IsLsaNew m_isLsaNew;
   ndn::Name m_routerPrefix;
   HyperbolicState m_hyperbolicState;
+  ndn::Name m_userPrefix;
+  std::vector<std::string> m_areas;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   ndn::Name m_nameLsaUserPrefix;
   ndn::Name m_adjLsaUserPrefix;
   ndn::Name m_coorLsaUserPrefix;
 
+  /// Group of the first configured area, or of the whole network
   SyncProtocolAdapter m_syncLogic;
+  /// Groups of the other areas of an area border router
+  std::map<std::string, std::unique_ptr<SyncProtocolAdapter>> m_areaSyncLogic;
+
+private:
+  std::map<ndn::Name, std::set<std::string>> m_routerAreas;
 };
 
 } // namespace nlsr
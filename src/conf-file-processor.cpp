@@ -21,24 +21,56 @@
 
 #include "conf-file-processor.hpp"
 #include "adjacent.hpp"
+#include "area.hpp"
 #include "update/prefix-update-processor.hpp"
 #include "utility/name-helper.hpp"
 
 #include <ndn-cxx/name.hpp>
+#include <ndn-cxx/net/ethernet.hpp>
 #include <ndn-cxx/net/face-uri.hpp>
 #include <ndn-cxx/util/io.hpp>
 
 #include <boost/algorithm/string.hpp>
+#include <boost/asio/ip/address.hpp>
 #include <boost/property_tree/info_parser.hpp>
 
+#include <algorithm>
+#include <cctype>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <sstream>
 
 namespace nlsr {
 
 namespace fs = std::filesystem;
 
+/*! \brief Returns whether \p id is a valid area or topology identifier.
+ */
+static bool
+isValidIdentifier(const std::string& id)
+{
+  return !id.empty() &&
+         std::all_of(id.begin(), id.end(),
+                     [] (unsigned char c) { return std::isalnum(c) || c == '-' || c == '_'; });
+}
+
+/*! \brief Returns whether canonical \p faceUri designates a multicast face.
+ */
+static bool
+isMulticastFaceUri(const ndn::FaceUri& faceUri)
+{
+  if (faceUri.getScheme() == "ether") {
+    return ndn::ethernet::Address::fromString(faceUri.getHost()).isMulticast();
+  }
+  if (faceUri.getScheme() == "udp4" || faceUri.getScheme() == "udp6") {
+    boost::system::error_code ec;
+    auto address = boost::asio::ip::make_address(faceUri.getHost(), ec);
+    return !ec && address.is_multicast();
+  }
+  return false;
+}
+
 template <class T>
 class ConfigurationVariable
 {
@@ -157,10 +189,19 @@ ConfFileProcessor::processConfFile()
   }
 
   m_confParam.buildRouterAndSyncUserPrefix();
-  m_confParam.writeLog();
+  if (!m_isReload) {
+    m_confParam.writeLog();
+  }
   return true;
 }
 
+bool
+ConfFileProcessor::processConfFileForReload()
+{
+  m_isReload = true;
+  return processConfFile();
+}
+
 bool
 ConfFileProcessor::load(std::istream& input)
 {
@@ -204,6 +245,18 @@ ConfFileProcessor::processSection(const std::string& sectionName, const ConfigSe
   else if (sectionName == "security") {
     ret = processConfSectionSecurity(section);
   }
+  else if (sectionName == "metrics") {
+    ret = processConfSectionMetrics(section);
+  }
+  else if (sectionName == "admission") {
+    ret = processConfSectionAdmission(section);
+  }
+  else if (sectionName == "readvertise") {
+    ret = processConfSectionReadvertise(section);
+  }
+  else if (sectionName == "topologies") {
+    ret = processConfSectionTopologies(section);
+  }
   else {
     std::cerr << "Unknown configuration section: " << sectionName << std::endl;
   }
@@ -245,6 +298,20 @@ ConfFileProcessor::processConfSectionGeneral(const ConfigSection& section)
     return false;
   }
 
+  // lsa-encoding
+  std::string lsaEncoding = section.get<std::string>("lsa-encoding", "full");
+  if (lsaEncoding == "full") {
+    m_confParam.setLsaEncodingCompact(false);
+  }
+  else if (lsaEncoding == "compact") {
+    m_confParam.setLsaEncodingCompact(true);
+  }
+  else {
+    std::cerr << "LSA encoding '" << lsaEncoding << "' is not supported!\n"
+              << "Use 'full' or 'compact'\n";
+    return false;
+  }
+
   try {
     std::string network = section.get<std::string>("network");
     std::string site = section.get<std::string>("site");
@@ -330,6 +397,34 @@ ConfFileProcessor::processConfSectionGeneral(const ConfigSection& section)
     return false;
   }
 
+  // area
+  for (const auto& tn : section) {
+    if (tn.first != "area") {
+      continue;
+    }
+    std::string area = tn.second.data();
+    if (!isValidIdentifier(area)) {
+      std::cerr << "Invalid area '" << area << "'. "
+                << "Area identifiers consist of letters, digits, '-' and '_'" << std::endl;
+      return false;
+    }
+    const auto& areas = m_confParam.getAreas();
+    if (std::find(areas.begin(), areas.end(), area) != areas.end()) {
+      std::cerr << "Area " << area << " is configured more than once" << std::endl;
+      return false;
+    }
+    m_confParam.addArea(area);
+  }
+
+  if (m_confParam.isAreaBorderRouter()) {
+    const auto& areas = m_confParam.getAreas();
+    if (std::find(areas.begin(), areas.end(), area::BACKBONE) == areas.end()) {
+      std::cerr << "An area border router must be attached to the backbone area "
+                << area::BACKBONE << std::endl;
+      return false;
+    }
+  }
+
   // state-dir
   try {
     fs::path stateDir(section.get<std::string>("state-dir"));
@@ -348,25 +443,31 @@ ConfFileProcessor::processConfSectionGeneral(const ConfigSection& section)
         }
 
         m_confParam.setConfFileNameDynamic(conFileDynamic.string());
-        try {
-          fs::copy_file(m_confFileName, conFileDynamic, fs::copy_options::overwrite_existing);
-        }
-        catch (const fs::filesystem_error& e) {
-          std::cerr << "Error copying conf file to state-dir: " << e.what() << std::endl;
-          return false;
-        }
-
-        auto testFilePath = stateDir / "test.seq";
-        std::ofstream testFile(testFilePath);
-        if (testFile) {
+        if (m_isReload) {
+          // The running instance owns the dynamic file and has already checked the directory
           m_confParam.setStateFileDir(stateDir.string());
         }
         else {
-          std::cerr << "NLSR does not have read/write permission on state-dir" << std::endl;
-          return false;
+          try {
+            fs::copy_file(m_confFileName, conFileDynamic, fs::copy_options::overwrite_existing);
+          }
+          catch (const fs::filesystem_error& e) {
+            std::cerr << "Error copying conf file to state-dir: " << e.what() << std::endl;
+            return false;
+          }
+
+          auto testFilePath = stateDir / "test.seq";
+          std::ofstream testFile(testFilePath);
+          if (testFile) {
+            m_confParam.setStateFileDir(stateDir.string());
+          }
+          else {
+            std::cerr << "NLSR does not have read/write permission on state-dir" << std::endl;
+            return false;
+          }
+          testFile.close();
+          fs::remove(testFilePath);
         }
-        testFile.close();
-        fs::remove(testFilePath);
       }
       else {
         std::cerr << "Provided state-dir " << stateDir << " is not a directory" << std::endl;
@@ -468,6 +569,19 @@ ConfFileProcessor::processConfSectionNeighbors(const ConfigSection& section)
     return false;
   }
 
+  // no-transit
+  std::string noTransit = section.get<std::string>("no-transit", "off");
+  if (boost::iequals(noTransit, "off")) {
+    m_confParam.setNoTransit(false);
+  }
+  else if (boost::iequals(noTransit, "on")) {
+    m_confParam.setNoTransit(true);
+  }
+  else {
+    std::cerr << "Invalid value for no-transit: " << noTransit << ". Use 'on' or 'off'" << std::endl;
+    return false;
+  }
+
   // Event intervals
   // adj-lsa-build-interval
   ConfigurationVariable<uint32_t> adjLsaBuildInterval("adj-lsa-build-interval",
@@ -512,34 +626,63 @@ ConfFileProcessor::processConfSectionNeighbors(const ConfigSection& section)
         std::string name = CommandAttriTree.get<std::string>("name");
         std::string uriString = CommandAttriTree.get<std::string>("face-uri");
 
+        auto canonize = [this] (ndn::FaceUri& faceUri) {
+          bool failedToCanonize = false;
+          faceUri.canonize([&faceUri] (const auto& canonicalUri) {
+                             faceUri = canonicalUri;
+                           },
+                           [&faceUri, &failedToCanonize] (const auto& reason) {
+                             failedToCanonize = true;
+                             std::cerr << "Could not canonize URI: '" << faceUri
+                                       << "' because: " << reason << std::endl;
+                           },
+                           m_io,
+                           TIME_ALLOWED_FOR_CANONIZATION);
+          m_io.run();
+          m_io.restart();
+          return !failedToCanonize;
+        };
+
         ndn::FaceUri faceUri;
         if (!faceUri.parse(uriString)) {
           std::cerr << "face-uri parsing failed" << std::endl;
           return false;
         }
-
-        bool failedToCanonize = false;
-        faceUri.canonize([&faceUri] (const auto& canonicalUri) {
-                           faceUri = canonicalUri;
-                         },
-                         [&faceUri, &failedToCanonize] (const auto& reason) {
-                           failedToCanonize = true;
-                           std::cerr << "Could not canonize URI: '" << faceUri
-                                     << "' because: " << reason << std::endl;
-                         },
-                         m_io,
-                         TIME_ALLOWED_FOR_CANONIZATION);
-        m_io.run();
-        m_io.restart();
-
-        if (failedToCanonize) {
+        if (!canonize(faceUri)) {
           return false;
         }
 
+        ndn::FaceUri helloFaceUri;
+        auto helloUriString = CommandAttriTree.get_optional<std::string>("hello-face-uri");
+        if (helloUriString) {
+          if (!helloFaceUri.parse(*helloUriString) || !canonize(helloFaceUri)) {
+            std::cerr << "hello-face-uri parsing failed" << std::endl;
+            return false;
+          }
+          if (!isMulticastFaceUri(helloFaceUri)) {
+            std::cerr << "hello-face-uri " << helloFaceUri << " is not a multicast face" << std::endl;
+            return false;
+          }
+        }
+
         double linkCost = CommandAttriTree.get<double>("link-cost", Adjacent::DEFAULT_LINK_COST);
         ndn::Name neighborName(name);
         if (!neighborName.empty()) {
           Adjacent adj(name, faceUri, linkCost, Adjacent::STATUS_INACTIVE, 0, 0);
+          adj.setHelloFaceUri(helloFaceUri);
+          for (const auto& attr : CommandAttriTree) {
+            if (attr.first != "topology-cost") {
+              continue;
+            }
+            std::istringstream is(attr.second.data());
+            std::string topology;
+            double cost = 0;
+            if (!(is >> topology >> cost) || !isValidIdentifier(topology) || cost < 0) {
+              std::cerr << "Wrong command format! [topology-cost <topology> <cost>]" << std::endl;
+              return false;
+            }
+            adj.setTopologyCost(topology, cost);
+          }
           m_confParam.getAdjacencyList().insert(adj);
         }
         else {
@@ -577,6 +720,16 @@ ConfFileProcessor::processConfSectionHyperbolic(const ConfigSection& section)
     return false;
   }
 
+  if (m_confParam.getHyperbolicState() != HYPERBOLIC_STATE_OFF && !m_confParam.getAreas().empty()) {
+    std::cerr << "Hyperbolic routing cannot be used together with areas" << std::endl;
+    return false;
+  }
+  if (m_confParam.getHyperbolicState() != HYPERBOLIC_STATE_OFF &&
+      !m_confParam.getTopologies().empty()) {
+    std::cerr << "Hyperbolic routing cannot be used together with topologies" << std::endl;
+    return false;
+  }
+
   try {
     // Radius and angle(s) are mandatory configuration parameters in hyperbolic section.
     // Even if router can have hyperbolic routing calculation off but other router
@@ -710,4 +863,167 @@ ConfFileProcessor::processConfSectionSecurity(const ConfigSection& section)
   return true;
 }
 
+bool
+ConfFileProcessor::processConfSectionMetrics(const ConfigSection& section)
+{
+  m_confParam.setMetricsFile(section.get<std::string>("prometheus-file", ""));
+  m_confParam.setMetricsSocket(section.get<std::string>("prometheus-socket", ""));
+
+  ConfigurationVariable<uint32_t> fileInterval("prometheus-file-interval",
+                                               std::bind(&ConfParameter::setMetricsFileInterval,
+                                                         &m_confParam, _1));
+  fileInterval.setMinAndMaxValue(METRICS_FILE_INTERVAL_MIN, METRICS_FILE_INTERVAL_MAX);
+  fileInterval.setOptional(METRICS_FILE_INTERVAL_DEFAULT);
+
+  ConfigurationVariable<uint32_t> heartbeat("event-loop-heartbeat",
+                                            std::bind(&ConfParameter::setEventLoopHeartbeat,
+                                                      &m_confParam, _1));
+  heartbeat.setMinAndMaxValue(EVENT_LOOP_HEARTBEAT_MIN, EVENT_LOOP_HEARTBEAT_MAX);
+  heartbeat.setOptional(EVENT_LOOP_HEARTBEAT_DEFAULT);
+
+  ConfigurationVariable<uint32_t> slowThreshold("slow-handler-threshold",
+                                                std::bind(&ConfParameter::setSlowHandlerThreshold,
+                                                          &m_confParam, _1));
+  slowThreshold.setMinAndMaxValue(SLOW_HANDLER_THRESHOLD_MIN, SLOW_HANDLER_THRESHOLD_MAX);
+  slowThreshold.setOptional(SLOW_HANDLER_THRESHOLD_DEFAULT);
+
+  return fileInterval.parseFromConfigSection(section) &&
+         heartbeat.parseFromConfigSection(section) &&
+         slowThreshold.parseFromConfigSection(section);
+}
+
+bool
+ConfFileProcessor::processConfSectionAdmission(const ConfigSection& section)
+{
+  ConfigurationVariable<uint32_t> shedLag("shed-lag",
+                                          std::bind(&ConfParameter::setAdmissionShedLag,
+                                                    &m_confParam, _1));
+  shedLag.setMinAndMaxValue(ADMISSION_SHED_LAG_MIN, ADMISSION_SHED_LAG_MAX);
+  shedLag.setOptional(ADMISSION_SHED_LAG_DEFAULT);
+
+  ConfigurationVariable<uint32_t> sourceRate("per-source-rate",
+                                             std::bind(&ConfParameter::setAdmissionSourceRate,
+                                                       &m_confParam, _1));
+  sourceRate.setMinAndMaxValue(ADMISSION_SOURCE_RATE_MIN, ADMISSION_SOURCE_RATE_MAX);
+  sourceRate.setOptional(ADMISSION_SOURCE_RATE_DEFAULT);
+
+  ConfigurationVariable<uint32_t> sourceBurst("per-source-burst",
+                                              std::bind(&ConfParameter::setAdmissionSourceBurst,
+                                                        &m_confParam, _1));
+  sourceBurst.setMinAndMaxValue(ADMISSION_SOURCE_BURST_MIN, ADMISSION_SOURCE_BURST_MAX);
+  sourceBurst.setOptional(ADMISSION_SOURCE_BURST_DEFAULT);
+
+  ConfigurationVariable<uint32_t> maxQueueLength("max-queue-length",
+                                                 std::bind(&ConfParameter::setAdmissionMaxQueueLength,
+                                                           &m_confParam, _1));
+  maxQueueLength.setMinAndMaxValue(ADMISSION_MAX_QUEUE_LENGTH_MIN, ADMISSION_MAX_QUEUE_LENGTH_MAX);
+  maxQueueLength.setOptional(ADMISSION_MAX_QUEUE_LENGTH_DEFAULT);
+
+  return shedLag.parseFromConfigSection(section) &&
+         sourceRate.parseFromConfigSection(section) &&
+         sourceBurst.parseFromConfigSection(section) &&
+         maxQueueLength.parseFromConfigSection(section);
+}
+
+bool
+ConfFileProcessor::processConfSectionReadvertise(const ConfigSection& section)
+{
+  ConfigurationVariable<uint32_t> holdDown("hold-down",
+                                           std::bind(&ConfParameter::setReadvertiseHoldDown,
+                                                     &m_confParam, _1));
+  holdDown.setMinAndMaxValue(READVERTISE_HOLD_DOWN_MIN, READVERTISE_HOLD_DOWN_MAX);
+  holdDown.setOptional(READVERTISE_HOLD_DOWN_DEFAULT);
+
+  ConfigurationVariable<uint32_t> maxRate("max-changes-per-second",
+                                          std::bind(&ConfParameter::setReadvertiseMaxChangesPerSecond,
+                                                    &m_confParam, _1));
+  maxRate.setMinAndMaxValue(READVERTISE_MAX_CHANGES_PER_SECOND_MIN,
+                            READVERTISE_MAX_CHANGES_PER_SECOND_MAX);
+  maxRate.setOptional(READVERTISE_MAX_CHANGES_PER_SECOND_DEFAULT);
+
+  if (!holdDown.parseFromConfigSection(section) || !maxRate.parseFromConfigSection(section)) {
+    return false;
+  }
+
+  for (const auto& tn : section) {
+    if (tn.first == "aggregate") {
+      try {
+        ndn::Name aggregate(tn.second.data());
+        if (aggregate.empty()) {
+          std::cerr << "Wrong command format! [aggregate /name/prefix] or bad URI" << std::endl;
+          return false;
+        }
+        m_confParam.getReadvertiseAggregates().push_back(aggregate);
+      }
+      catch (const std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool
+ConfFileProcessor::processConfSectionTopologies(const ConfigSection& section)
+{
+  if (m_confParam.getHyperbolicState() != HYPERBOLIC_STATE_OFF) {
+    std::cerr << "Topologies cannot be used together with hyperbolic routing" << std::endl;
+    return false;
+  }
+
+  for (const auto& tn : section) {
+    if (tn.first != "topology") {
+      continue;
+    }
+
+    Topology topology;
+    topology.name = tn.second.get<std::string>("name", "");
+    if (!isValidIdentifier(topology.name)) {
+      std::cerr << "Invalid topology name '" << topology.name << "'. "
+                << "Topology names consist of letters, digits, '-' and '_'" << std::endl;
+      return false;
+    }
+    for (const auto& configured : m_confParam.getTopologies()) {
+      if (configured.name == topology.name) {
+        std::cerr << "Topology " << topology.name << " is configured more than once" << std::endl;
+        return false;
+      }
+    }
+
+    std::string metric = tn.second.get<std::string>("metric", "link-cost");
+    if (metric == "link-cost") {
+      topology.metric = TopologyMetric::LINK_COST;
+    }
+    else if (metric == "hop-count") {
+      topology.metric = TopologyMetric::HOP_COUNT;
+    }
+    else {
+      std::cerr << "Invalid metric for topology " << topology.name << ": " << metric
+                << ". Valid values: link-cost, hop-count" << std::endl;
+      return false;
+    }
+
+    for (const auto& attr : tn.second) {
+      if (attr.first != "prefix") {
+        continue;
+      }
+      try {
+        ndn::Name prefix(attr.second.data());
+        if (prefix.empty()) {
+          std::cerr << "Wrong command format! [prefix /name/prefix] or bad URI" << std::endl;
+          return false;
+        }
+        topology.prefixes.push_back(prefix);
+      }
+      catch (const std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return false;
+      }
+    }
+    m_confParam.addTopology(topology);
+  }
+  return true;
+}
+
 } // namespace nlsr
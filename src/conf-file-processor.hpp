@@ -55,6 +55,16 @@ public:
   bool
   processConfFile();
 
+  /*! \brief Parse the configuration file into a ConfParameter that is not in use yet.
+   *
+   * Unlike processConfFile(), the dynamic configuration file in the state directory is
+   * left untouched, since the running NLSR keeps its runtime changes there.
+   *
+   * \return Whether the configuration file is valid.
+   */
+  bool
+  processConfFileForReload();
+
 private:
   /*! \brief Parse the configuration file into a tree and process the nodes.
    *
@@ -113,6 +123,26 @@ private:
   bool
   processConfSectionSecurity(const ConfigSection& section);
 
+  /*! \brief Configure where NLSR exports its metrics in the Prometheus text format.
+   */
+  bool
+  processConfSectionMetrics(const ConfigSection& section);
+
+  /*! \brief Set the shedding threshold, rate limits and queue lengths of admission control.
+   */
+  bool
+  processConfSectionAdmission(const ConfigSection& section);
+
+  /*! \brief Set the hold-down, rate limit and aggregation of prefixes readvertised from NFD.
+   */
+  bool
+  processConfSectionReadvertise(const ConfigSection& section);
+
+  /*! \brief Configure the routing topologies computed in addition to the default one.
+   */
+  bool
+  processConfSectionTopologies(const ConfigSection& section);
+
 private:
   /*! m_confFileName The full path of the configuration file to parse. */
   std::string m_confFileName;
@@ -120,6 +150,8 @@ private:
   ConfParameter& m_confParam;
   /*! m_io For canonization of FaceUri. */
   boost::asio::io_context m_io;
+  /*! m_isReload Whether the state directory must be left untouched. */
+  bool m_isReload = false;
 };
 
 } // namespace nlsr
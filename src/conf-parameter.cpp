@@ -68,6 +68,10 @@ ConfParameter::writeLog()
   NLSR_LOG_INFO("Router Prefix: " << m_routerPrefix);
   NLSR_LOG_INFO("Sync Prefix: " << m_syncPrefix);
   NLSR_LOG_INFO("Sync LSA prefix: " << m_lsaPrefix);
+  NLSR_LOG_INFO("LSA encoding: " << (m_isLsaEncodingCompact ? "compact" : "full"));
+  for (const auto& area : m_areas) {
+    NLSR_LOG_INFO("Area: " << area);
+  }
   NLSR_LOG_INFO("Hello Interest retry number: " << m_interestRetryNumber);
   NLSR_LOG_INFO("Hello Interest resend second: " << m_interestResendTime);
   NLSR_LOG_INFO("Info Interest interval: " << m_infoInterestInterval);
@@ -90,6 +94,31 @@ ConfParameter::writeLog()
   NLSR_LOG_INFO("Adjacency LSA build interval:  " << m_adjLsaBuildInterval);
   NLSR_LOG_INFO("Routing calculation interval:  " << m_routingCalcInterval);
 
+  if (!m_metricsFile.empty()) {
+    NLSR_LOG_INFO("Metrics file: " << m_metricsFile << " (every " << m_metricsFileInterval << ")");
+  }
+  if (!m_metricsSocket.empty()) {
+    NLSR_LOG_INFO("Metrics socket: " << m_metricsSocket);
+  }
+  NLSR_LOG_INFO("Event-loop heartbeat: " << m_eventLoopHeartbeat);
+  NLSR_LOG_INFO("Slow handler threshold: " << m_slowHandlerThreshold);
+  NLSR_LOG_INFO("Admission shed lag: " << m_admissionShedLag);
+  NLSR_LOG_INFO("Admission per-source rate: " << m_admissionSourceRate);
+  NLSR_LOG_INFO("Admission per-source burst: " << m_admissionSourceBurst);
+  NLSR_LOG_INFO("Admission max queue length: " << m_admissionMaxQueueLength);
+  NLSR_LOG_INFO("Readvertise hold-down: " << m_readvertiseHoldDown);
+  NLSR_LOG_INFO("Readvertise max changes per second: " << m_readvertiseMaxChangesPerSecond);
+  for (const auto& aggregate : m_readvertiseAggregates) {
+    NLSR_LOG_INFO("Readvertise aggregate: " << aggregate);
+  }
+  for (const auto& topology : m_topologies) {
+    NLSR_LOG_INFO("Topology " << topology.name << ": " <<
+                  (topology.metric == TopologyMetric::HOP_COUNT ? "hop-count" : "link-cost"));
+    for (const auto& prefix : topology.prefixes) {
+      NLSR_LOG_INFO("Topology " << topology.name << " prefix: " << prefix);
+    }
+  }
+
   // ✅ 添加这一行：
   NLSR_LOG_INFO("Load-aware routing: " << (m_loadAwareRouting ? "enabled" : "disabled"));
   // ✅ 添加这一行：关于机器学习负载
@@ -113,6 +142,11 @@ ConfParameter::setNetwork(const ndn::Name& networkName)
   m_lsaPrefix.append(m_network);
   m_lsaPrefix.append("nlsr");
   m_lsaPrefix.append("LSA");
+
+  m_helloPrefix.append("localhop");
+  m_helloPrefix.append(m_network);
+  m_helloPrefix.append("nlsr");
+  m_helloPrefix.append("HELLO");
 }
 
 void
@@ -26,6 +26,7 @@
 #include "test-access-control.hpp"
 #include "adjacency-list.hpp"
 #include "name-prefix-list.hpp"
+#include "topology.hpp"
 
 #include <ndn-cxx/face.hpp>
 #include <ndn-cxx/security/validator-config.hpp>
@@ -115,6 +116,60 @@ enum {
   SYNC_INTEREST_LIFETIME_MAX = 120000,
 };
 
+enum {
+  METRICS_FILE_INTERVAL_MIN = 1,
+  METRICS_FILE_INTERVAL_DEFAULT = 15,
+  METRICS_FILE_INTERVAL_MAX = 3600,
+};
+
+enum {
+  EVENT_LOOP_HEARTBEAT_MIN = 10,
+  EVENT_LOOP_HEARTBEAT_DEFAULT = 100,
+  EVENT_LOOP_HEARTBEAT_MAX = 10000,
+};
+
+enum {
+  SLOW_HANDLER_THRESHOLD_MIN = 1,
+  SLOW_HANDLER_THRESHOLD_DEFAULT = 50,
+  SLOW_HANDLER_THRESHOLD_MAX = 60000,
+};
+
+enum {
+  ADMISSION_SHED_LAG_MIN = 0,
+  ADMISSION_SHED_LAG_DEFAULT = 200,
+  ADMISSION_SHED_LAG_MAX = 60000,
+};
+
+enum {
+  ADMISSION_SOURCE_RATE_MIN = 0,
+  ADMISSION_SOURCE_RATE_DEFAULT = 100,
+  ADMISSION_SOURCE_RATE_MAX = 100000,
+};
+
+enum {
+  ADMISSION_SOURCE_BURST_MIN = 1,
+  ADMISSION_SOURCE_BURST_DEFAULT = 500,
+  ADMISSION_SOURCE_BURST_MAX = 100000,
+};
+
+enum {
+  ADMISSION_MAX_QUEUE_LENGTH_MIN = 1,
+  ADMISSION_MAX_QUEUE_LENGTH_DEFAULT = 1000,
+  ADMISSION_MAX_QUEUE_LENGTH_MAX = 100000,
+};
+
+enum {
+  READVERTISE_HOLD_DOWN_MIN = 0,
+  READVERTISE_HOLD_DOWN_DEFAULT = 0,
+  READVERTISE_HOLD_DOWN_MAX = 3600,
+};
+
+enum {
+  READVERTISE_MAX_CHANGES_PER_SECOND_MIN = 0,
+  READVERTISE_MAX_CHANGES_PER_SECOND_DEFAULT = 0,
+  READVERTISE_MAX_CHANGES_PER_SECOND_MAX = 10000,
+};
+
 /*! \brief A class to house all the configuration parameters for NLSR.
  *
  * This class is conceptually a singleton (but not mechanically) which
@@ -207,6 +262,38 @@ public:
     return m_lsaPrefix;
   }
 
+  /*! \brief Returns the prefix of the Hello Interests multicast on shared segments.
+   */
+  const ndn::Name&
+  getHelloPrefix() const
+  {
+    return m_helloPrefix;
+  }
+
+  /*! \brief Returns the areas this router is attached to, in configuration order.
+   *
+   * An empty list means that the network is not divided into areas.
+   */
+  const std::vector<std::string>&
+  getAreas() const
+  {
+    return m_areas;
+  }
+
+  void
+  addArea(const std::string& area)
+  {
+    m_areas.push_back(area);
+  }
+
+  /*! \brief Returns whether this router summarizes its areas into each other.
+   */
+  bool
+  isAreaBorderRouter() const
+  {
+    return m_areas.size() > 1;
+  }
+
   void
   setLsaRefreshTime(uint32_t lrt)
   {
@@ -225,6 +312,34 @@ public:
     m_syncProtocol = syncProtocol;
   }
 
+  /*! \brief Whether this router originates its Name and Adjacency LSAs in the compact encoding.
+   */
+  bool
+  isLsaEncodingCompact() const
+  {
+    return m_isLsaEncodingCompact;
+  }
+
+  void
+  setLsaEncodingCompact(bool isCompact)
+  {
+    m_isLsaEncodingCompact = isCompact;
+  }
+
+  /*! \brief Whether this router is a stub that other routers must not route through.
+   */
+  bool
+  isNoTransit() const
+  {
+    return m_isNoTransit;
+  }
+
+  void
+  setNoTransit(bool isNoTransit)
+  {
+    m_isNoTransit = isNoTransit;
+  }
+
   uint32_t
   getLsaRefreshTime() const
   {
@@ -427,18 +542,195 @@ public:
     return m_syncInterestLifetime;
   }
 
+  void
+  setMetricsFile(const std::string& path)
+  {
+    m_metricsFile = path;
+  }
+
+  const std::string&
+  getMetricsFile() const
+  {
+    return m_metricsFile;
+  }
+
+  void
+  setMetricsFileInterval(uint32_t interval)
+  {
+    m_metricsFileInterval = ndn::time::seconds(interval);
+  }
+
+  const ndn::time::seconds&
+  getMetricsFileInterval() const
+  {
+    return m_metricsFileInterval;
+  }
+
+  void
+  setMetricsSocket(const std::string& path)
+  {
+    m_metricsSocket = path;
+  }
+
+  const std::string&
+  getMetricsSocket() const
+  {
+    return m_metricsSocket;
+  }
+
+  void
+  setEventLoopHeartbeat(uint32_t heartbeat)
+  {
+    m_eventLoopHeartbeat = ndn::time::milliseconds(heartbeat);
+  }
+
+  const ndn::time::milliseconds&
+  getEventLoopHeartbeat() const
+  {
+    return m_eventLoopHeartbeat;
+  }
+
+  void
+  setSlowHandlerThreshold(uint32_t threshold)
+  {
+    m_slowHandlerThreshold = ndn::time::milliseconds(threshold);
+  }
+
+  const ndn::time::milliseconds&
+  getSlowHandlerThreshold() const
+  {
+    return m_slowHandlerThreshold;
+  }
+
+  /*! \brief Event-loop lag above which dataset Interests are shed; LSA Interests
+   *         are shed above twice this lag. Zero disables shedding.
+   */
+  void
+  setAdmissionShedLag(uint32_t lag)
+  {
+    m_admissionShedLag = ndn::time::milliseconds(lag);
+  }
+
+  const ndn::time::milliseconds&
+  getAdmissionShedLag() const
+  {
+    return m_admissionShedLag;
+  }
+
+  /*! \brief Interests per second admitted from each incoming face. Zero disables the limit.
+   */
+  void
+  setAdmissionSourceRate(uint32_t rate)
+  {
+    m_admissionSourceRate = rate;
+  }
+
+  uint32_t
+  getAdmissionSourceRate() const
+  {
+    return m_admissionSourceRate;
+  }
+
+  void
+  setAdmissionSourceBurst(uint32_t burst)
+  {
+    m_admissionSourceBurst = burst;
+  }
+
+  uint32_t
+  getAdmissionSourceBurst() const
+  {
+    return m_admissionSourceBurst;
+  }
+
+  void
+  setAdmissionMaxQueueLength(uint32_t length)
+  {
+    m_admissionMaxQueueLength = length;
+  }
+
+  uint32_t
+  getAdmissionMaxQueueLength() const
+  {
+    return m_admissionMaxQueueLength;
+  }
+
+  void
+  setReadvertiseHoldDown(uint32_t holdDown)
+  {
+    m_readvertiseHoldDown = ndn::time::seconds(holdDown);
+  }
+
+  const ndn::time::seconds&
+  getReadvertiseHoldDown() const
+  {
+    return m_readvertiseHoldDown;
+  }
+
+  void
+  setReadvertiseMaxChangesPerSecond(uint32_t rate)
+  {
+    m_readvertiseMaxChangesPerSecond = rate;
+  }
+
+  uint32_t
+  getReadvertiseMaxChangesPerSecond() const
+  {
+    return m_readvertiseMaxChangesPerSecond;
+  }
+
+  /*! \brief Covering prefixes under which readvertised prefixes are aggregated.
+   */
+  std::vector<ndn::Name>&
+  getReadvertiseAggregates()
+  {
+    return m_readvertiseAggregates;
+  }
+
+  const std::vector<ndn::Name>&
+  getReadvertiseAggregates() const
+  {
+    return m_readvertiseAggregates;
+  }
+
+  /*! \brief Routing topologies computed in addition to the default one.
+   */
+  const std::vector<Topology>&
+  getTopologies() const
+  {
+    return m_topologies;
+  }
+
+  void
+  addTopology(const Topology& topology)
+  {
+    m_topologies.push_back(topology);
+  }
+
   AdjacencyList&
   getAdjacencyList()
   {
     return m_adjl;
   }
 
+  const AdjacencyList&
+  getAdjacencyList() const
+  {
+    return m_adjl;
+  }
+
   NamePrefixList&
   getNamePrefixList()
   {
     return m_npl;
   }
 
+  const NamePrefixList&
+  getNamePrefixList() const
+  {
+    return m_npl;
+  }
+
   ndn::security::ValidatorConfig&
   getValidator()
   {
@@ -519,6 +811,8 @@ private:
 
   ndn::Name m_syncPrefix;
   ndn::Name m_lsaPrefix;
+  ndn::Name m_helloPrefix;
+  std::vector<std::string> m_areas;
 
   uint32_t  m_lsaRefreshTime;
 
@@ -547,6 +841,25 @@ private:
   ndn::time::milliseconds m_syncInterestLifetime;
 
   SyncProtocol m_syncProtocol = SyncProtocol::PSYNC;
+  bool m_isLsaEncodingCompact = false;
+  bool m_isNoTransit = false;
+
+  std::string m_metricsFile;
+  ndn::time::seconds m_metricsFileInterval{METRICS_FILE_INTERVAL_DEFAULT};
+  std::string m_metricsSocket;
+  ndn::time::milliseconds m_eventLoopHeartbeat{EVENT_LOOP_HEARTBEAT_DEFAULT};
+  ndn::time::milliseconds m_slowHandlerThreshold{SLOW_HANDLER_THRESHOLD_DEFAULT};
+
+  ndn::time::milliseconds m_admissionShedLag{ADMISSION_SHED_LAG_DEFAULT};
+  uint32_t m_admissionSourceRate = ADMISSION_SOURCE_RATE_DEFAULT;
+  uint32_t m_admissionSourceBurst = ADMISSION_SOURCE_BURST_DEFAULT;
+  uint32_t m_admissionMaxQueueLength = ADMISSION_MAX_QUEUE_LENGTH_DEFAULT;
+
+  ndn::time::seconds m_readvertiseHoldDown{READVERTISE_HOLD_DOWN_DEFAULT};
+  uint32_t m_readvertiseMaxChangesPerSecond = READVERTISE_MAX_CHANGES_PER_SECOND_DEFAULT;
+  std::vector<ndn::Name> m_readvertiseAggregates;
+
+  std::vector<Topology> m_topologies;
 
   //新增感知负载配置部分
   bool m_loadAwareRouting = false;  // 默认关闭
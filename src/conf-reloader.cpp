@@ -0,0 +1,166 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "conf-reloader.hpp"
+
+namespace nlsr {
+
+bool
+ConfReloader::Diff::empty() const
+{
+  return addedNeighbors.empty() && removedNeighbors.empty() && changedNeighbors.empty() &&
+         addedPrefixes.empty() && removedPrefixes.empty() && !areTimersChanged;
+}
+
+ConfReloader::ConfReloader(ConfParameter& running)
+  : m_running(running)
+  , m_configuredNeighbors(running.getAdjacencyList())
+  , m_configuredPrefixes(running.getNamePrefixList())
+{
+}
+
+ConfReloader::Diff
+ConfReloader::computeDiff(const ConfParameter& candidate) const
+{
+  Diff diff;
+
+  const AdjacencyList& neighbors = candidate.getAdjacencyList();
+  for (const auto& adjacent : neighbors.getAdjList()) {
+    if (!m_configuredNeighbors.isNeighbor(adjacent.getName())) {
+      diff.addedNeighbors.push_back(adjacent);
+      continue;
+    }
+    Adjacent configured = m_configuredNeighbors.getAdjacent(adjacent.getName());
+    if (configured.getFaceUri() != adjacent.getFaceUri() ||
+        configured.getHelloFaceUri() != adjacent.getHelloFaceUri()) {
+      // a neighbor reached through another face starts over, as if it were new
+      diff.removedNeighbors.push_back(adjacent.getName());
+      diff.addedNeighbors.push_back(adjacent);
+    }
+    else if (configured.getLinkCost() != adjacent.getLinkCost() ||
+             configured.getTopologyCosts() != adjacent.getTopologyCosts()) {
+      diff.changedNeighbors.push_back(adjacent);
+    }
+  }
+  for (const auto& adjacent : m_configuredNeighbors.getAdjList()) {
+    if (!neighbors.isNeighbor(adjacent.getName())) {
+      diff.removedNeighbors.push_back(adjacent.getName());
+    }
+  }
+
+  // both lists are sorted by name, so one merge pass finds the differences
+  const auto& before = m_configuredPrefixes.getPrefixInfo();
+  const auto& after = candidate.getNamePrefixList().getPrefixInfo();
+  auto i = before.begin();
+  auto j = after.begin();
+  while (i != before.end() || j != after.end()) {
+    int order = i == before.end() ? 1 :
+                j == after.end() ? -1 :
+                i->getName().compare(j->getName());
+    if (order < 0) {
+      diff.removedPrefixes.push_back((i++)->getName());
+    }
+    else if (order > 0) {
+      diff.addedPrefixes.push_back((j++)->getName());
+    }
+    else {
+      ++i;
+      ++j;
+    }
+  }
+
+  const ConfParameter& running = m_running;
+  diff.areTimersChanged =
+    running.getLsaRefreshTime() != candidate.getLsaRefreshTime() ||
+    running.getRouterDeadInterval() != candidate.getRouterDeadInterval() ||
+    running.getLsaInterestLifetime() != candidate.getLsaInterestLifetime() ||
+    running.getAdjLsaBuildInterval() != candidate.getAdjLsaBuildInterval() ||
+    running.getRoutingCalcInterval() != candidate.getRoutingCalcInterval() ||
+    running.getFaceDatasetFetchTries() != candidate.getFaceDatasetFetchTries() ||
+    running.getFaceDatasetFetchInterval() != candidate.getFaceDatasetFetchInterval() ||
+    running.getInterestRetryNumber() != candidate.getInterestRetryNumber() ||
+    running.getInterestResendTime() != candidate.getInterestResendTime() ||
+    running.getInfoInterestInterval() != candidate.getInfoInterestInterval() ||
+    running.getMaxFacesPerPrefix() != candidate.getMaxFacesPerPrefix() ||
+    running.getReadvertiseHoldDown() != candidate.getReadvertiseHoldDown() ||
+    running.getReadvertiseMaxChangesPerSecond() != candidate.getReadvertiseMaxChangesPerSecond();
+
+  auto ignoreIf = [&diff] (bool isChanged, const char* option) {
+    if (isChanged) {
+      diff.ignoredOptions.emplace_back(option);
+    }
+  };
+  ignoreIf(running.getRouterPrefix() != candidate.getRouterPrefix(), "general.router");
+  ignoreIf(running.getSyncProtocol() != candidate.getSyncProtocol(), "general.sync-protocol");
+  ignoreIf(running.getSyncInterestLifetime() != candidate.getSyncInterestLifetime(),
+           "general.sync-interest-lifetime");
+  ignoreIf(running.isLsaEncodingCompact() != candidate.isLsaEncodingCompact(),
+           "general.lsa-encoding");
+  ignoreIf(running.isNoTransit() != candidate.isNoTransit(), "neighbors.no-transit");
+  ignoreIf(running.getStateFileDir() != candidate.getStateFileDir(), "general.state-dir");
+  ignoreIf(running.getAreas() != candidate.getAreas(), "general.area");
+  ignoreIf(running.getLoadAwareRouting() != candidate.getLoadAwareRouting(),
+           "general.load-aware-routing");
+  ignoreIf(running.getMLAdaptiveRouting() != candidate.getMLAdaptiveRouting(),
+           "general.ml-adaptive-routing");
+  ignoreIf(running.getHyperbolicState() != candidate.getHyperbolicState() ||
+           running.getCorR() != candidate.getCorR() ||
+           running.getCorTheta() != candidate.getCorTheta(), "hyperbolic");
+  ignoreIf(running.getIdCerts() != candidate.getIdCerts(), "security");
+  ignoreIf(running.getMetricsFile() != candidate.getMetricsFile() ||
+           running.getMetricsFileInterval() != candidate.getMetricsFileInterval() ||
+           running.getMetricsSocket() != candidate.getMetricsSocket() ||
+           running.getEventLoopHeartbeat() != candidate.getEventLoopHeartbeat() ||
+           running.getSlowHandlerThreshold() != candidate.getSlowHandlerThreshold(), "metrics");
+  ignoreIf(running.getAdmissionShedLag() != candidate.getAdmissionShedLag() ||
+           running.getAdmissionSourceRate() != candidate.getAdmissionSourceRate() ||
+           running.getAdmissionSourceBurst() != candidate.getAdmissionSourceBurst() ||
+           running.getAdmissionMaxQueueLength() != candidate.getAdmissionMaxQueueLength(),
+           "admission");
+  ignoreIf(running.getReadvertiseAggregates() != candidate.getReadvertiseAggregates(),
+           "readvertise.aggregate");
+  ignoreIf(running.getTopologies() != candidate.getTopologies(), "topologies");
+
+  return diff;
+}
+
+void
+ConfReloader::commit(const ConfParameter& candidate)
+{
+  m_running.setLsaRefreshTime(candidate.getLsaRefreshTime());
+  m_running.setRouterDeadInterval(candidate.getRouterDeadInterval());
+  m_running.setLsaInterestLifetime(candidate.getLsaInterestLifetime());
+  m_running.setAdjLsaBuildInterval(candidate.getAdjLsaBuildInterval());
+  m_running.setRoutingCalcInterval(candidate.getRoutingCalcInterval());
+  m_running.setFaceDatasetFetchTries(candidate.getFaceDatasetFetchTries());
+  m_running.setFaceDatasetFetchInterval(candidate.getFaceDatasetFetchInterval().count());
+  m_running.setInterestRetryNumber(candidate.getInterestRetryNumber());
+  m_running.setInterestResendTime(candidate.getInterestResendTime());
+  m_running.setInfoInterestInterval(candidate.getInfoInterestInterval());
+  m_running.setMaxFacesPerPrefix(candidate.getMaxFacesPerPrefix());
+  m_running.setReadvertiseHoldDown(candidate.getReadvertiseHoldDown().count());
+  m_running.setReadvertiseMaxChangesPerSecond(candidate.getReadvertiseMaxChangesPerSecond());
+
+  m_configuredNeighbors = candidate.getAdjacencyList();
+  m_configuredPrefixes = candidate.getNamePrefixList();
+}
+
+} // namespace nlsr
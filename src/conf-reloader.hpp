@@ -0,0 +1,88 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_CONF_RELOADER_HPP
+#define NLSR_CONF_RELOADER_HPP
+
+#include "conf-parameter.hpp"
+
+#include <boost/noncopyable.hpp>
+
+namespace nlsr {
+
+/*! \brief Computes how a newly read configuration differs from the running one.
+ *
+ * Neighbors and advertised prefixes are compared with the ones last read from the
+ * configuration file, not with the live lists, since those also hold runtime state:
+ * prefixes advertised through nlsrc or readvertised from NFD, and link costs adjusted
+ * by the LinkCostManager or zeroed by hyperbolic routing.
+ *
+ * \sa Nlsr::reloadConfiguration
+ */
+class ConfReloader : boost::noncopyable
+{
+public:
+  struct Diff
+  {
+    /*! \brief Returns whether there is nothing to apply; ignored options do not count.
+     */
+    bool
+    empty() const;
+
+    std::vector<Adjacent> addedNeighbors;
+    std::vector<ndn::Name> removedNeighbors;
+    /// Neighbors whose configured link cost or topology costs changed, with their new costs
+    std::vector<Adjacent> changedNeighbors;
+    std::vector<ndn::Name> addedPrefixes;
+    std::vector<ndn::Name> removedPrefixes;
+    /// Whether a timer or limit that can be changed at runtime differs
+    bool areTimersChanged = false;
+    /// Options that differ but only take effect after a restart
+    std::vector<std::string> ignoredOptions;
+  };
+
+  /*! \param running The configuration in use; its neighbors and advertised prefixes
+   *                 are recorded as the configured ones.
+   */
+  explicit
+  ConfReloader(ConfParameter& running);
+
+  Diff
+  computeDiff(const ConfParameter& candidate) const;
+
+  /*! \brief Copies the timers and limits of \p candidate into the running configuration,
+   *         and records its neighbors and prefixes as the configured ones.
+   *
+   * The neighbor and prefix lists of the running configuration are left to the caller,
+   * which applies the Diff to them.
+   */
+  void
+  commit(const ConfParameter& candidate);
+
+private:
+  ConfParameter& m_running;
+  AdjacencyList m_configuredNeighbors;
+  NamePrefixList m_configuredPrefixes;
+};
+
+} // namespace nlsr
+
+#endif // NLSR_CONF_RELOADER_HPP
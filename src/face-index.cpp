@@ -0,0 +1,68 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face-index.hpp"
+
+namespace nlsr {
+
+void
+FaceIndex::reset(const std::vector<ndn::nfd::FaceStatus>& faces)
+{
+  m_idByUri.clear();
+  m_uriById.clear();
+  m_idByUri.reserve(faces.size());
+  m_uriById.reserve(faces.size());
+  for (const auto& faceStatus : faces) {
+    insert(faceStatus.getRemoteUri(), faceStatus.getFaceId());
+  }
+}
+
+void
+FaceIndex::insert(const std::string& remoteUri, uint64_t faceId)
+{
+  erase(faceId);
+  // if several faces share a remote URI, the most recent one wins
+  m_idByUri[remoteUri] = faceId;
+  m_uriById.emplace(faceId, remoteUri);
+}
+
+void
+FaceIndex::erase(uint64_t faceId)
+{
+  auto it = m_uriById.find(faceId);
+  if (it == m_uriById.end()) {
+    return;
+  }
+  auto byUri = m_idByUri.find(it->second);
+  if (byUri != m_idByUri.end() && byUri->second == faceId) {
+    m_idByUri.erase(byUri);
+  }
+  m_uriById.erase(it);
+}
+
+uint64_t
+FaceIndex::getFaceId(const std::string& remoteUri) const
+{
+  auto it = m_idByUri.find(remoteUri);
+  return it != m_idByUri.end() ? it->second : 0;
+}
+
+} // namespace nlsr
@@ -0,0 +1,79 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_FACE_INDEX_HPP
+#define NLSR_FACE_INDEX_HPP
+
+#include "common.hpp"
+
+#include <ndn-cxx/mgmt/nfd/face-status.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace nlsr {
+
+/*! \brief Maps the remote FaceUri of every face of the local forwarder to its Face ID.
+ *
+ * The index is filled from a FaceStatus dataset and then kept up to date with
+ * face event notifications, so that a face can be found without fetching the
+ * whole dataset again.
+ */
+class FaceIndex
+{
+public:
+  /*! \brief Replaces the content of the index with the faces in \p faces.
+   */
+  void
+  reset(const std::vector<ndn::nfd::FaceStatus>& faces);
+
+  void
+  insert(const std::string& remoteUri, uint64_t faceId);
+
+  void
+  erase(uint64_t faceId);
+
+  /*! \return the ID of the face with remote URI \p remoteUri, or 0 if there is none
+   */
+  uint64_t
+  getFaceId(const std::string& remoteUri) const;
+
+  bool
+  contains(uint64_t faceId) const
+  {
+    return m_uriById.count(faceId) > 0;
+  }
+
+  size_t
+  size() const
+  {
+    return m_uriById.size();
+  }
+
+private:
+  std::unordered_map<std::string, uint64_t> m_idByUri;
+  std::unordered_map<uint64_t, std::string> m_uriById;
+};
+
+} // namespace nlsr
+
+#endif // NLSR_FACE_INDEX_HPP
@@ -19,20 +19,39 @@
  */
 
  #include "hello-protocol.hpp"
+ #include "admission-controller.hpp"
  #include "nlsr.hpp"
  #include "lsdb.hpp"
  #include "logger.hpp"
+ #include "metrics/event-loop-monitor.hpp"
+ #include "metrics/metrics-registry.hpp"
+ #include "metrics/startup-timeline.hpp"
+ #include "trace.hpp"
  #include "utility/name-helper.hpp"
  
  #include <ndn-cxx/encoding/nfd-constants.hpp>
+
+ #include <optional>
  
  namespace nlsr {
  
  INIT_LOGGER(HelloProtocol);
+
+ namespace {
+
+ auto& helloRtt = metrics::Registry::get().addHistogram("nlsr_hello_rtt_seconds",
+   "Round-trip time of Hello Interests answered by a neighbor");
+ auto& helloTimeouts = metrics::Registry::get().addCounter("nlsr_hello_timeouts_total",
+   "Hello Interests that timed out");
+ auto& helloValidationDuration = metrics::Registry::get().addHistogram("nlsr_validation_duration_seconds",
+   "Time spent validating received Data", "kind=\"hello\"");
+
+ } // namespace
  
  HelloProtocol::HelloProtocol(ndn::Face& face, ndn::KeyChain& keyChain,
                               ConfParameter& confParam, RoutingTable& routingTable,
-                              Lsdb& lsdb, Nlsr& nlsr)
+                              Lsdb& lsdb, Statistics& stats, Nlsr& nlsr,
+                              AdmissionController& admission)
    : m_face(face)
    , m_scheduler(m_face.getIoContext())
    , m_keyChain(keyChain)
@@ -40,8 +59,10 @@
    , m_confParam(confParam)
    , m_routingTable(routingTable)
    , m_lsdb(lsdb)
+   , m_stats(stats)
    , m_adjacencyList(m_confParam.getAdjacencyList())
    , m_nlsr(nlsr)
+   , m_admission(admission)
  {
    ndn::Name name(m_confParam.getRouterPrefix());
    name.append(NLSR_COMPONENT);
@@ -50,9 +71,9 @@
    NLSR_LOG_DEBUG("Setting interest filter for Hello interest: " << name);
  
    m_face.setInterestFilter(ndn::InterestFilter(name).allowLoopback(false),
-     [this] (const auto& name, const auto& interest) {
+     admission.wrap(AdmissionClass::HELLO, [this] (const auto& name, const auto& interest) {
        processInterest(name, interest);
-     },
+     }),
      [] (const auto& name) {
        NLSR_LOG_DEBUG("Successfully registered prefix: " << name);
      },
@@ -77,7 +98,17 @@
   onInterestSent(neighbor);
  
    m_face.expressInterest(interest,
-     std::bind(&HelloProtocol::onContent, this, _1, _2),
+     [this, neighbor, sent = ndn::time::steady_clock::now()] (const auto& interest, const auto& data) {
+       auto rtt = ndn::time::steady_clock::now() - sent;
+       helloRtt.record(rtt);
+       NLSR_TRACE(hello__received, neighbor.toUri().c_str(),
+                  ndn::time::duration_cast<ndn::time::microseconds>(rtt).count());
+       // The adjacency may have been removed while the Interest was pending
+       if (auto adjacent = m_adjacencyList.findAdjacent(neighbor); adjacent != m_adjacencyList.end()) {
+         adjacent->getTraffic().recordReceived(data.wireEncode().size());
+       }
+       onContent(interest, data);
+     },
      [this, seconds] (const auto& interest, const auto& nack) {
        NDN_LOG_TRACE("Received Nack with reason: " << nack.getReason());
        NDN_LOG_TRACE("Will treat as timeout in " << 2 * seconds << " seconds");
@@ -86,8 +117,12 @@
      },
      std::bind(&HelloProtocol::processInterestTimedOut, this, _1));
  
+   NLSR_TRACE(hello__sent, neighbor.toUri().c_str());
    // increment SENT_HELLO_INTEREST
-   hpIncrementSignal(Statistics::PacketType::SENT_HELLO_INTEREST);
+   m_stats.increment(Statistics::PacketType::SENT_HELLO_INTEREST);
+   if (auto adjacent = m_adjacencyList.findAdjacent(neighbor); adjacent != m_adjacencyList.end()) {
+     adjacent->getTraffic().recordSent(interest.wireEncode().size());
+   }
  }
  
  void
@@ -98,6 +133,11 @@
      return;
    }
  
+   // Neighbors on a shared segment are probed by the multicast Hello
+   if (adjacent->isHelloMulticast()) {
+     return;
+   }
+
    // If this adjacency has a Face, just proceed as usual.
    if(adjacent->getFaceId() != 0) {
      // interest name: /<neighbor>/NLSR/INFO/<router>
@@ -117,11 +157,12 @@
  HelloProtocol::processInterest(const ndn::Name& name,
                                 const ndn::Interest& interest)
  {
+   metrics::HandlerScope scope(metrics::HandlerTag::HELLO_PROTOCOL, "processInterest");
    // interest name: /<neighbor>/NLSR/INFO/<router>
    const ndn::Name interestName = interest.getName();
  
    // increment RCV_HELLO_INTEREST
-   hpIncrementSignal(Statistics::PacketType::RCV_HELLO_INTEREST);
+   m_stats.increment(Statistics::PacketType::RCV_HELLO_INTEREST);
  
    NLSR_LOG_DEBUG("Interest received for Name: " << interestName);
    if (interestName.get(-2).toUri() != INFO_COMPONENT) {
@@ -132,7 +173,10 @@
  
    ndn::Name neighbor(interestName.get(-1).blockFromValue());
    NLSR_LOG_DEBUG("Neighbor: " << neighbor);
-   if (m_adjacencyList.isNeighbor(neighbor)) {
+   auto adjacent = m_adjacencyList.findAdjacent(neighbor);
+   if (adjacent != m_adjacencyList.end()) {
+     adjacent->getTraffic().recordReceived(interest.wireEncode().size());
+
      auto data = std::make_shared<ndn::Data>();
      data->setName(ndn::Name(interest.getName()).appendVersion());
      // A Hello reply being cached longer than is needed to fufill an Interest
@@ -147,11 +191,11 @@
      NLSR_LOG_DEBUG("Sending out data for name: " << interest.getName());
      m_face.put(*data);
      // increment SENT_HELLO_DATA
-     hpIncrementSignal(Statistics::PacketType::SENT_HELLO_DATA);
-   
-     auto adjacent = m_adjacencyList.findAdjacent(neighbor);
+     m_stats.increment(Statistics::PacketType::SENT_HELLO_DATA);
+     adjacent->getTraffic().recordSent(data->wireEncode().size());
+
      // If this neighbor was previously inactive, send our own hello interest, too
-     if (adjacent->getStatus() == Adjacent::STATUS_INACTIVE) {
+     if (adjacent->getStatus() == Adjacent::STATUS_INACTIVE && !adjacent->isHelloMulticast()) {
        // We can only do that if the neighbor currently has a face.
        if (adjacent->getFaceId() != 0) {
          // interest name: /<neighbor>/NLSR/INFO/<router>
@@ -165,9 +209,178 @@
    }
  }
  
+ void
+ HelloProtocol::startMulticastHello()
+ {
+   // Once started, Hellos are sent on every multicast face with a route for the Hello prefix
+   if (m_multicastHelloEvent) {
+     return;
+   }
+
+   NLSR_LOG_DEBUG("Setting interest filter for multicast Hello: " << m_confParam.getHelloPrefix());
+   m_multicastHelloFilter = m_face.setInterestFilter(
+     ndn::InterestFilter(m_confParam.getHelloPrefix()).allowLoopback(false),
+     m_admission.wrap(AdmissionClass::HELLO, [this] (const auto&, const auto& interest) {
+       processMulticastHello(interest);
+     }),
+     [] (const auto& name) {
+       NLSR_LOG_DEBUG("Successfully registered prefix: " << name);
+     },
+     [] (const auto& name, const auto& resp) {
+       NLSR_LOG_ERROR("Failed to register prefix " << name << ": " << resp);
+     },
+     m_signingInfo);
+
+   sendMulticastHello();
+   m_multicastHelloEvent = m_scheduler.schedule(ndn::time::seconds(m_confParam.getInfoInterestInterval()),
+                                                [this] { onMulticastHelloInterval(); });
+ }
+
+ void
+ HelloProtocol::sendMulticastHello()
+ {
+   // data name: /<router>/NLSR/INFO/multicast/<version>, the form of a unicast Hello reply,
+   // so that neighbors validate it with the same rule
+   ndn::Name dataName(m_confParam.getRouterPrefix());
+   dataName.append(NLSR_COMPONENT);
+   dataName.append(INFO_COMPONENT);
+   dataName.append(MULTICAST_COMPONENT);
+   ndn::Data data(dataName.appendVersion());
+   data.setFreshnessPeriod(0_ms);
+   data.setContent(ndn::make_span(reinterpret_cast<const uint8_t*>(INFO_COMPONENT.data()),
+                                  INFO_COMPONENT.size()));
+   m_keyChain.sign(data, m_signingInfo);
+
+   ndn::Interest interest(m_confParam.getHelloPrefix());
+   interest.setApplicationParameters(data.wireEncode());
+   interest.setInterestLifetime(ndn::time::seconds(m_confParam.getInterestResendTime()));
+
+   NLSR_LOG_DEBUG("Sending multicast HELLO: " << data.getName());
+   // Neighbors do not answer with Data, each of them multicasts its own Hello instead
+   m_face.expressInterest(interest,
+                          [] (const auto&, const auto&) {},
+                          [] (const auto&, const auto&) {},
+                          [] (const auto&) {});
+   m_stats.increment(Statistics::PacketType::SENT_HELLO_INTEREST);
+ }
+
+ void
+ HelloProtocol::onMulticastHelloInterval()
+ {
+   metrics::HandlerScope scope(metrics::HandlerTag::HELLO_PROTOCOL, "onMulticastHelloInterval");
+
+   std::vector<ndn::Name> silent;
+   for (const auto& adjacent : m_adjacencyList.getAdjList()) {
+     if (adjacent.isHelloMulticast() && m_heardMulticastNeighbors.count(adjacent.getName()) == 0) {
+       silent.push_back(adjacent.getName());
+     }
+   }
+   m_heardMulticastNeighbors.clear();
+
+   bool isAdjacencyChanged = false;
+   bool isProbed = false;
+   for (const auto& neighbor : silent) {
+     helloTimeouts.increment();
+     m_adjacencyList.incrementTimedOutInterestCount(neighbor);
+     uint32_t missedIntervals = m_adjacencyList.getTimedOutInterestCount(neighbor);
+     NLSR_LOG_DEBUG("No multicast Hello from " << neighbor << " for " << missedIntervals << " interval(s)");
+     NLSR_TRACE(hello__timeout, neighbor.toUri().c_str(), missedIntervals);
+     onTimeout(neighbor, missedIntervals);
+
+     if (missedIntervals < m_confParam.getInterestRetryNumber()) {
+       continue;
+     }
+     if (m_adjacencyList.getStatusOfNeighbor(neighbor) == Adjacent::STATUS_ACTIVE) {
+       m_adjacencyList.setStatusOfNeighbor(neighbor, Adjacent::STATUS_INACTIVE);
+       NLSR_LOG_DEBUG("Neighbor: " << neighbor << " status changed to INACTIVE");
+       onNeighborStatusChanged(neighbor, Adjacent::STATUS_INACTIVE);
+       isAdjacencyChanged = true;
+     }
+     else {
+       isProbed = true;
+     }
+   }
+
+   if (isAdjacencyChanged) {
+     if (m_confParam.getHyperbolicState() == HYPERBOLIC_STATE_ON) {
+       m_routingTable.scheduleRoutingTableCalculation();
+     }
+     else {
+       m_lsdb.scheduleAdjLsaBuild();
+     }
+   }
+   if (isProbed) {
+     m_lsdb.onNeighborProbed();
+   }
+
+   sendMulticastHello();
+   m_multicastHelloEvent = m_scheduler.schedule(ndn::time::seconds(m_confParam.getInfoInterestInterval()),
+                                                [this] { onMulticastHelloInterval(); });
+ }
+
+ void
+ HelloProtocol::processMulticastHello(const ndn::Interest& interest)
+ {
+   metrics::HandlerScope scope(metrics::HandlerTag::HELLO_PROTOCOL, "processMulticastHello");
+   m_stats.increment(Statistics::PacketType::RCV_HELLO_INTEREST);
+
+   if (!interest.hasApplicationParameters()) {
+     NLSR_LOG_DEBUG("Multicast Hello " << interest.getName() << " carries no Data");
+     return;
+   }
+   std::optional<ndn::Data> data;
+   try {
+     data.emplace(interest.getApplicationParameters().blockFromValue());
+   }
+   catch (const ndn::tlv::Error& e) {
+     NLSR_LOG_DEBUG("Malformed multicast Hello: " << e.what());
+     return;
+   }
+
+   // data name: /<neighbor>/NLSR/INFO/multicast/<version>
+   const ndn::Name& dataName = data->getName();
+   if (dataName.size() < 4 || dataName.get(-3).toUri() != INFO_COMPONENT ||
+       dataName.get(-2).toUri() != MULTICAST_COMPONENT) {
+     NLSR_LOG_DEBUG("Unexpected multicast Hello Data: " << dataName);
+     return;
+   }
+   ndn::Name neighbor = dataName.getPrefix(-4);
+   auto adjacent = m_adjacencyList.findAdjacent(neighbor);
+   if (adjacent == m_adjacencyList.end() || !adjacent->isHelloMulticast()) {
+     NLSR_LOG_DEBUG("Ignoring multicast Hello of " << neighbor);
+     return;
+   }
+   adjacent->getTraffic().recordReceived(interest.wireEncode().size());
+   if (!isNewMulticastHello(neighbor, dataName.get(-1))) {
+     NLSR_LOG_DEBUG("Ignoring stale or replayed multicast Hello " << dataName);
+     return;
+   }
+
+   // A neighbor coming up learns about this router without waiting for the next interval.
+   // The replies to neighbors coming up together are aggregated into one Hello.
+   if (adjacent->getStatus() != Adjacent::STATUS_ACTIVE && !m_multicastReplyEvent) {
+     m_multicastReplyEvent = m_scheduler.schedule(0_s, [this] { sendMulticastHello(); });
+   }
+
+   onContent(interest, *data);
+ }
+
+ bool
+ HelloProtocol::isNewMulticastHello(const ndn::Name& neighbor,
+                                    const ndn::Name::Component& version) const
+ {
+   if (!version.isVersion()) {
+     return false;
+   }
+   auto it = m_multicastHelloVersions.find(neighbor);
+   return it == m_multicastHelloVersions.end() || version.toVersion() > it->second;
+ }
+
  void
  HelloProtocol::processInterestTimedOut(const ndn::Interest& interest)
  {
+   metrics::HandlerScope scope(metrics::HandlerTag::HELLO_PROTOCOL, "processInterestTimedOut");
+   helloTimeouts.increment();
    // interest name: /<neighbor>/NLSR/INFO/<router>
    const ndn::Name interestName(interest.getName());
    NLSR_LOG_DEBUG("Interest timed out for Name: " << interestName);
@@ -176,6 +389,10 @@
    }
    ndn::Name neighbor = interestName.getPrefix(-3);
    NLSR_LOG_DEBUG("Neighbor: " << neighbor);
+   if (!m_adjacencyList.isNeighbor(neighbor)) {
+     // removed by a configuration reload while the Interest was pending
+     return;
+   }
    m_adjacencyList.incrementTimedOutInterestCount(neighbor);
  
    Adjacent::Status status = m_adjacencyList.getStatusOfNeighbor(neighbor);
@@ -183,6 +400,7 @@
    uint32_t infoIntTimedOutCount = m_adjacencyList.getTimedOutInterestCount(neighbor);
    NLSR_LOG_DEBUG("Status: " << status);
    NLSR_LOG_DEBUG("Info Interest Timed out: " << infoIntTimedOutCount);
+   NLSR_TRACE(hello__timeout, neighbor.toUri().c_str(), infoIntTimedOutCount);
  
    // Emit signal for Hello timeout (Option A)
   onTimeout(neighbor, infoIntTimedOutCount);
@@ -198,7 +416,11 @@
      NLSR_LOG_DEBUG("Resending interest: " << interestName);
      expressInterest(interestName, m_confParam.getInterestResendTime());
    }
-   else if (status == Adjacent::STATUS_ACTIVE) {
+   else if (status != Adjacent::STATUS_ACTIVE) {
+     // A neighbor that never answered counts as probed once its retries are exhausted
+     m_lsdb.onNeighborProbed();
+   }
+   else {
      m_adjacencyList.setStatusOfNeighbor(neighbor, Adjacent::STATUS_INACTIVE);
  
      NLSR_LOG_DEBUG("Neighbor: " << neighbor << " status changed to INACTIVE");
@@ -226,21 +448,37 @@
    if (kl && kl->getType() == ndn::tlv::Name) {
      NLSR_LOG_DEBUG("Data signed with: " << kl->getName());
    }
+   auto validationStart = ndn::time::steady_clock::now();
    m_confParam.getValidator().validate(data,
-                                       std::bind(&HelloProtocol::onContentValidated, this, _1),
-                                       std::bind(&HelloProtocol::onContentValidationFailed,
-                                                 this, _1, _2));
+     [this, validationStart] (const ndn::Data& validatedData) {
+       helloValidationDuration.record(ndn::time::steady_clock::now() - validationStart);
+       onContentValidated(validatedData);
+     },
+     [this, validationStart] (const ndn::Data& failedData, const ndn::security::ValidationError& ve) {
+       helloValidationDuration.record(ndn::time::steady_clock::now() - validationStart);
+       onContentValidationFailed(failedData, ve);
+     });
  }
  
  void
  HelloProtocol::onContentValidated(const ndn::Data& data)
  {
+   metrics::HandlerScope scope(metrics::HandlerTag::HELLO_PROTOCOL, "onContentValidated");
    // data name: /<neighbor>/NLSR/INFO/<router>/<version>
    ndn::Name dataName = data.getName();
    NLSR_LOG_DEBUG("Data validation successful for INFO(name): " << dataName);
  
    if (dataName.get(-3).toUri() == INFO_COMPONENT) {
      ndn::Name neighbor = dataName.getPrefix(-4);
+     if (dataName.get(-2).toUri() == MULTICAST_COMPONENT) {
+       // checked again, since a newer Hello may have been validated in the meantime
+       if (!isNewMulticastHello(neighbor, dataName.get(-1))) {
+         NLSR_LOG_DEBUG("Ignoring stale or replayed multicast Hello " << dataName);
+         return;
+       }
+       m_multicastHelloVersions[neighbor] = dataName.get(-1).toVersion();
+       m_heardMulticastNeighbors.insert(neighbor);
+     }
  
      Adjacent::Status oldStatus = m_adjacencyList.getStatusOfNeighbor(neighbor);
      m_adjacencyList.setStatusOfNeighbor(neighbor, Adjacent::STATUS_ACTIVE);
@@ -250,6 +488,7 @@
      NLSR_LOG_DEBUG("Neighbor: " << neighbor);
      NLSR_LOG_DEBUG("Old Status: " << oldStatus << ", New Status: " << newStatus);
  
+     metrics::StartupTimeline::get().mark(metrics::StartupTimeline::Milestone::FIRST_HELLO);
      // Emit signal for Hello Data received (Option A)
     onDataReceived(neighbor);
  
@@ -268,10 +507,11 @@
          m_lsdb.scheduleAdjLsaBuild();
        }
        onInitialHelloDataValidated(neighbor);
+       m_lsdb.onNeighborProbed();
      }
    }
    // increment RCV_HELLO_DATA
-   hpIncrementSignal(Statistics::PacketType::RCV_HELLO_DATA);
+   m_stats.increment(Statistics::PacketType::RCV_HELLO_DATA);
  }
  
  void
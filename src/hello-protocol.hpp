@@ -32,17 +32,22 @@
  #include <ndn-cxx/security/validation-error.hpp>
  #include <ndn-cxx/util/scheduler.hpp>
  #include <ndn-cxx/util/signal.hpp>
+
+ #include <map>
+ #include <set>
  
  namespace nlsr {
  
  // Forward declaration
+ class AdmissionController;
  class Nlsr;
  
  class HelloProtocol
  {
  public:
    HelloProtocol(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam,
-                 RoutingTable& routingTable, Lsdb& lsdb, Nlsr& nlsr);
+                 RoutingTable& routingTable, Lsdb& lsdb, Statistics& stats, Nlsr& nlsr,
+                 AdmissionController& admission);
  
    /*! \brief Sends a Hello Interest packet.
     *
@@ -85,9 +90,20 @@
     */
    void
    processInterest(const ndn::Name& name, const ndn::Interest& interest);
- 
-   ndn::signal::Signal<HelloProtocol, Statistics::PacketType> hpIncrementSignal;
 
+  /*! \brief Starts sending Hellos on the multicast faces shared with neighbors.
+   *
+   * Neighbors configured with a Hello face (see Adjacent::getHelloFaceUri) are not sent
+   * unicast Hellos. Instead, one Hello Interest under ConfParameter::getHelloPrefix is
+   * multicast every Hello interval, carrying the signed Hello Data of this router, and
+   * every neighbor on the segment does the same. A neighbor is thus alive as long as
+   * its own multicast Hellos arrive, and down after hello-retries intervals without one.
+   *
+   * Called whenever the route of the Hello prefix is registered on a multicast face.
+   */
+  void
+  startMulticastHello();
+ 
   // Signals for LinkCostManager integration (Option A)
   ndn::signal::Signal<HelloProtocol, const ndn::Name&> onInterestSent;
   ndn::signal::Signal<HelloProtocol, const ndn::Name&> onDataReceived;
@@ -111,8 +127,29 @@ private:
     */
    void
    onContent(const ndn::Interest& interest, const ndn::Data& data);
- 
+
+  /*! \brief Processes a multicast Hello, i.e., the Hello Data of a neighbor in an Interest.
+   */
+  void
+  processMulticastHello(const ndn::Interest& interest);
+
+  /*! \brief Returns whether \p version is newer than the last multicast Hello accepted
+   *         from \p neighbor, so that a replayed Hello cannot keep the neighbor up.
+   */
+  bool
+  isNewMulticastHello(const ndn::Name& neighbor, const ndn::Name::Component& version) const;
+
  PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /*! \brief Multicasts the Hello Data of this router to the neighbors on shared segments.
+   */
+  void
+  sendMulticastHello();
+
+  /*! \brief Counts an interval without Hello for each silent multicast neighbor, then
+   *         sends the next multicast Hello.
+   */
+  void
+  onMulticastHelloInterval();
  
    /*! \brief Change a neighbor's status
     *
@@ -134,6 +171,7 @@ private:
  public:
    static inline const std::string INFO_COMPONENT{"INFO"};
    static inline const std::string NLSR_COMPONENT{"nlsr"};
+   static inline const std::string MULTICAST_COMPONENT{"multicast"};
  
    ndn::signal::Signal<HelloProtocol, const ndn::Name&> onInitialHelloDataValidated;
  
@@ -145,8 +183,20 @@ private:
    ConfParameter& m_confParam;
    RoutingTable& m_routingTable;
    Lsdb& m_lsdb;
+   Statistics& m_stats;
    AdjacencyList& m_adjacencyList;
    Nlsr& m_nlsr;  // Added for LinkCostManager integration
+   AdmissionController& m_admission;
+ 
+   ndn::ScopedRegisteredPrefixHandle m_multicastHelloFilter;
+   ndn::scheduler::ScopedEventId m_multicastHelloEvent;
+   ndn::scheduler::ScopedEventId m_multicastReplyEvent;
+
+ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+   /// multicast neighbors heard from during the current Hello interval
+   std::set<ndn::Name> m_heardMulticastNeighbors;
+   /// version of the last multicast Hello accepted from each neighbor
+   std::map<ndn::Name, uint64_t> m_multicastHelloVersions;
  };
  
  } // namespace nlsr
@@ -1,5 +1,9 @@
 #include "link-cost-manager.hpp"
+#include "admission-controller.hpp"
 #include "logger.hpp"
+#include "metrics/event-loop-monitor.hpp"
+#include "metrics/memory-report.hpp"
+#include "trace.hpp"
 
 #include <ndn-cxx/util/random.hpp>
 #include <cmath>
@@ -13,7 +17,8 @@ INIT_LOGGER(LinkCostManager);
 
 LinkCostManager::LinkCostManager(ndn::Face& face, ndn::KeyChain& keyChain,
                                 ConfParameter& confParam, AdjacencyList& adjacencyList, 
-                                Lsdb& lsdb, RoutingTable& routingTable,Fib& fib)
+                                Lsdb& lsdb, RoutingTable& routingTable,Fib& fib,
+                               AdmissionController& admission)
   : m_face(face)
   , m_keyChain(keyChain)
   , m_confParam(confParam)
@@ -31,14 +36,14 @@ LinkCostManager::LinkCostManager(ndn::Face& face, ndn::KeyChain& keyChain,
  NLSR_LOG_DEBUG("Registering RTT probe prefix: " << rttPrefix);
  
  m_face.setInterestFilter(rttPrefix,
-   [this](const auto& name, const auto& interest) {
+   admission.wrap(AdmissionClass::HELLO, [this](const auto& name, const auto& interest) {
      auto data = std::make_shared<ndn::Data>(interest.getName());
      data->setContent(ndn::encoding::makeStringBlock(ndn::tlv::Content, "rtt-response"));
      data->setFreshnessPeriod(ndn::time::milliseconds(1000));
      m_keyChain.sign(*data, m_confParam.getSigningInfo());
      m_face.put(*data);
      NLSR_LOG_TRACE("RTT response sent for: " << interest.getName());
-   },
+   }),
    [](const auto& name) {
      NLSR_LOG_DEBUG("RTT probe prefix registered: " << name);
    },
@@ -58,23 +63,50 @@ LinkCostManager::initialize()
   NLSR_LOG_INFO("Initializing Link Cost Manager");
   
   for (const auto& adjacent : m_adjacencyList.getAdjList()) {
-    OutgoingLinkState linkState;
-    linkState.neighbor = adjacent.getName();
-    linkState.status = adjacent.getStatus();
-    linkState.originalCost = adjacent.getLinkCost();
-    linkState.currentCost = adjacent.getLinkCost();
-    linkState.timeoutCount = adjacent.getInterestTimedOutNo();
-    linkState.lastSuccess = ndn::time::steady_clock::now();
-    
-    m_outgoingLinks[adjacent.getName()] = linkState;
-    
-    NLSR_LOG_DEBUG("Initialized link state for " << adjacent.getName() 
-                  << " with original cost " << linkState.originalCost);
+    addNeighbor(adjacent);
   }
   
   NLSR_LOG_INFO("Link Cost Manager initialized with " << m_outgoingLinks.size() << " neighbors");
 }
 
+void
+LinkCostManager::addNeighbor(const Adjacent& adjacent)
+{
+  OutgoingLinkState linkState;
+  linkState.neighbor = adjacent.getName();
+  linkState.status = adjacent.getStatus();
+  linkState.originalCost = adjacent.getLinkCost();
+  linkState.currentCost = adjacent.getLinkCost();
+  linkState.timeoutCount = adjacent.getInterestTimedOutNo();
+  linkState.lastSuccess = ndn::time::steady_clock::now();
+
+  m_outgoingLinks[adjacent.getName()] = std::move(linkState);
+
+  NLSR_LOG_DEBUG("Initialized link state for " << adjacent.getName()
+                << " with original cost " << adjacent.getLinkCost());
+}
+
+void
+LinkCostManager::removeNeighbor(const ndn::Name& neighbor)
+{
+  // Erasing the state cancels the pending measurement of this neighbor
+  if (m_outgoingLinks.erase(neighbor) > 0) {
+    NLSR_LOG_DEBUG("Removed link state for " << neighbor);
+  }
+}
+
+void
+LinkCostManager::setOriginalLinkCost(const ndn::Name& neighbor, double cost)
+{
+  auto it = m_outgoingLinks.find(neighbor);
+  if (it == m_outgoingLinks.end()) {
+    return;
+  }
+  it->second.originalCost = cost;
+  it->second.currentCost = cost;
+  it->second.rttHistory.clear();
+}
+
 void
 LinkCostManager::start()
 {
@@ -84,17 +116,16 @@ LinkCostManager::start()
   }
   
   m_isActive = true;
-  //延迟设定事件后，再开始RTT测量
-  m_scheduler.schedule(ndn::time::seconds(90), [this] {
-    for (auto& pair : m_outgoingLinks) {
-      if (pair.second.isStable()) {
-        scheduleRttMeasurement(pair.first);
-      }
+  // Neighbors that already answered a hello are probed right away, the others
+  // on their first successful hello
+  for (auto& pair : m_outgoingLinks) {
+    if (pair.second.isStable()) {
+      startProbing(pair.first);
     }
-    
-    m_scheduler.schedule(ndn::time::minutes(10), [this] {
-      generateStatusReport();
-    });
+  }
+
+  m_scheduler.schedule(ndn::time::minutes(10), [this] {
+    generateStatusReport();
   });
   
   NLSR_LOG_INFO("Link Cost Manager started");
@@ -110,6 +141,9 @@ LinkCostManager::stop()
   m_isActive = false;
   m_scheduler.cancelAllEvents();
   m_pendingMeasurements.clear();
+  for (auto& pair : m_outgoingLinks) {
+    pair.second.isProbing = false;
+  }
   
   // 恢复原始成本
   for (const auto& pair : m_outgoingLinks) {
@@ -140,6 +174,7 @@ LinkCostManager::onHelloInterestSent(const ndn::Name& neighbor)
 void
 LinkCostManager::onHelloDataReceived(const ndn::Name& neighbor)
 {
+  metrics::HandlerScope scope(metrics::HandlerTag::LINK_COST_MANAGER, "onHelloDataReceived");
   auto it = m_outgoingLinks.find(neighbor);
   if (it != m_outgoingLinks.end()) {
     auto& linkState = it->second;
@@ -149,8 +184,8 @@ LinkCostManager::onHelloDataReceived(const ndn::Name& neighbor)
     
     NLSR_LOG_TRACE("Hello Data received from " << neighbor << ", link stable");
     
-    if (m_isActive && linkState.isStable() && linkState.rttHistory.empty()) {
-      scheduleRttMeasurement(neighbor);
+    if (m_isActive && linkState.isStable()) {
+      startProbing(neighbor);
     }
   }
 } 
@@ -158,6 +193,7 @@ LinkCostManager::onHelloDataReceived(const ndn::Name& neighbor)
 void
 LinkCostManager::onHelloTimeout(const ndn::Name& neighbor, uint32_t timeouts)
 {
+  metrics::HandlerScope scope(metrics::HandlerTag::LINK_COST_MANAGER, "onHelloTimeout");
   auto it = m_outgoingLinks.find(neighbor);
   if (it != m_outgoingLinks.end()) {
     auto& linkState = it->second;
@@ -176,6 +212,7 @@ LinkCostManager::onHelloTimeout(const ndn::Name& neighbor, uint32_t timeouts)
 void
 LinkCostManager::onNeighborStatusChanged(const ndn::Name& neighbor, Adjacent::Status newStatus)
 {
+  metrics::HandlerScope scope(metrics::HandlerTag::LINK_COST_MANAGER, "onNeighborStatusChanged");
   auto it = m_outgoingLinks.find(neighbor);
   if (it != m_outgoingLinks.end()) {
     auto& linkState = it->second;
@@ -194,16 +231,29 @@ LinkCostManager::onNeighborStatusChanged(const ndn::Name& neighbor, Adjacent::St
       linkState.lastSuccess = ndn::time::steady_clock::now();
       
       if (m_isActive) {
-        scheduleRttMeasurement(neighbor);
+        startProbing(neighbor);
       }
     }
   }
 }
 
+void
+LinkCostManager::startProbing(const ndn::Name& neighbor)
+{
+  auto it = m_outgoingLinks.find(neighbor);
+  if (it == m_outgoingLinks.end() || it->second.isProbing) {
+    return;
+  }
+  NLSR_LOG_DEBUG("Starting RTT probing of " << neighbor);
+  it->second.isProbing = true;
+  scheduleRttMeasurement(neighbor);
+}
+
 void
 LinkCostManager::scheduleRttMeasurement(const ndn::Name& neighbor)
 {
-  if (!m_isActive) {
+  auto it = m_outgoingLinks.find(neighbor);
+  if (!m_isActive || it == m_outgoingLinks.end()) {
     return;
   }
   
@@ -215,7 +265,7 @@ LinkCostManager::scheduleRttMeasurement(const ndn::Name& neighbor)
     delay = ndn::time::seconds(1);
   }
   
-  m_scheduler.schedule(delay, [this, neighbor] {
+  it->second.measurementEvent = m_scheduler.schedule(delay, [this, neighbor] {
     if (canMeasureNow(neighbor)) {
       performRttMeasurement(neighbor);
     }
@@ -226,6 +276,7 @@ LinkCostManager::scheduleRttMeasurement(const ndn::Name& neighbor)
 void
 LinkCostManager::performRttMeasurement(const ndn::Name& neighbor)
 {
+  metrics::HandlerScope scope(metrics::HandlerTag::LINK_COST_MANAGER, "performRttMeasurement");
   uint32_t seq = m_nextSequenceNumber++;
   
   ndn::Name probeName = neighbor;
@@ -260,6 +311,7 @@ LinkCostManager::handleRttResponse(const ndn::Name& neighbor, uint32_t seq,
                                   ndn::time::steady_clock::time_point sendTime,
                                   const ndn::Data& data)
 {
+  metrics::HandlerScope scope(metrics::HandlerTag::LINK_COST_MANAGER, "handleRttResponse");
   auto it = m_pendingMeasurements.find(seq);
   if (it == m_pendingMeasurements.end()) {
     return;
@@ -307,6 +359,7 @@ LinkCostManager::handleRttResponse(const ndn::Name& neighbor, uint32_t seq,
 void
 LinkCostManager::handleRttTimeout(const ndn::Name& neighbor, uint32_t seq)
 {
+  metrics::HandlerScope scope(metrics::HandlerTag::LINK_COST_MANAGER, "handleRttTimeout");
   auto it = m_pendingMeasurements.find(seq);
   if (it != m_pendingMeasurements.end()) {
     m_pendingMeasurements.erase(it);
@@ -395,6 +448,8 @@ LinkCostManager::updateNeighborCost(const ndn::Name& neighbor, double rttBasedCo
   // ✅ 保持完整的NLSR更新链条
   adjacent->setLinkCost(finalCost);
   it->second.currentCost = finalCost;
+  NLSR_TRACE(cost__update, neighbor.toUri().c_str(), std::llround(oldCost * 1000),
+             std::llround(finalCost * 1000));
   
   // ✅ 触发完整的系统更新
   m_lsdb.scheduleAdjLsaBuild();
@@ -518,6 +573,28 @@ LinkCostManager::getRttHistory(const ndn::Name& neighbor) const
   return history;
 }
 
+void
+LinkCostManager::accountMemory(metrics::MemoryReport& report) const
+{
+  using metrics::MemoryReport;
+
+  size_t linkBytes = 0;
+  for (const auto& [name, state] : m_outgoingLinks) {
+    linkBytes += sizeof(std::pair<const ndn::Name, OutgoingLinkState>) +
+                 MemoryReport::HASH_NODE_OVERHEAD + MemoryReport::estimateName(name) +
+                 MemoryReport::estimateName(state.neighbor) +
+                 state.rttHistory.size() * sizeof(RttMeasurement);
+  }
+  report.add("link-cost.links", m_outgoingLinks.size(), linkBytes);
+
+  size_t pendingBytes = 0;
+  for (const auto& entry : m_pendingMeasurements) {
+    pendingBytes += sizeof(entry) + MemoryReport::HASH_NODE_OVERHEAD +
+                    MemoryReport::estimateName(entry.second.first);
+  }
+  report.add("link-cost.pending", m_pendingMeasurements.size(), pendingBytes);
+}
+
 std::optional<uint32_t>
 LinkCostManager::getTimeoutCount(const ndn::Name& neighbor) const
 {
@@ -41,6 +41,8 @@
  
  namespace nlsr {
 
+ class AdmissionController;
+
  class LinkCostManager {
  public:
    // ✅ 链路指标结构体（为负载感知算法提供完整数据）
@@ -90,6 +92,10 @@
      uint32_t timeoutCount;
      ndn::time::steady_clock::time_point lastSuccess;
      std::deque<RttMeasurement> rttHistory;
+     /// Whether the periodic RTT measurement of this neighbor is running
+     bool isProbing = false;
+     /// Next RTT measurement, cancelled when the state is erased or replaced
+     ndn::scheduler::ScopedEventId measurementEvent;
      
      //最大保存样本数量
      static constexpr size_t MAX_RTT_SAMPLES = 6;
@@ -124,7 +130,8 @@
  public:
    LinkCostManager(ndn::Face& face, ndn::KeyChain& keyChain,
                   ConfParameter& confParam, AdjacencyList& adjacencyList, 
-                  Lsdb& lsdb, RoutingTable& routingTable, Fib& fib);
+                  Lsdb& lsdb, RoutingTable& routingTable, Fib& fib,
+                  AdmissionController& admission);
 
    ~LinkCostManager();
   
@@ -153,6 +160,21 @@
     * @brief Stop dynamic cost management and restore original costs
     */
    void stop();
+
+   /**
+    * @brief Start tracking a neighbor added to the configuration at runtime
+    */
+   void addNeighbor(const Adjacent& adjacent);
+
+   /**
+    * @brief Forget a neighbor removed from the configuration at runtime
+    */
+   void removeNeighbor(const ndn::Name& neighbor);
+
+   /**
+    * @brief Replace the configured cost of a neighbor, which also becomes its current cost
+    */
+   void setOriginalLinkCost(const ndn::Name& neighbor, double cost);
  
    /**
     * @brief Check if manager is active
@@ -164,6 +186,11 @@
     * @brief 获取邻居的RTT历史统计信息
     */
    std::vector<ndn::time::steady_clock::duration> getRttHistory(const ndn::Name& neighbor) const;
+
+   /*! \brief Adds the estimated memory usage of the per-link telemetry to \p report.
+    */
+   void
+   accountMemory(metrics::MemoryReport& report) const;
   
    /**
     * @brief 获取邻居的超时统计信息
@@ -200,6 +227,7 @@
  
  private:
    // RTT Measurement
+   void startProbing(const ndn::Name& neighbor);
    void scheduleRttMeasurement(const ndn::Name& neighbor);
    void performRttMeasurement(const ndn::Name& neighbor);
    void handleRttResponse(const ndn::Name& neighbor, uint32_t seq,
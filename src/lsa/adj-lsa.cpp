@@ -46,11 +46,38 @@ AdjLsa::wireEncode(ndn::EncodingImpl<TAG>& block) const
 {
   size_t totalLength = 0;
 
-  auto list = m_adl.getAdjList();
-  for (auto it = list.rbegin(); it != list.rend(); ++it) {
-    totalLength += it->wireEncode(block);
+  const auto& list = m_adl.getAdjList();
+  if (m_encoding == Encoding::COMPACT) {
+    // FaceUris are dropped: they are only meaningful to the origin router, and
+    // receivers take the next hops of their routes from their own adjacencies
+    for (size_t i = list.size(); i-- > 0;) {
+      const auto& topologyCosts = list[i].getTopologyCosts();
+      size_t adjLength = 0;
+      for (auto it = topologyCosts.rbegin(); it != topologyCosts.rend(); ++it) {
+        size_t costLength = prependDoubleBlock(block, nlsr::tlv::Cost, it->second);
+        costLength += prependStringBlock(block, nlsr::tlv::TopologyName, it->first);
+        costLength += block.prependVarNumber(costLength);
+        costLength += block.prependVarNumber(nlsr::tlv::TopologyCost);
+        adjLength += costLength;
+      }
+      adjLength += prependDoubleBlock(block, nlsr::tlv::Cost, list[i].getLinkCost());
+      adjLength += prependFrontCodedName(block, list[i].getName(),
+                                         i > 0 ? list[i - 1].getName() : ndn::Name());
+      adjLength += block.prependVarNumber(adjLength);
+      adjLength += block.prependVarNumber(nlsr::tlv::CompactAdjacency);
+      totalLength += adjLength;
+    }
+  }
+  else {
+    for (auto it = list.rbegin(); it != list.rend(); ++it) {
+      totalLength += it->wireEncode(block);
+    }
   }
 
+  if (m_isNoTransit) {
+    totalLength += prependEmptyBlock(block, nlsr::tlv::NoTransit);
+  }
+  totalLength += prependEncoding(block);
   totalLength += Lsa::wireEncode(block);
 
   totalLength += block.prependVarNumber(totalLength);
@@ -100,13 +127,58 @@ AdjLsa::wireDecode(const ndn::Block& wire)
     NDN_THROW(Error("Missing required Lsa field"));
   }
 
+  decodeEncoding(val, m_wire.elements_end());
+
+  m_isNoTransit = val != m_wire.elements_end() && val->type() == nlsr::tlv::NoTransit;
+  if (m_isNoTransit) {
+    ++val;
+  }
+
   AdjacencyList adl;
-  for (; val != m_wire.elements_end(); ++val) {
-    if (val->type() == nlsr::tlv::Adjacency) {
-      adl.insert(Adjacent(*val));
+  if (m_encoding == Encoding::COMPACT) {
+    ndn::Name previous;
+    for (; val != m_wire.elements_end(); ++val) {
+      if (val->type() != nlsr::tlv::CompactAdjacency) {
+        NDN_THROW(Error("CompactAdjacency", val->type()));
+      }
+      val->parse();
+      auto element = val->elements_begin();
+      Adjacent adjacent(decodeFrontCodedName(element, val->elements_end(), previous));
+
+      if (element != val->elements_end() && element->type() == nlsr::tlv::Cost) {
+        adjacent.setLinkCost(ndn::encoding::readDouble(*element));
+        ++element;
+      }
+      else {
+        NDN_THROW(Error("Missing required Cost field"));
+      }
+
+      std::map<std::string, double> topologyCosts;
+      for (; element != val->elements_end() && element->type() == nlsr::tlv::TopologyCost;
+           ++element) {
+        element->parse();
+        if (element->elements_size() != 2 ||
+            element->elements()[0].type() != nlsr::tlv::TopologyName ||
+            element->elements()[1].type() != nlsr::tlv::Cost) {
+          NDN_THROW(Error("Malformed TopologyCost field"));
+        }
+        topologyCosts[readString(element->elements()[0])] =
+          ndn::encoding::readDouble(element->elements()[1]);
+      }
+      adjacent.setTopologyCosts(topologyCosts);
+
+      previous = adjacent.getName();
+      adl.insert(adjacent);
     }
-    else {
-      NDN_THROW(Error("Adjacency", val->type()));
+  }
+  else {
+    for (; val != m_wire.elements_end(); ++val) {
+      if (val->type() == nlsr::tlv::Adjacency) {
+        adl.insert(Adjacent(*val));
+      }
+      else {
+        NDN_THROW(Error("Adjacency", val->type()));
+      }
     }
   }
   m_adl = adl;
@@ -115,6 +187,9 @@ AdjLsa::wireDecode(const ndn::Block& wire)
 void
 AdjLsa::print(std::ostream& os) const
 {
+  if (m_isNoTransit) {
+    os << "      No-transit\n";
+  }
   os << "      Adjacent(s):\n";
 
   int adjacencyIndex = 0;
@@ -132,6 +207,7 @@ AdjLsa::update(const std::shared_ptr<Lsa>& lsa)
   auto alsa = std::static_pointer_cast<AdjLsa>(lsa);
   if (*this != *alsa) {
     resetAdl();
+    m_isNoTransit = alsa->isNoTransit();
     for (const auto& adjacent : alsa->getAdl()) {
       addAdjacent(adjacent);
     }
@@ -37,8 +37,22 @@ namespace nlsr {
  * @code{.abnf}
  * AdjLsa = ADJACENCY-LSA-TYPE TLV-LENGTH
  *            Lsa
- *            *Adjacency
+ *            [LsaEncoding]
+ *            [NoTransit]
+ *            (*Adjacency / *CompactAdjacency)
+ *
+ * NoTransit = NO-TRANSIT-TYPE TLV-LENGTH(=0)
+ *
+ * CompactAdjacency = COMPACT-ADJACENCY-TYPE TLV-LENGTH
+ *                      FrontCodedName ; against the name of the previous adjacency
+ *                      Cost
+ *                      *TopologyCost
  * @endcode
+ *
+ * The compact encoding, used when LsaEncoding is 1, leaves out the FaceUri of each
+ * adjacency: decoded adjacencies have an empty FaceUri.
+ *
+ * NoTransit marks a stub router: other routers reach it, but never route through it.
  */
 class AdjLsa : public Lsa, private boost::equality_comparable<AdjLsa>
 {
@@ -85,6 +99,21 @@ public:
     m_adl.insert(adj);
   }
 
+  /** @brief Returns whether the origin router must not carry transit traffic.
+   */
+  bool
+  isNoTransit() const
+  {
+    return m_isNoTransit;
+  }
+
+  void
+  setNoTransit(bool isNoTransit)
+  {
+    m_wire.reset();
+    m_isNoTransit = isNoTransit;
+  }
+
   const_iterator
   begin() const
   {
@@ -122,11 +151,12 @@ private: // non-member operators
   friend bool
   operator==(const AdjLsa& lhs, const AdjLsa& rhs)
   {
-    return lhs.m_adl == rhs.m_adl;
+    return lhs.m_isNoTransit == rhs.m_isNoTransit && lhs.m_adl == rhs.m_adl;
   }
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   AdjacencyList m_adl;
+  bool m_isNoTransit = false;
 };
 
 NDN_CXX_DECLARE_WIRE_ENCODE_INSTANTIATIONS(AdjLsa);
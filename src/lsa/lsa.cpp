@@ -36,6 +36,7 @@ Lsa::Lsa(const Lsa& lsa)
   : m_originRouter(lsa.getOriginRouter())
   , m_seqNo(lsa.getSeqNo())
   , m_expirationTimePoint(lsa.getExpirationTimePoint())
+  , m_encoding(lsa.getEncoding())
 {
 }
 
@@ -97,6 +98,44 @@ Lsa::wireDecode(const ndn::Block& wire)
   }
 }
 
+void
+Lsa::decodeEncoding(ndn::Block::element_const_iterator& val, ndn::Block::element_const_iterator end)
+{
+  m_encoding = Encoding::FULL;
+  if (val == end || val->type() != nlsr::tlv::LsaEncoding) {
+    return;
+  }
+
+  auto encoding = ndn::readNonNegativeInteger(*val);
+  if (encoding > static_cast<uint64_t>(Encoding::COMPACT)) {
+    NDN_THROW(Error("Unknown LsaEncoding " + std::to_string(encoding)));
+  }
+  m_encoding = static_cast<Encoding>(encoding);
+  ++val;
+}
+
+ndn::Name
+Lsa::decodeFrontCodedName(ndn::Block::element_const_iterator& val,
+                          ndn::Block::element_const_iterator end, const ndn::Name& previous)
+{
+  size_t shared = 0;
+  if (val != end && val->type() == nlsr::tlv::SharedComponents) {
+    shared = ndn::readNonNegativeInteger(*val);
+    if (shared > previous.size()) {
+      NDN_THROW(Error("SharedComponents exceeds the length of the previous name"));
+    }
+    ++val;
+  }
+
+  if (val == end || val->type() != ndn::tlv::Name) {
+    NDN_THROW(Error("Missing required Name field"));
+  }
+  ndn::Name name = previous.getPrefix(shared);
+  name.append(ndn::Name(*val));
+  ++val;
+  return name;
+}
+
 std::ostream&
 operator<<(std::ostream& os, const Lsa& lsa)
 {
@@ -150,4 +189,10 @@ operator>>(std::istream& is, Lsa::Type& type)
   return is;
 }
 
+std::ostream&
+operator<<(std::ostream& os, Lsa::Encoding encoding)
+{
+  return os << (encoding == Lsa::Encoding::COMPACT ? "compact" : "full");
+}
+
 } // namespace nlsr
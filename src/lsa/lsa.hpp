@@ -25,6 +25,7 @@
 #include "common.hpp"
 #include "name-prefix-list.hpp"
 #include "test-access-control.hpp"
+#include "tlv-nlsr.hpp"
 
 #include <ndn-cxx/util/scheduler.hpp>
 
@@ -43,6 +44,14 @@ namespace nlsr {
  *         SequenceNumber
  *         ExpirationTime
  * @endcode
+ *
+ * Name and Adjacency LSAs may follow the Lsa block with an LsaEncoding number
+ * selecting a more compact representation of their contents:
+ * @code{.abnf}
+ * LsaEncoding = LSA-ENCODING-TYPE TLV-LENGTH NonNegativeInteger ; 1 = compact
+ * @endcode
+ * An LSA without LsaEncoding uses the full encoding, so LSAs of routers that do
+ * not know about compact encoding are still decoded.
  */
 class Lsa
 {
@@ -60,6 +69,11 @@ public:
     BASE
   };
 
+  enum class Encoding {
+    FULL = 0,
+    COMPACT = 1,
+  };
+
 protected:
   Lsa() = default;
 
@@ -114,6 +128,24 @@ public:
     m_expiringEventId = eid;
   }
 
+  Encoding
+  getEncoding() const
+  {
+    return m_encoding;
+  }
+
+  /*! \brief Selects the encoding used by wireEncode().
+   *
+   * Decoding records the encoding of the received wire, so an LSA is re-encoded
+   * the way its origin router encoded it.
+   */
+  void
+  setEncoding(Encoding encoding)
+  {
+    m_encoding = encoding;
+    m_wire.reset();
+  }
+
   virtual std::tuple<bool, std::list<PrefixInfo>, std::list<PrefixInfo>>
   update(const std::shared_ptr<Lsa>& lsa) = 0;
 
@@ -128,6 +160,54 @@ protected:
   void
   wireDecode(const ndn::Block& wire);
 
+  /*! \brief Prepends the LsaEncoding field, which is omitted for the full encoding.
+   */
+  template<ndn::encoding::Tag TAG>
+  size_t
+  prependEncoding(ndn::EncodingImpl<TAG>& encoder) const
+  {
+    if (m_encoding == Encoding::FULL) {
+      return 0;
+    }
+    return prependNonNegativeIntegerBlock(encoder, nlsr::tlv::LsaEncoding,
+                                          static_cast<uint64_t>(m_encoding));
+  }
+
+  /*! \brief Decodes the optional LsaEncoding field at \p val, advancing past it.
+   */
+  void
+  decodeEncoding(ndn::Block::element_const_iterator& val, ndn::Block::element_const_iterator end);
+
+  /*! \brief Prepends \p name front-coded against \p previous.
+   *
+   * @code{.abnf}
+   * FrontCodedName = [SharedComponents] ; leading components of the previous name, default 0
+   *                  Name               ; remaining components
+   * @endcode
+   */
+  template<ndn::encoding::Tag TAG>
+  static size_t
+  prependFrontCodedName(ndn::EncodingImpl<TAG>& encoder, const ndn::Name& name,
+                        const ndn::Name& previous)
+  {
+    size_t shared = 0;
+    while (shared < name.size() && shared < previous.size() && name[shared] == previous[shared]) {
+      ++shared;
+    }
+
+    size_t totalLength = name.getSubName(shared).wireEncode(encoder);
+    if (shared > 0) {
+      totalLength += prependNonNegativeIntegerBlock(encoder, nlsr::tlv::SharedComponents, shared);
+    }
+    return totalLength;
+  }
+
+  /*! \brief Decodes a name written by prependFrontCodedName(), advancing \p val past it.
+   */
+  static ndn::Name
+  decodeFrontCodedName(ndn::Block::element_const_iterator& val,
+                       ndn::Block::element_const_iterator end, const ndn::Name& previous);
+
 private:
   virtual void
   print(std::ostream& os) const = 0;
@@ -140,6 +220,7 @@ PUBLIC_WITH_TESTS_ELSE_PROTECTED:
   uint64_t m_seqNo = 0;
   ndn::time::system_clock::time_point m_expirationTimePoint;
   ndn::scheduler::ScopedEventId m_expiringEventId;
+  Encoding m_encoding = Encoding::FULL;
 
   mutable ndn::Block m_wire;
 };
@@ -152,6 +233,9 @@ operator<<(std::ostream& os, const Lsa::Type& type);
 std::istream&
 operator>>(std::istream& is, Lsa::Type& type);
 
+std::ostream&
+operator<<(std::ostream& os, Lsa::Encoding encoding);
+
 } // namespace nlsr
 
 #endif // NLSR_LSA_LSA_HPP
@@ -45,12 +45,29 @@ NameLsa::wireEncode(ndn::EncodingImpl<TAG>& block) const
 {
   size_t totalLength = 0;
 
-  auto names = m_npl.getPrefixInfo();
-
-  for (auto it = names.rbegin();  it != names.rend(); ++it) {
-    totalLength += it->wireEncode(block);
+  const auto& names = m_npl.getPrefixInfo();
+
+  if (m_encoding == Encoding::COMPACT) {
+    // names are sorted, so each one is front-coded against its predecessor
+    for (size_t i = names.size(); i-- > 0;) {
+      size_t infoLength = 0;
+      if (names[i].getCost() != 0) {
+        infoLength += prependDoubleBlock(block, nlsr::tlv::Cost, names[i].getCost());
+      }
+      infoLength += prependFrontCodedName(block, names[i].getName(),
+                                          i > 0 ? names[i - 1].getName() : ndn::Name());
+      infoLength += block.prependVarNumber(infoLength);
+      infoLength += block.prependVarNumber(nlsr::tlv::CompactPrefixInfo);
+      totalLength += infoLength;
+    }
+  }
+  else {
+    for (auto it = names.rbegin();  it != names.rend(); ++it) {
+      totalLength += it->wireEncode(block);
+    }
   }
 
+  totalLength += prependEncoding(block);
   totalLength += Lsa::wireEncode(block);
 
   totalLength += block.prependVarNumber(totalLength);
@@ -100,14 +117,35 @@ NameLsa::wireDecode(const ndn::Block& wire)
     NDN_THROW(Error("Missing required Lsa field"));
   }
 
+  decodeEncoding(val, m_wire.elements_end());
+
   NamePrefixList npl;
-  for (; val != m_wire.elements_end(); ++val) {
-    if (val->type() == nlsr::tlv::PrefixInfo) {
-      //TODO: Implement this structure as a type instead and add decoding
-      npl.insert(PrefixInfo(*val));
+  if (m_encoding == Encoding::COMPACT) {
+    ndn::Name previous;
+    for (; val != m_wire.elements_end(); ++val) {
+      if (val->type() != nlsr::tlv::CompactPrefixInfo) {
+        NDN_THROW(Error("CompactPrefixInfo", val->type()));
+      }
+      val->parse();
+      auto element = val->elements_begin();
+      ndn::Name name = decodeFrontCodedName(element, val->elements_end(), previous);
+      double cost = 0;
+      if (element != val->elements_end() && element->type() == nlsr::tlv::Cost) {
+        cost = ndn::encoding::readDouble(*element);
+      }
+      npl.insert(PrefixInfo(name, cost));
+      previous = std::move(name);
     }
-    else {
-      NDN_THROW(Error("Name", val->type()));
+  }
+  else {
+    for (; val != m_wire.elements_end(); ++val) {
+      if (val->type() == nlsr::tlv::PrefixInfo) {
+        //TODO: Implement this structure as a type instead and add decoding
+        npl.insert(PrefixInfo(*val));
+      }
+      else {
+        NDN_THROW(Error("Name", val->type()));
+      }
     }
   }
   m_npl = npl;
@@ -129,35 +167,33 @@ std::tuple<bool, std::list<PrefixInfo>, std::list<PrefixInfo>>
 NameLsa::update(const std::shared_ptr<Lsa>& lsa)
 {
   auto nlsa = std::static_pointer_cast<NameLsa>(lsa);
-  bool updated = false;
-
-  // Obtain the set difference of the current and the incoming
-  // name prefix sets, and add those.
 
-  std::list<ndn::Name> newNames = nlsa->getNpl().getNames();
-  std::list<ndn::Name> oldNames = m_npl.getNames();
-  std::list<ndn::Name> nameRefToAdd;
+  // Add the names only present in the incoming LSA and remove those no longer
+  // advertised, in a single pass over both sorted lists.
   std::list<PrefixInfo> namesToAdd;
-
-  std::set_difference(newNames.begin(), newNames.end(), oldNames.begin(), oldNames.end(),
-                      std::inserter(nameRefToAdd, nameRefToAdd.begin()));
-  for (const auto& name : nameRefToAdd) {
-    namesToAdd.push_back(nlsa->getNpl().getPrefixInfoForName(name));
-    addName(nlsa->getNpl().getPrefixInfoForName(name));
-    updated = true;
-  }
-
-  // Also remove any names that are no longer being advertised.
-  std::list<ndn::Name> nameRefToRemove;
   std::list<PrefixInfo> namesToRemove;
-  std::set_difference(oldNames.begin(), oldNames.end(), newNames.begin(), newNames.end(),
-                      std::inserter(nameRefToRemove, nameRefToRemove.begin()));
-  for (const auto& name : nameRefToRemove) {
-    namesToRemove.push_back(m_npl.getPrefixInfoForName(name));
-    removeName(m_npl.getPrefixInfoForName(name));
-
+  bool updated = m_npl.mergeFrom(nlsa->getNpl(),
+    [&] (const PrefixInfo& info) { namesToAdd.push_back(info); },
+    [&] (const PrefixInfo& info) { namesToRemove.push_back(info); });
+
+  // Both lists now hold the same names in the same order. The merge keeps the cost
+  // of names present on both sides, so apply cost changes (e.g. of a summary after
+  // a topology change) here and report them as additions.
+  std::vector<PrefixInfo> costChanges;
+  const auto& current = m_npl.getPrefixInfo();
+  const auto& incoming = nlsa->getNpl().getPrefixInfo();
+  for (size_t i = 0; i < current.size(); ++i) {
+    if (current[i].getCost() != incoming[i].getCost()) {
+      costChanges.push_back(incoming[i]);
+    }
+  }
+  for (const auto& info : costChanges) {
+    m_npl.erase(info.getName());
+    m_npl.insert(info);
+    namesToAdd.push_back(info);
     updated = true;
   }
+
   return {updated, namesToAdd, namesToRemove};
 }
 
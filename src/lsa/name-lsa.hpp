@@ -36,8 +36,16 @@ namespace nlsr {
  * @code{.abnf}
  * NameLsa = NAME-LSA-TYPE TLV-LENGTH
  *             Lsa
- *             1*Name
+ *             [LsaEncoding]
+ *             (*PrefixInfo / *CompactPrefixInfo)
+ *
+ * CompactPrefixInfo = COMPACT-PREFIX-INFO-TYPE TLV-LENGTH
+ *                       FrontCodedName ; against the name of the previous entry
+ *                       [Cost]         ; default 0
  * @endcode
+ *
+ * The compact encoding is used when LsaEncoding is 1. As names are sorted, names
+ * under a common prefix are adjacent and only their distinct suffixes are sent.
  */
 class NameLsa : public Lsa, private boost::equality_comparable<NameLsa>
 {
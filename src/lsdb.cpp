@@ -21,8 +21,15 @@
 
 #include "lsdb.hpp"
 
+#include "admission-controller.hpp"
+#include "area.hpp"
 #include "logger.hpp"
 #include "nlsr.hpp"
+#include "trace.hpp"
+#include "metrics/event-loop-monitor.hpp"
+#include "metrics/memory-report.hpp"
+#include "metrics/metrics-registry.hpp"
+#include "metrics/startup-timeline.hpp"
 #include "utility/name-helper.hpp"
 
 #include <ndn-cxx/lp/tags.hpp>
@@ -31,10 +38,43 @@ namespace nlsr {
 
 INIT_LOGGER(Lsdb);
 
-Lsdb::Lsdb(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam)
+namespace {
+
+auto& lsaFetchDuration = metrics::Registry::get().addHistogram("nlsr_lsa_fetch_duration_seconds",
+  "Time from expressing an LSA Interest until the complete LSA has been fetched");
+auto& lsaFetchErrors = metrics::Registry::get().addCounter("nlsr_lsa_fetch_errors_total",
+  "LSA fetches that ended with an error");
+auto& lsaValidationDuration = metrics::Registry::get().addHistogram("nlsr_validation_duration_seconds",
+  "Time spent validating received Data", "kind=\"lsa\"");
+
+metrics::Gauge&
+getLsdbSizeGauge(Lsa::Type type)
+{
+  static auto& nameLsas = metrics::Registry::get().addGauge("nlsr_lsdb_lsas",
+    "Number of LSAs in the LSDB", "type=\"name\"");
+  static auto& adjLsas = metrics::Registry::get().addGauge("nlsr_lsdb_lsas",
+    "Number of LSAs in the LSDB", "type=\"adjacency\"");
+  static auto& coordinateLsas = metrics::Registry::get().addGauge("nlsr_lsdb_lsas",
+    "Number of LSAs in the LSDB", "type=\"coordinate\"");
+
+  switch (type) {
+  case Lsa::Type::NAME:
+    return nameLsas;
+  case Lsa::Type::ADJACENCY:
+    return adjLsas;
+  default:
+    return coordinateLsas;
+  }
+}
+
+} // namespace
+
+Lsdb::Lsdb(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam, Statistics& stats,
+           AdmissionController& admission)
   : m_face(face)
   , m_scheduler(face.getIoContext())
   , m_confParam(confParam)
+  , m_stats(stats)
   , m_sync(m_face, keyChain,
       [this] (const auto& routerName, Lsa::Type lsaType, uint64_t seqNo, uint64_t) {
         return isLsaNew(routerName, lsaType, seqNo);
@@ -45,7 +85,8 @@ Lsdb::Lsdb(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam)
         confParam.getSyncUserPrefix(),
         confParam.getSyncInterestLifetime(),
         confParam.getRouterPrefix(),
-        confParam.getHyperbolicState()
+        confParam.getHyperbolicState(),
+        confParam.getAreas()
       })
   , m_lsaRefreshTime(ndn::time::seconds(m_confParam.getLsaRefreshTime()))
   , m_adjLsaBuildInterval(m_confParam.getAdjLsaBuildInterval())
@@ -67,7 +108,8 @@ Lsdb::Lsdb(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam)
   NLSR_LOG_DEBUG("Setting interest filter for LsaPrefix: " << name);
 
   m_face.setInterestFilter(ndn::InterestFilter(name).allowLoopback(false),
-    [this] (const auto& name, const auto& interest) { processInterest(name, interest); },
+    admission.wrap(AdmissionClass::LSA,
+      [this] (const auto& name, const auto& interest) { processInterest(name, interest); }),
     [] (const auto& name) { NLSR_LOG_DEBUG("Successfully registered prefix: " << name); },
     [] (const auto& name, const auto& reason) {
       NLSR_LOG_ERROR("Failed to register prefix " << name);
@@ -87,18 +129,81 @@ Lsdb::~Lsdb()
   for (const auto& fetcher : m_fetchers) {
     fetcher->stop();
   }
+  for (const auto& lsa : m_lsdb) {
+    getLsdbSizeGauge(lsa->getType()).add(-1);
+  }
 }
 
 void
 Lsdb::buildAndInstallOwnNameLsa()
 {
+  // A direct build also satisfies any pending scheduled build
+  m_scheduledNameLsaBuild.cancel();
+  m_nameLsaBuildDeadline.reset();
+
   NameLsa nameLsa(m_thisRouterPrefix, m_sequencingManager.getNameLsaSeq() + 1,
                   getLsaExpirationTimePoint(), m_confParam.getNamePrefixList());
+  nameLsa.setEncoding(getOwnLsaEncoding());
   m_sequencingManager.increaseNameLsaSeq();
   m_sequencingManager.writeSeqNoToFile();
   m_sync.publishRoutingUpdate(Lsa::Type::NAME, m_sequencingManager.getNameLsaSeq());
 
   installLsa(std::make_shared<NameLsa>(nameLsa));
+
+  auto callbacks = std::move(m_afterNameLsaBuild);
+  m_afterNameLsaBuild.clear();
+  for (const auto& callback : callbacks) {
+    callback();
+  }
+}
+
+void
+Lsdb::installOwnSummaryLsa(const std::string& area, const NamePrefixList& npl)
+{
+  auto origin = area::makeSummaryOrigin(m_thisRouterPrefix, area);
+  auto existing = findLsa<NameLsa>(origin);
+  if (existing != nullptr && existing->getNpl() == npl) {
+    return;
+  }
+
+  // Summaries share the sequence numbers of the Name LSA, which are persisted
+  NameLsa summaryLsa(origin, m_sequencingManager.getNameLsaSeq() + 1,
+                     getLsaExpirationTimePoint(), npl);
+  summaryLsa.setEncoding(getOwnLsaEncoding());
+  m_sequencingManager.increaseNameLsaSeq();
+  m_sequencingManager.writeSeqNoToFile();
+  NLSR_LOG_DEBUG("Originating summary of area " << area << " with " << npl.size() << " names");
+  m_sync.publishSummaryUpdate(area, m_sequencingManager.getNameLsaSeq());
+
+  installLsa(std::make_shared<NameLsa>(summaryLsa));
+}
+
+void
+Lsdb::scheduleNameLsaBuild(std::function<void()> afterBuild)
+{
+  static auto& coalesced = metrics::Registry::get().addCounter(
+    "nlsr_name_lsa_build_coalesced_total",
+    "Name LSA build requests merged into an already scheduled build");
+
+  if (afterBuild) {
+    m_afterNameLsaBuild.push_back(std::move(afterBuild));
+  }
+
+  auto now = ndn::time::steady_clock::now();
+  if (m_nameLsaBuildDeadline) {
+    coalesced.increment();
+  }
+  else {
+    m_nameLsaBuildDeadline = now + NAME_LSA_BUILD_MAX_WAIT;
+  }
+
+  auto delay = std::min<ndn::time::nanoseconds>(NAME_LSA_BUILD_DELAY, *m_nameLsaBuildDeadline - now);
+  NLSR_LOG_DEBUG("Scheduling Name LSA build in " <<
+                 ndn::time::duration_cast<ndn::time::milliseconds>(delay));
+  m_scheduledNameLsaBuild = m_scheduler.schedule(delay, [this] {
+    metrics::HandlerScope scope(metrics::HandlerTag::LSDB, "buildAndInstallOwnNameLsa");
+    buildAndInstallOwnNameLsa();
+  });
 }
 
 void
@@ -139,6 +244,22 @@ Lsdb::scheduleAdjLsaBuild()
   m_scheduledAdjLsaBuild = m_scheduler.schedule(m_adjLsaBuildInterval, [this] { buildAdjLsa(); });
 }
 
+void
+Lsdb::onNeighborProbed()
+{
+  if (m_isAdjLsaBootstrapped || m_confParam.getHyperbolicState() == HYPERBOLIC_STATE_ON ||
+      !m_confParam.getAdjacencyList().isEveryNeighborProbed(m_confParam.getInterestRetryNumber())) {
+    return;
+  }
+
+  NLSR_LOG_DEBUG("Every neighbor has been probed, building the first Adjacency LSA now");
+  metrics::StartupTimeline::get().mark(metrics::StartupTimeline::Milestone::NEIGHBORS_PROBED);
+  m_isAdjLsaBootstrapped = true;
+  m_adjBuildCount++;
+  m_isBuildAdjLsaScheduled = true;
+  m_scheduledAdjLsaBuild = m_scheduler.schedule(0_s, [this] { buildAdjLsa(); });
+}
+
 void
 Lsdb::writeLog() const
 {
@@ -158,18 +279,82 @@ Lsdb::writeLog() const
   }
 }
 
+static void
+accountStorage(metrics::MemoryReport& report, const std::string& subsystem,
+               const ndn::InMemoryStorage& storage)
+{
+  size_t bytes = 0;
+  for (const ndn::Data& data : storage) {
+    bytes += sizeof(ndn::Data) + data.wireEncode().size() +
+             metrics::MemoryReport::HASH_NODE_OVERHEAD + metrics::MemoryReport::TREE_NODE_OVERHEAD;
+  }
+  report.add(subsystem, storage.size(), bytes);
+}
+
+void
+Lsdb::accountMemory(metrics::MemoryReport& report) const
+{
+  using metrics::MemoryReport;
+
+  // Each LSA is referenced from two hashed indices; the decoded fields are
+  // approximated by the size of the encoded LSA
+  size_t lsaBytes = 0;
+  size_t wireBytes = 0;
+  for (const auto& lsa : m_lsdb) {
+    size_t wireSize = lsa->wireEncode().size();
+    size_t objectSize = 0;
+    switch (lsa->getType()) {
+    case Lsa::Type::ADJACENCY:
+      objectSize = sizeof(AdjLsa);
+      break;
+    case Lsa::Type::NAME:
+      objectSize = sizeof(NameLsa);
+      break;
+    case Lsa::Type::COORDINATE:
+      objectSize = sizeof(CoordinateLsa);
+      break;
+    default:
+      objectSize = sizeof(Lsa);
+      break;
+    }
+    lsaBytes += objectSize + 2 * MemoryReport::HASH_NODE_OVERHEAD + sizeof(std::shared_ptr<Lsa>) +
+                MemoryReport::estimateName(lsa->getOriginRouter()) + wireSize;
+    wireBytes += wireSize;
+  }
+  report.add("lsdb.lsas", m_lsdb.size(), lsaBytes);
+  report.add("lsdb.wire", m_lsdb.size(), wireBytes);
+
+  accountStorage(report, "lsdb.segment-fifo", m_segmentFifo);
+  accountStorage(report, "lsdb.lsa-storage", m_lsaStorage);
+
+  report.add("lsdb.fetchers", m_fetchers.size(),
+             m_fetchers.size() * (sizeof(ndn::SegmentFetcher) + MemoryReport::TREE_NODE_OVERHEAD));
+
+  size_t seqBytes = 0;
+  for (const auto& [name, seqNo] : m_highestSeqNo) {
+    seqBytes += sizeof(std::pair<const ndn::Name, uint64_t>) + MemoryReport::TREE_NODE_OVERHEAD +
+                MemoryReport::estimateName(name);
+  }
+  report.add("lsdb.highest-seqno", m_highestSeqNo.size(), seqBytes);
+}
+
 void
 Lsdb::processInterest(const ndn::Name& name, const ndn::Interest& interest)
 {
+  metrics::HandlerScope scope(metrics::HandlerTag::LSDB, "processInterest");
   ndn::Name interestName(interest.getName());
   NLSR_LOG_DEBUG("Interest received for LSA: " << interestName);
 
+  if (auto neighbor = findNeighbor(interest); neighbor != nullptr) {
+    neighbor->getTraffic().recordReceived(interest.wireEncode().size());
+  }
+
   if (interestName[-2].isVersion()) {
     // Interest for particular segment
     auto data = m_segmentFifo.find(interestName);
     if (data) {
       NLSR_LOG_TRACE("Replying from FIFO buffer");
-      m_face.put(*data);
+      putLsaSegment(interest, *data);
       return;
     }
 
@@ -179,7 +364,7 @@ Lsdb::processInterest(const ndn::Name& name, const ndn::Interest& interest)
   }
 
   // increment RCV_LSA_INTEREST
-  lsaIncrementSignal(Statistics::PacketType::RCV_LSA_INTEREST);
+  m_stats.increment(Statistics::PacketType::RCV_LSA_INTEREST);
 
   std::string chkString("LSA");
   int32_t lsaPosition = util::getNameComponentPosition(interestName, chkString);
@@ -189,8 +374,8 @@ Lsdb::processInterest(const ndn::Name& name, const ndn::Interest& interest)
   originRouter.append(interestName.getSubName(lsaPosition + 1,
                                               interestName.size() - lsaPosition - 3));
 
-  // if the interest is for this router's LSA
-  if (originRouter == m_thisRouterPrefix && lsaPosition >= 0) {
+  // if the interest is for this router's LSA or one of its summaries
+  if (area::getAdvertisingRouter(originRouter) == m_thisRouterPrefix && lsaPosition >= 0) {
     uint64_t seqNo = interestName[-1].toNumber();
     NLSR_LOG_DEBUG("LSA sequence number from interest: " << seqNo);
 
@@ -204,13 +389,13 @@ Lsdb::processInterest(const ndn::Name& name, const ndn::Interest& interest)
 
     incrementInterestRcvdStats(interestedLsType);
     if (processInterestForLsa(interest, originRouter, interestedLsType, seqNo)) {
-      lsaIncrementSignal(Statistics::PacketType::SENT_LSA_DATA);
+      m_stats.increment(Statistics::PacketType::SENT_LSA_DATA);
     }
   }
   // else the interest is for other router's LSA, serve signed data from LsaSegmentStorage
   else if (auto lsaSegment = m_lsaStorage.find(interest); lsaSegment) {
     NLSR_LOG_TRACE("Found data in LSA storage. Sending data for " << interest.getName());
-    m_face.put(*lsaSegment);
+    putLsaSegment(interest, *lsaSegment);
   }
 }
 
@@ -237,7 +422,7 @@ Lsdb::processInterestForLsa(const ndn::Interest& interest, const ndn::Name& orig
         segNum = interest.getName()[-1].toSegment();
       }
       if (segNum < segments.size()) {
-        m_face.put(*segments[segNum]);
+        putLsaSegment(interest, *segments[segNum]);
       }
       incrementDataSentStats(lsaType);
       return true;
@@ -249,11 +434,33 @@ Lsdb::processInterestForLsa(const ndn::Interest& interest, const ndn::Name& orig
   return false;
 }
 
+Adjacent*
+Lsdb::findNeighbor(const ndn::PacketBase& packet)
+{
+  auto incomingFaceIdTag = packet.getTag<ndn::lp::IncomingFaceIdTag>();
+  if (incomingFaceIdTag == nullptr) {
+    return nullptr;
+  }
+  auto& adjacencyList = m_confParam.getAdjacencyList();
+  auto adjacent = adjacencyList.findAdjacent(incomingFaceIdTag->get());
+  return adjacent != adjacencyList.end() ? &*adjacent : nullptr;
+}
+
+void
+Lsdb::putLsaSegment(const ndn::Interest& interest, const ndn::Data& data)
+{
+  m_face.put(data);
+  NLSR_TRACE(segment__served, data.getName().toUri().c_str(), data.wireEncode().size());
+  if (auto neighbor = findNeighbor(interest); neighbor != nullptr) {
+    neighbor->getTraffic().recordSent(data.wireEncode().size());
+  }
+}
+
 void
 Lsdb::installLsa(std::shared_ptr<Lsa> lsa)
 {
   auto timeToExpire = m_lsaRefreshTime;
-  if (lsa->getOriginRouter() != m_thisRouterPrefix) {
+  if (area::getAdvertisingRouter(lsa->getOriginRouter()) != m_thisRouterPrefix) {
     auto duration = lsa->getExpirationTimePoint() - ndn::time::system_clock::now();
     if (duration > ndn::time::seconds(0)) {
       timeToExpire = ndn::time::duration_cast<ndn::time::seconds>(duration);
@@ -261,10 +468,13 @@ Lsdb::installLsa(std::shared_ptr<Lsa> lsa)
   }
 
   auto chkLsa = findLsa(lsa->getOriginRouter(), lsa->getType());
+  NLSR_TRACE(lsa__install, lsa->getOriginRouter().toUri().c_str(), static_cast<int>(lsa->getType()),
+             lsa->getSeqNo(), chkLsa == nullptr);
   if (chkLsa == nullptr) {
     NLSR_LOG_DEBUG("Adding LSA:\n" << *lsa);
 
     m_lsdb.emplace(lsa);
+    getLsdbSizeGauge(lsa->getType()).add(1);
     onLsdbModified(lsa, LsdbUpdate::INSTALLED, {}, {});
 
     lsa->setExpiringEventId(scheduleLsaExpiration(lsa, timeToExpire));
@@ -292,6 +502,7 @@ Lsdb::removeLsa(const LsaContainer::index<Lsdb::byName>::type::iterator& lsaIt)
     auto lsaPtr = *lsaIt;
     NLSR_LOG_DEBUG("Removing LSA:\n" << *lsaPtr);
     m_lsdb.erase(lsaIt);
+    getLsdbSizeGauge(lsaPtr->getType()).add(-1);
     onLsdbModified(lsaPtr, LsdbUpdate::REMOVED, {}, {});
   }
 }
@@ -305,6 +516,7 @@ Lsdb::removeLsa(const ndn::Name& router, Lsa::Type lsaType)
 void
 Lsdb::buildAdjLsa()
 {
+  metrics::HandlerScope scope(metrics::HandlerTag::LSDB, "buildAdjLsa");
   NLSR_LOG_TRACE("buildAdjLsa called");
 
   m_isBuildAdjLsaScheduled = false;
@@ -350,8 +562,11 @@ Lsdb::buildAndInstallOwnAdjLsa()
   AdjLsa adjLsa(m_thisRouterPrefix, m_sequencingManager.getAdjLsaSeq() + 1,
                 getLsaExpirationTimePoint(),
                 m_confParam.getAdjacencyList());
+  adjLsa.setEncoding(getOwnLsaEncoding());
+  adjLsa.setNoTransit(m_confParam.isNoTransit());
   m_sequencingManager.increaseAdjLsaSeq();
   m_sequencingManager.writeSeqNoToFile();
+  metrics::StartupTimeline::get().mark(metrics::StartupTimeline::Milestone::FIRST_ADJ_LSA);
 
   //Sync adjacency LSAs if link-state or dry-run HR is enabled.
   if (m_confParam.getHyperbolicState() != HYPERBOLIC_STATE_ON) {
@@ -371,6 +586,7 @@ Lsdb::scheduleLsaExpiration(std::shared_ptr<Lsa> lsa, ndn::time::seconds expTime
 void
 Lsdb::expireOrRefreshLsa(std::shared_ptr<Lsa> lsa)
 {
+  metrics::HandlerScope scope(metrics::HandlerTag::LSDB, "expireOrRefreshLsa");
   NLSR_LOG_DEBUG("ExpireOrRefreshLsa called for " << lsa->getType());
   NLSR_LOG_DEBUG("OriginRouter: " << lsa->getOriginRouter() << " Seq No: " << lsa->getSeqNo());
 
@@ -383,17 +599,25 @@ Lsdb::expireOrRefreshLsa(std::shared_ptr<Lsa> lsa)
     NLSR_LOG_DEBUG("LSA Exists with seq no: " << lsaPtr->getSeqNo());
     // If its seq no is the one we are expecting.
     if (lsaPtr->getSeqNo() == lsa->getSeqNo()) {
-      if (lsaPtr->getOriginRouter() == m_thisRouterPrefix) {
+      if (area::getAdvertisingRouter(lsaPtr->getOriginRouter()) == m_thisRouterPrefix) {
         NLSR_LOG_DEBUG("Own " << lsaPtr->getType() << " LSA, so refreshing it");
         NLSR_LOG_DEBUG("Current LSA:\n" << *lsaPtr);
-        lsaPtr->setSeqNo(lsaPtr->getSeqNo() + 1);
-        m_sequencingManager.setLsaSeq(lsaPtr->getSeqNo(), lsaPtr->getType());
+        // Summaries draw from the same numbers as the Name LSA, so continue from the
+        // last number handed out rather than from this LSA's own
+        uint64_t seqNo = m_sequencingManager.getLsaSeq(lsaPtr->getType()) + 1;
+        lsaPtr->setSeqNo(seqNo);
+        m_sequencingManager.setLsaSeq(seqNo, lsaPtr->getType());
         lsaPtr->setExpirationTimePoint(getLsaExpirationTimePoint());
         NLSR_LOG_DEBUG("Updated LSA:\n" << *lsaPtr);
         // schedule refreshing event again
         lsaPtr->setExpiringEventId(scheduleLsaExpiration(lsaPtr, m_lsaRefreshTime));
         m_sequencingManager.writeSeqNoToFile();
-        m_sync.publishRoutingUpdate(lsaPtr->getType(), m_sequencingManager.getLsaSeq(lsaPtr->getType()));
+        if (auto summarizedArea = area::getSummarizedArea(lsaPtr->getOriginRouter())) {
+          m_sync.publishSummaryUpdate(*summarizedArea, seqNo);
+        }
+        else {
+          m_sync.publishRoutingUpdate(lsaPtr->getType(), seqNo);
+        }
       }
       // Since we cannot refresh other router's LSAs, our only choice is to expire.
       else {
@@ -409,7 +633,7 @@ Lsdb::expressInterest(const ndn::Name& interestName, uint32_t timeoutCount, uint
                       ndn::time::steady_clock::time_point deadline)
 {
   // increment SENT_LSA_INTEREST
-  lsaIncrementSignal(Statistics::PacketType::SENT_LSA_INTEREST);
+  m_stats.increment(Statistics::PacketType::SENT_LSA_INTEREST);
 
   if (deadline == DEFAULT_LSA_RETRIEVAL_DEADLINE) {
     deadline = ndn::time::steady_clock::now() + ndn::time::seconds(static_cast<int>(LSA_REFRESH_TIME_MAX));
@@ -435,17 +659,38 @@ Lsdb::expressInterest(const ndn::Name& interestName, uint32_t timeoutCount, uint
   ndn::Interest interest(interestName);
   if (incomingFaceId != 0) {
     interest.setTag(std::make_shared<ndn::lp::NextHopFaceIdTag>(incomingFaceId));
+    auto adjacent = m_confParam.getAdjacencyList().findAdjacent(incomingFaceId);
+    if (adjacent != m_confParam.getAdjacencyList().end()) {
+      adjacent->getTraffic().recordSent(interest.wireEncode().size());
+    }
   }
   ndn::SegmentFetcher::Options options;
   options.interestLifetime = m_confParam.getLsaInterestLifetime();
   options.maxTimeout = m_confParam.getLsaInterestLifetime();
 
   NLSR_LOG_DEBUG("Fetching Data for LSA: " << interestName << " Seq number: " << seqNo);
+  auto fetchStart = ndn::time::steady_clock::now();
+  NLSR_TRACE(fetch__start, interestName.toUri().c_str(), seqNo);
   auto fetcher = ndn::SegmentFetcher::start(m_face, interest, m_confParam.getValidator(), options);
 
   auto it = m_fetchers.insert(fetcher).first;
 
-  fetcher->afterSegmentValidated.connect([this] (const ndn::Data& data) {
+  // Segments are validated asynchronously, so remember when each one arrived
+  auto segmentArrivals = std::make_shared<std::map<ndn::Name, ndn::time::steady_clock::time_point>>();
+  fetcher->afterSegmentReceived.connect([this, segmentArrivals] (const ndn::Data& data) {
+    (*segmentArrivals)[data.getName()] = ndn::time::steady_clock::now();
+    if (auto neighbor = findNeighbor(data); neighbor != nullptr) {
+      neighbor->getTraffic().recordReceived(data.wireEncode().size());
+    }
+  });
+
+  fetcher->afterSegmentValidated.connect([this, segmentArrivals] (const ndn::Data& data) {
+    auto arrival = segmentArrivals->find(data.getName());
+    if (arrival != segmentArrivals->end()) {
+      lsaValidationDuration.record(ndn::time::steady_clock::now() - arrival->second);
+      segmentArrivals->erase(arrival);
+    }
+
     // Nlsr class subscribes to this to fetch certificates
     afterSegmentValidatedSignal(data);
 
@@ -458,12 +703,20 @@ Lsdb::expressInterest(const ndn::Name& interestName, uint32_t timeoutCount, uint
   });
 
   fetcher->onComplete.connect([=] (const ndn::ConstBufferPtr& bufferPtr) {
+    auto fetchDuration = ndn::time::steady_clock::now() - fetchStart;
+    lsaFetchDuration.record(fetchDuration);
+    NLSR_TRACE(fetch__end, interestName.toUri().c_str(), 0,
+               ndn::time::duration_cast<ndn::time::microseconds>(fetchDuration).count());
     m_lsaStorage.erase(ndn::Name(lsaName).appendNumber(seqNo - 1));
     afterFetchLsa(bufferPtr, interestName);
     m_fetchers.erase(it);
   });
 
   fetcher->onError.connect([=] (uint32_t errorCode, const std::string& msg) {
+    lsaFetchErrors.increment();
+    NLSR_TRACE(fetch__end, interestName.toUri().c_str(), errorCode,
+               ndn::time::duration_cast<ndn::time::microseconds>(
+                 ndn::time::steady_clock::now() - fetchStart).count());
     onFetchLsaError(errorCode, msg, interestName, timeoutCount, deadline, lsaName, seqNo);
     m_fetchers.erase(it);
   });
@@ -501,8 +754,9 @@ Lsdb::onFetchLsaError(uint32_t errorCode, const std::string& msg, const ndn::Nam
 void
 Lsdb::afterFetchLsa(const ndn::ConstBufferPtr& bufferPtr, const ndn::Name& interestName)
 {
+  metrics::HandlerScope scope(metrics::HandlerTag::LSDB, "afterFetchLsa");
   NLSR_LOG_DEBUG("Received data for LSA interest: " << interestName);
-  lsaIncrementSignal(Statistics::PacketType::RCV_LSA_DATA);
+  m_stats.increment(Statistics::PacketType::RCV_LSA_DATA);
 
   ndn::Name lsaName = interestName.getSubName(0, interestName.size()-1);
   uint64_t seqNo = interestName[-1].toNumber();
@@ -537,19 +791,19 @@ Lsdb::afterFetchLsa(const ndn::ConstBufferPtr& bufferPtr, const ndn::Name& inter
 
       ndn::Block block(bufferPtr);
       if (interestedLsType == Lsa::Type::NAME) {
-        lsaIncrementSignal(Statistics::PacketType::RCV_NAME_LSA_DATA);
+        m_stats.increment(Statistics::PacketType::RCV_NAME_LSA_DATA);
         if (isLsaNew(originRouter, interestedLsType, seqNo)) {
           installLsa(std::make_shared<NameLsa>(block));
         }
       }
       else if (interestedLsType == Lsa::Type::ADJACENCY) {
-        lsaIncrementSignal(Statistics::PacketType::RCV_ADJ_LSA_DATA);
+        m_stats.increment(Statistics::PacketType::RCV_ADJ_LSA_DATA);
         if (isLsaNew(originRouter, interestedLsType, seqNo)) {
           installLsa(std::make_shared<AdjLsa>(block));
         }
       }
       else if (interestedLsType == Lsa::Type::COORDINATE) {
-        lsaIncrementSignal(Statistics::PacketType::RCV_COORD_LSA_DATA);
+        m_stats.increment(Statistics::PacketType::RCV_COORD_LSA_DATA);
         if (isLsaNew(originRouter, interestedLsType, seqNo)) {
           installLsa(std::make_shared<CoordinateLsa>(block));
         }
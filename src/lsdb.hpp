@@ -44,12 +44,29 @@
 #include <boost/multi_index/composite_key.hpp>
 #include <boost/multi_index/hashed_index.hpp>
 
+#include <optional>
+#include <vector>
+
 namespace nlsr {
 
 namespace bmi = boost::multi_index;
 
+class AdmissionController;
+
+namespace metrics {
+class MemoryReport;
+} // namespace metrics
+
 inline constexpr ndn::time::seconds GRACE_PERIOD = 10_s;
 
+/*! \brief Quiet period after the last prefix change before the Name LSA is rebuilt.
+ */
+inline constexpr ndn::time::milliseconds NAME_LSA_BUILD_DELAY = 50_ms;
+
+/*! \brief Upper bound on how long a prefix change may wait for a Name LSA rebuild.
+ */
+inline constexpr ndn::time::milliseconds NAME_LSA_BUILD_MAX_WAIT = 1_s;
+
 enum class LsdbUpdate {
   INSTALLED,
   UPDATED,
@@ -59,7 +76,8 @@ enum class LsdbUpdate {
 class Lsdb
 {
 public:
-  Lsdb(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam);
+  Lsdb(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam, Statistics& stats,
+       AdmissionController& admission);
 
   ~Lsdb();
 
@@ -77,6 +95,31 @@ public:
   void
   buildAndInstallOwnNameLsa();
 
+  /*! \brief Schedules a build of this router's name LSA.
+
+      Each request postpones the build until no further request has arrived
+      for NAME_LSA_BUILD_DELAY, so a burst of prefix changes produces a single
+      LSA version. The build is never postponed past NAME_LSA_BUILD_MAX_WAIT
+      after the first pending request.
+
+      \param afterBuild Invoked once an LSA covering the request has been installed.
+  */
+  void
+  scheduleNameLsaBuild(std::function<void()> afterBuild = nullptr);
+
+  /*! \brief Originates the summary of \p area into the other areas of this area border router.
+
+      Nothing is published if the summary has not changed.
+  */
+  void
+  installOwnSummaryLsa(const std::string& area, const NamePrefixList& npl);
+
+  bool
+  isNameLsaBuildScheduled() const
+  {
+    return m_nameLsaBuildDeadline.has_value();
+  }
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /*! \brief Builds a cor. LSA for this router and installs it into the LSDB. */
   void
@@ -87,9 +130,37 @@ public:
   void
   scheduleAdjLsaBuild();
 
+  /*! \brief Notifies that a neighbor answered a hello or exhausted its hello retries.
+   *
+   * Until the first adjacency LSA is built, this builds it as soon as every neighbor
+   * has been probed, instead of waiting for the adjacency LSA build interval.
+   */
+  void
+  onNeighborProbed();
+
+  /*! \brief Applies to the next adjacency LSA build scheduled. */
+  void
+  setAdjLsaBuildInterval(ndn::time::seconds interval)
+  {
+    m_adjLsaBuildInterval = interval;
+  }
+
+  /*! \brief Applies to LSAs built or refreshed from now on. */
+  void
+  setLsaRefreshTime(ndn::time::seconds refreshTime)
+  {
+    m_lsaRefreshTime = refreshTime;
+  }
+
   void
   writeLog() const;
 
+  /*! \brief Adds the estimated memory usage of the LSDB, its segment stores,
+   *         active fetchers and sequence number map to \p report.
+   */
+  void
+  accountMemory(metrics::MemoryReport& report) const;
+
   /* \brief Process interest which can be either:
    * 1) Discovery interest from segment fetcher:
    *    /localhop/<network>/nlsr/LSA/<site>/<router>/<lsaType>/<seqNo>
@@ -187,13 +258,13 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   incrementDataSentStats(Lsa::Type lsaType)
   {
     if (lsaType == Lsa::Type::NAME) {
-      lsaIncrementSignal(Statistics::PacketType::SENT_NAME_LSA_DATA);
+      m_stats.increment(Statistics::PacketType::SENT_NAME_LSA_DATA);
     }
     else if (lsaType == Lsa::Type::ADJACENCY) {
-      lsaIncrementSignal(Statistics::PacketType::SENT_ADJ_LSA_DATA);
+      m_stats.increment(Statistics::PacketType::SENT_ADJ_LSA_DATA);
     }
     else if (lsaType == Lsa::Type::COORDINATE) {
-      lsaIncrementSignal(Statistics::PacketType::SENT_COORD_LSA_DATA);
+      m_stats.increment(Statistics::PacketType::SENT_COORD_LSA_DATA);
     }
   }
 
@@ -201,13 +272,13 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   incrementInterestRcvdStats(Lsa::Type lsaType)
   {
     if (lsaType == Lsa::Type::NAME) {
-      lsaIncrementSignal(Statistics::PacketType::RCV_NAME_LSA_INTEREST);
+      m_stats.increment(Statistics::PacketType::RCV_NAME_LSA_INTEREST);
     }
     else if (lsaType == Lsa::Type::ADJACENCY) {
-      lsaIncrementSignal(Statistics::PacketType::RCV_ADJ_LSA_INTEREST);
+      m_stats.increment(Statistics::PacketType::RCV_ADJ_LSA_INTEREST);
     }
     else if (lsaType == Lsa::Type::COORDINATE) {
-      lsaIncrementSignal(Statistics::PacketType::RCV_COORD_LSA_INTEREST);
+      m_stats.increment(Statistics::PacketType::RCV_COORD_LSA_INTEREST);
     }
   }
 
@@ -215,13 +286,13 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   incrementInterestSentStats(Lsa::Type lsaType)
   {
     if (lsaType == Lsa::Type::NAME) {
-      lsaIncrementSignal(Statistics::PacketType::SENT_NAME_LSA_INTEREST);
+      m_stats.increment(Statistics::PacketType::SENT_NAME_LSA_INTEREST);
     }
     else if (lsaType == Lsa::Type::ADJACENCY) {
-      lsaIncrementSignal(Statistics::PacketType::SENT_ADJ_LSA_INTEREST);
+      m_stats.increment(Statistics::PacketType::SENT_ADJ_LSA_INTEREST);
     }
     else if (lsaType == Lsa::Type::COORDINATE) {
-      lsaIncrementSignal(Statistics::PacketType::SENT_COORD_LSA_INTEREST);
+      m_stats.increment(Statistics::PacketType::SENT_COORD_LSA_INTEREST);
     }
   }
 
@@ -319,6 +390,18 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   afterFetchLsa(const ndn::ConstBufferPtr& bufferPtr, const ndn::Name& interestName);
 
+  /*! \brief Returns the neighbor that \p packet arrived from.
+   *
+   * \return nullptr if the packet carries no IncomingFaceId or the face is not a neighbor's
+   */
+  Adjacent*
+  findNeighbor(const ndn::PacketBase& packet);
+
+  /*! \brief Sends an LSA segment in reply to \p interest and accounts it to the neighbor.
+   */
+  void
+  putLsaSegment(const ndn::Interest& interest, const ndn::Data& data);
+
   void
   emitSegmentValidatedSignal(const ndn::Data& data)
   {
@@ -331,8 +414,13 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
     return ndn::time::system_clock::now() + ndn::time::seconds(m_confParam.getRouterDeadInterval());
   }
 
+  Lsa::Encoding
+  getOwnLsaEncoding() const
+  {
+    return m_confParam.isLsaEncodingCompact() ? Lsa::Encoding::COMPACT : Lsa::Encoding::FULL;
+  }
+
 public:
-  ndn::signal::Signal<Lsdb, Statistics::PacketType> lsaIncrementSignal;
   ndn::signal::Signal<Lsdb, ndn::Data> afterSegmentValidatedSignal;
   using AfterLsdbModified = ndn::signal::Signal<Lsdb, std::shared_ptr<Lsa>, LsdbUpdate,
                                                 std::list<nlsr::PrefixInfo>, std::list<nlsr::PrefixInfo>>;
@@ -342,6 +430,7 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   ndn::Face& m_face;
   ndn::Scheduler m_scheduler;
   ConfParameter& m_confParam;
+  Statistics& m_stats;
 
   SyncLogicHandler m_sync;
 
@@ -365,8 +454,13 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 
   bool m_isBuildAdjLsaScheduled;
   int64_t m_adjBuildCount;
+  bool m_isAdjLsaBootstrapped = false;
   ndn::scheduler::ScopedEventId m_scheduledAdjLsaBuild;
 
+  std::optional<ndn::time::steady_clock::time_point> m_nameLsaBuildDeadline;
+  ndn::scheduler::ScopedEventId m_scheduledNameLsaBuild;
+  std::vector<std::function<void()>> m_afterNameLsaBuild;
+
   ndn::InMemoryStoragePersistent m_lsaStorage;
 
   static inline const ndn::time::steady_clock::time_point DEFAULT_LSA_RETRIEVAL_DEADLINE =
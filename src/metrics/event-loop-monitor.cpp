@@ -0,0 +1,182 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "event-loop-monitor.hpp"
+#include "logger.hpp"
+
+#include <ctime>
+#include <sstream>
+
+namespace nlsr::metrics {
+
+INIT_LOGGER(EventLoopMonitor);
+
+namespace {
+
+auto& eventLoopLag = Registry::get().addHistogram("nlsr_event_loop_lag_seconds",
+  "Delay between the time a heartbeat timer was due and the time it fired");
+
+thread_local HandlerScope* currentScope = nullptr;
+std::atomic<int64_t> slowThresholdNs{ndn::time::nanoseconds(50_ms).count()};
+
+struct TagMetrics
+{
+  Histogram* wall;
+  Histogram* cpu;
+  Counter* slow;
+};
+
+const TagMetrics&
+getTagMetrics(HandlerTag tag)
+{
+  static const auto all = [] {
+    std::array<TagMetrics, HANDLER_TAG_COUNT> metrics;
+    auto& registry = Registry::get();
+    for (size_t i = 0; i < HANDLER_TAG_COUNT; ++i) {
+      std::ostringstream label;
+      label << "tag=\"" << static_cast<HandlerTag>(i) << '"';
+      metrics[i].wall = &registry.addHistogram("nlsr_handler_wall_seconds",
+        "Wall-clock time spent in event handlers, excluding nested handlers", label.str());
+      metrics[i].cpu = &registry.addHistogram("nlsr_handler_cpu_seconds",
+        "CPU time spent in event handlers, excluding nested handlers", label.str());
+      metrics[i].slow = &registry.addCounter("nlsr_slow_handlers_total",
+        "Event handlers that ran longer than the slow handler threshold", label.str());
+    }
+    return metrics;
+  }();
+  return all[static_cast<size_t>(tag)];
+}
+
+} // namespace
+
+std::ostream&
+operator<<(std::ostream& os, HandlerTag tag)
+{
+  switch (tag) {
+  case HandlerTag::LSDB:
+    return os << "lsdb";
+  case HandlerTag::HELLO_PROTOCOL:
+    return os << "hello";
+  case HandlerTag::SYNC:
+    return os << "sync";
+  case HandlerTag::ROUTING_TABLE:
+    return os << "routing-table";
+  case HandlerTag::NAME_PREFIX_TABLE:
+    return os << "name-prefix-table";
+  case HandlerTag::FIB:
+    return os << "fib";
+  case HandlerTag::LINK_COST_MANAGER:
+    return os << "link-cost";
+  case HandlerTag::DISPATCHER:
+    return os << "dispatcher";
+  }
+  return os << static_cast<int>(tag);
+}
+
+HandlerScope::HandlerScope(HandlerTag tag, const char* what) noexcept
+  : m_tag(tag)
+  , m_what(what)
+  , m_parent(currentScope)
+  , m_wallStart(ndn::time::steady_clock::now())
+  , m_cpuStart(getThreadCpuTime())
+{
+  currentScope = this;
+}
+
+HandlerScope::~HandlerScope()
+{
+  auto wall = ndn::time::steady_clock::now() - m_wallStart;
+  auto cpu = getThreadCpuTime() - m_cpuStart;
+  currentScope = m_parent;
+
+  const auto& metrics = getTagMetrics(m_tag);
+  metrics.wall->record(wall - m_childWall);
+  metrics.cpu->record(cpu - m_childCpu);
+  if (m_parent != nullptr) {
+    m_parent->m_childWall += wall;
+    m_parent->m_childCpu += cpu;
+  }
+
+  if (wall > getSlowThreshold()) {
+    metrics.slow->increment();
+    NLSR_LOG_WARN("Slow " << m_tag << " handler " << m_what << ": "
+                  << ndn::time::duration_cast<ndn::time::milliseconds>(wall) << " wall, "
+                  << ndn::time::duration_cast<ndn::time::milliseconds>(cpu) << " CPU");
+  }
+}
+
+void
+HandlerScope::setSlowThreshold(ndn::time::nanoseconds threshold) noexcept
+{
+  slowThresholdNs.store(threshold.count(), std::memory_order_relaxed);
+}
+
+ndn::time::nanoseconds
+HandlerScope::getSlowThreshold() noexcept
+{
+  return ndn::time::nanoseconds(slowThresholdNs.load(std::memory_order_relaxed));
+}
+
+ndn::time::nanoseconds
+HandlerScope::getThreadCpuTime() noexcept
+{
+  timespec ts{};
+  ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ndn::time::seconds(ts.tv_sec) + ndn::time::nanoseconds(ts.tv_nsec);
+}
+
+EventLoopMonitor::EventLoopMonitor(boost::asio::io_context& io, ndn::time::milliseconds interval,
+                                   ndn::time::milliseconds slowThreshold)
+  : m_scheduler(io)
+  , m_interval(interval)
+{
+  NLSR_LOG_INFO("Event-loop heartbeat every " << interval <<
+                ", slow handler threshold " << slowThreshold);
+  HandlerScope::setSlowThreshold(slowThreshold);
+  scheduleHeartbeat();
+}
+
+ndn::time::nanoseconds
+EventLoopMonitor::getLag() const
+{
+  return std::max<ndn::time::nanoseconds>(ndn::time::steady_clock::now() - m_due, 0_ns);
+}
+
+void
+EventLoopMonitor::scheduleHeartbeat()
+{
+  m_due = ndn::time::steady_clock::now() + m_interval;
+  m_heartbeat = m_scheduler.schedule(m_interval, [this] { onHeartbeat(); });
+}
+
+void
+EventLoopMonitor::onHeartbeat()
+{
+  auto lag = std::max<ndn::time::nanoseconds>(ndn::time::steady_clock::now() - m_due, 0_ns);
+  eventLoopLag.record(lag);
+  if (lag > HandlerScope::getSlowThreshold()) {
+    NLSR_LOG_WARN("Event loop lagged by "
+                  << ndn::time::duration_cast<ndn::time::milliseconds>(lag));
+  }
+  scheduleHeartbeat();
+}
+
+} // namespace nlsr::metrics
@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_METRICS_EVENT_LOOP_MONITOR_HPP
+#define NLSR_METRICS_EVENT_LOOP_MONITOR_HPP
+
+#include "metrics-registry.hpp"
+#include "test-access-control.hpp"
+
+#include <ndn-cxx/util/scheduler.hpp>
+
+namespace nlsr::metrics {
+
+/*! \brief Subsystems whose event handlers are accounted separately.
+ */
+enum class HandlerTag {
+  LSDB,
+  HELLO_PROTOCOL,
+  SYNC,
+  ROUTING_TABLE,
+  NAME_PREFIX_TABLE,
+  FIB,
+  LINK_COST_MANAGER,
+  DISPATCHER,
+};
+
+inline constexpr size_t HANDLER_TAG_COUNT = static_cast<size_t>(HandlerTag::DISPATCHER) + 1;
+
+std::ostream&
+operator<<(std::ostream& os, HandlerTag tag);
+
+/*! \brief Attributes the wall-clock and CPU time of one event handler to a HandlerTag.
+ *
+ * Place a HandlerScope at the top of each callback invoked from the event loop.
+ * Scopes may nest, e.g. an LSDB handler that installs an LSA which updates the
+ * name prefix table: time spent in a nested scope is attributed to its own tag
+ * and subtracted from the enclosing scope, so that per-tag totals add up to the
+ * time actually spent in handlers.
+ *
+ * A handler whose wall-clock time, including nested scopes, exceeds the slow
+ * handler threshold is logged together with its tag and \p what.
+ */
+class HandlerScope : boost::noncopyable
+{
+public:
+  /*! \param what a string literal naming the handler; it must outlive the scope
+   */
+  HandlerScope(HandlerTag tag, const char* what) noexcept;
+
+  ~HandlerScope();
+
+  static void
+  setSlowThreshold(ndn::time::nanoseconds threshold) noexcept;
+
+  static ndn::time::nanoseconds
+  getSlowThreshold() noexcept;
+
+  /*! \brief Returns the CPU time consumed by the calling thread so far.
+   */
+  static ndn::time::nanoseconds
+  getThreadCpuTime() noexcept;
+
+private:
+  HandlerTag m_tag;
+  const char* m_what;
+  HandlerScope* m_parent;
+  ndn::time::steady_clock::time_point m_wallStart;
+  ndn::time::nanoseconds m_cpuStart;
+  ndn::time::nanoseconds m_childWall{0};
+  ndn::time::nanoseconds m_childCpu{0};
+};
+
+/*! \brief Measures event-loop scheduling lag with a periodic heartbeat.
+ *
+ * A timer is scheduled every \p interval; the difference between the time it
+ * actually fires and the time it was due is the lag that any other event
+ * scheduled at that moment would have experienced, e.g. a Hello timeout.
+ * Lag above the slow handler threshold is logged.
+ */
+class EventLoopMonitor : boost::noncopyable
+{
+public:
+  EventLoopMonitor(boost::asio::io_context& io, ndn::time::milliseconds interval,
+                   ndn::time::milliseconds slowThreshold);
+
+  /*! \brief Returns how long the pending heartbeat is overdue, i.e., the lag that an
+   *         event due now would experience because of the handlers that run before it.
+   */
+  ndn::time::nanoseconds
+  getLag() const;
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  void
+  scheduleHeartbeat();
+
+  void
+  onHeartbeat();
+
+private:
+  ndn::Scheduler m_scheduler;
+  ndn::time::milliseconds m_interval;
+  ndn::time::steady_clock::time_point m_due;
+  ndn::scheduler::ScopedEventId m_heartbeat;
+};
+
+} // namespace nlsr::metrics
+
+#endif // NLSR_METRICS_EVENT_LOOP_MONITOR_HPP
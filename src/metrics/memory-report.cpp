@@ -0,0 +1,106 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "memory-report.hpp"
+
+#include <algorithm>
+#include <iomanip>
+
+namespace nlsr::metrics {
+
+void
+MemoryReport::add(const std::string& subsystem, size_t objects, size_t bytes)
+{
+  auto it = std::find_if(m_entries.begin(), m_entries.end(),
+                         [&] (const Entry& entry) { return entry.subsystem == subsystem; });
+  if (it == m_entries.end()) {
+    m_entries.push_back({subsystem, objects, bytes});
+  }
+  else {
+    it->objects += objects;
+    it->bytes += bytes;
+  }
+}
+
+const MemoryReport::Entry*
+MemoryReport::find(const std::string& subsystem) const
+{
+  auto it = std::find_if(m_entries.begin(), m_entries.end(),
+                         [&] (const Entry& entry) { return entry.subsystem == subsystem; });
+  return it != m_entries.end() ? &*it : nullptr;
+}
+
+size_t
+MemoryReport::getTotalBytes() const
+{
+  size_t total = 0;
+  for (const auto& entry : m_entries) {
+    total += entry.bytes;
+  }
+  return total;
+}
+
+void
+MemoryReport::publish(Registry& registry) const
+{
+  for (const auto& entry : m_entries) {
+    std::string label = "subsystem=\"" + entry.subsystem + "\"";
+    registry.addGauge("nlsr_memory_bytes", "Estimated heap usage by subsystem", label)
+      .set(static_cast<int64_t>(entry.bytes));
+    registry.addGauge("nlsr_memory_objects", "Number of objects held by subsystem", label)
+      .set(static_cast<int64_t>(entry.objects));
+  }
+}
+
+size_t
+MemoryReport::estimateName(const ndn::Name& name)
+{
+  // Each decoded component is a Block that references the TLV value held in the
+  // Name's wire buffer
+  return name.wireEncode().size() + name.size() * sizeof(ndn::name::Component);
+}
+
+std::ostream&
+operator<<(std::ostream& os, const MemoryReport& report)
+{
+  const std::string header = "SUBSYSTEM";
+  size_t width = header.size();
+  for (const auto& entry : report.getEntries()) {
+    width = std::max(width, entry.subsystem.size());
+  }
+  width += 2;
+
+  auto flags = os.flags();
+  os << std::left << std::setw(width) << header << std::right
+     << std::setw(12) << "OBJECTS" << std::setw(14) << "BYTES" << "\n";
+  size_t totalObjects = 0;
+  for (const auto& entry : report.getEntries()) {
+    os << std::left << std::setw(width) << entry.subsystem << std::right
+       << std::setw(12) << entry.objects << std::setw(14) << entry.bytes << "\n";
+    totalObjects += entry.objects;
+  }
+  os << std::left << std::setw(width) << "total" << std::right
+     << std::setw(12) << totalObjects << std::setw(14) << report.getTotalBytes() << "\n";
+  os.flags(flags);
+  return os;
+}
+
+} // namespace nlsr::metrics
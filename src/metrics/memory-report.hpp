@@ -0,0 +1,130 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_METRICS_MEMORY_REPORT_HPP
+#define NLSR_METRICS_MEMORY_REPORT_HPP
+
+#include "metrics-registry.hpp"
+
+#include <ndn-cxx/name.hpp>
+#include <ndn-cxx/net/face-uri.hpp>
+
+#include <vector>
+
+namespace nlsr::metrics {
+
+/*! \brief Estimated heap usage, broken down by subsystem.
+ *
+ * Subsystems add their own figures through an accountMemory() member, using the
+ * estimate helpers below. Figures are estimates of the live payload plus the
+ * per-node overhead of the standard containers; allocator overhead and
+ * fragmentation are not included, so the total is a lower bound on RSS.
+ */
+class MemoryReport
+{
+public:
+  struct Entry
+  {
+    std::string subsystem;
+    size_t objects = 0;
+    size_t bytes = 0;
+  };
+
+  /*! \brief Adds \p objects and \p bytes to \p subsystem, creating the entry if needed.
+   */
+  void
+  add(const std::string& subsystem, size_t objects, size_t bytes);
+
+  const std::vector<Entry>&
+  getEntries() const
+  {
+    return m_entries;
+  }
+
+  const Entry*
+  find(const std::string& subsystem) const;
+
+  size_t
+  getTotalBytes() const;
+
+  /*! \brief Sets the nlsr_memory_bytes and nlsr_memory_objects gauges of each subsystem.
+   */
+  void
+  publish(Registry& registry) const;
+
+public:
+  /// Per-node overhead of node-based ordered containers (std::map, std::set).
+  static constexpr size_t TREE_NODE_OVERHEAD = 4 * sizeof(void*);
+  /// Per-node overhead of std::list.
+  static constexpr size_t LIST_NODE_OVERHEAD = 2 * sizeof(void*);
+  /// Per-node overhead of unordered containers, including the bucket slot.
+  static constexpr size_t HASH_NODE_OVERHEAD = 3 * sizeof(void*);
+
+  /*! \brief Estimates the heap footprint of a decoded Name, excluding sizeof(Name).
+   */
+  static size_t
+  estimateName(const ndn::Name& name);
+
+  /*! \brief Estimates the heap footprint of a string, excluding sizeof(std::string).
+   */
+  static size_t
+  estimateString(const std::string& str)
+  {
+    // Short strings are stored inline
+    return str.capacity() > SSO_CAPACITY ? str.capacity() + 1 : 0;
+  }
+
+  /*! \brief Estimates the heap footprint of a FaceUri, excluding sizeof(FaceUri).
+   */
+  static size_t
+  estimateFaceUri(const ndn::FaceUri& faceUri)
+  {
+    return estimateString(faceUri.getScheme()) + estimateString(faceUri.getHost()) +
+           estimateString(faceUri.getPort()) + estimateString(faceUri.getPath());
+  }
+
+  /*! \brief Estimates the heap footprint of a NexthopList, excluding sizeof(list).
+   *
+   * Short lists are stored inline, and next hops share their FaceUris.
+   */
+  template<typename NexthopList>
+  static size_t
+  estimateNexthops(const NexthopList& list)
+  {
+    const auto& nexthops = list.getNextHops();
+    if (nexthops.capacity() <= NexthopList::INLINE_CAPACITY) {
+      return 0;
+    }
+    return nexthops.capacity() * sizeof(typename NexthopList::Container::value_type);
+  }
+
+private:
+  static constexpr size_t SSO_CAPACITY = 15;
+
+  std::vector<Entry> m_entries;
+};
+
+std::ostream&
+operator<<(std::ostream& os, const MemoryReport& report);
+
+} // namespace nlsr::metrics
+
+#endif // NLSR_METRICS_MEMORY_REPORT_HPP
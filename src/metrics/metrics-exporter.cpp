@@ -0,0 +1,174 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "metrics-exporter.hpp"
+#include "logger.hpp"
+
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/streambuf.hpp>
+#include <boost/asio/write.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace nlsr::metrics {
+
+INIT_LOGGER(MetricsExporter);
+
+namespace {
+
+using boost::asio::local::stream_protocol;
+
+/*! \brief One accepted scrape connection; lives until the response is written.
+ */
+class HttpSession : public std::enable_shared_from_this<HttpSession>
+{
+public:
+  HttpSession(stream_protocol::socket socket, const Registry& registry)
+    : m_socket(std::move(socket))
+    , m_registry(registry)
+  {
+  }
+
+  void
+  start()
+  {
+    // The request itself is irrelevant: every path returns the full exposition.
+    boost::asio::async_read_until(m_socket, m_request, "\r\n\r\n",
+      [self = shared_from_this()] (const boost::system::error_code& ec, size_t) {
+        if (!ec) {
+          self->respond();
+        }
+      });
+  }
+
+private:
+  void
+  respond()
+  {
+    std::ostringstream body;
+    m_registry.writePrometheus(body);
+    m_response = MetricsExporter::makeHttpResponse(body.str());
+    boost::asio::async_write(m_socket, boost::asio::buffer(m_response),
+      [self = shared_from_this()] (const boost::system::error_code&, size_t) {
+        boost::system::error_code ignored;
+        self->m_socket.shutdown(stream_protocol::socket::shutdown_both, ignored);
+      });
+  }
+
+private:
+  stream_protocol::socket m_socket;
+  const Registry& m_registry;
+  boost::asio::streambuf m_request;
+  std::string m_response;
+};
+
+} // namespace
+
+MetricsExporter::MetricsExporter(boost::asio::io_context& io, const Registry& registry)
+  : m_io(io)
+  , m_registry(registry)
+  , m_scheduler(io)
+{
+}
+
+MetricsExporter::~MetricsExporter()
+{
+  if (m_acceptor != nullptr) {
+    boost::system::error_code ignored;
+    m_acceptor->close(ignored);
+    std::remove(m_socketPath.c_str());
+  }
+}
+
+void
+MetricsExporter::enableFileExport(const std::string& path, ndn::time::seconds interval)
+{
+  NLSR_LOG_INFO("Exporting metrics to " << path << " every " << interval);
+  m_filePath = path;
+  m_fileInterval = interval;
+  writeFile();
+}
+
+void
+MetricsExporter::writeFile()
+{
+  // Write to a temporary file and rename, so readers never observe a partial exposition
+  std::string tmpPath = m_filePath + ".tmp";
+  {
+    std::ofstream ofs(tmpPath, std::ios::trunc);
+    m_registry.writePrometheus(ofs);
+    if (!ofs) {
+      NLSR_LOG_WARN("Cannot write metrics to " << tmpPath);
+    }
+  }
+  if (std::rename(tmpPath.c_str(), m_filePath.c_str()) != 0) {
+    NLSR_LOG_WARN("Cannot rename " << tmpPath << " to " << m_filePath);
+  }
+
+  if (m_fileInterval > 0_s) {
+    m_fileEvent = m_scheduler.schedule(m_fileInterval, [this] { writeFile(); });
+  }
+}
+
+void
+MetricsExporter::enableSocketExport(const std::string& path)
+{
+  NLSR_LOG_INFO("Serving metrics over HTTP on unix:" << path);
+  std::remove(path.c_str());
+  m_socketPath = path;
+  m_acceptor = std::make_unique<stream_protocol::acceptor>(m_io, stream_protocol::endpoint(path));
+  acceptNext();
+}
+
+void
+MetricsExporter::acceptNext()
+{
+  m_acceptor->async_accept([this] (const boost::system::error_code& ec,
+                                   stream_protocol::socket socket) {
+    if (ec == boost::asio::error::operation_aborted) {
+      return;
+    }
+    if (!ec) {
+      std::make_shared<HttpSession>(std::move(socket), m_registry)->start();
+    }
+    else {
+      NLSR_LOG_DEBUG("Metrics socket accept error: " << ec.message());
+    }
+    acceptNext();
+  });
+}
+
+std::string
+MetricsExporter::makeHttpResponse(const std::string& body)
+{
+  std::ostringstream os;
+  os << "HTTP/1.0 200 OK\r\n"
+     << "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+     << "Content-Length: " << body.size() << "\r\n"
+     << "Connection: close\r\n"
+     << "\r\n"
+     << body;
+  return os.str();
+}
+
+} // namespace nlsr::metrics
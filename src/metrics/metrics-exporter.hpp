@@ -0,0 +1,91 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_METRICS_METRICS_EXPORTER_HPP
+#define NLSR_METRICS_METRICS_EXPORTER_HPP
+
+#include "metrics-registry.hpp"
+#include "test-access-control.hpp"
+
+#include <ndn-cxx/util/scheduler.hpp>
+
+#include <boost/asio/local/stream_protocol.hpp>
+
+namespace nlsr::metrics {
+
+/*! \brief Publishes a Registry in the Prometheus text format outside of NDN.
+ *
+ * Two sinks are supported and may be enabled together:
+ *  - a text file rewritten periodically (atomically, via rename), suitable for the
+ *    node_exporter textfile collector;
+ *  - a Unix stream socket answering every HTTP request with the current exposition,
+ *    suitable for scraping through a local reverse proxy.
+ *
+ * All work is done on the io_context of the NLSR Face.
+ */
+class MetricsExporter : boost::noncopyable
+{
+public:
+  MetricsExporter(boost::asio::io_context& io, const Registry& registry);
+
+  ~MetricsExporter();
+
+  /*! \brief Rewrite \p path with the current exposition every \p interval.
+   */
+  void
+  enableFileExport(const std::string& path, ndn::time::seconds interval);
+
+  /*! \brief Listen for HTTP requests on the Unix socket at \p path.
+   *
+   * An existing socket file at \p path is replaced.
+   */
+  void
+  enableSocketExport(const std::string& path);
+
+  /*! \brief Wraps \p body into a complete HTTP/1.0 response.
+   */
+  static std::string
+  makeHttpResponse(const std::string& body);
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  void
+  writeFile();
+
+private:
+  void
+  acceptNext();
+
+private:
+  boost::asio::io_context& m_io;
+  const Registry& m_registry;
+  ndn::Scheduler m_scheduler;
+
+  std::string m_filePath;
+  ndn::time::seconds m_fileInterval{0};
+  ndn::scheduler::ScopedEventId m_fileEvent;
+
+  std::string m_socketPath;
+  std::unique_ptr<boost::asio::local::stream_protocol::acceptor> m_acceptor;
+};
+
+} // namespace nlsr::metrics
+
+#endif // NLSR_METRICS_METRICS_EXPORTER_HPP
@@ -0,0 +1,253 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "metrics-registry.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+namespace nlsr::metrics {
+
+// Exported Prometheus buckets are the power-of-two boundaries from 16us to ~18min,
+// which keeps the set of series stable regardless of the recorded values.
+constexpr unsigned EXPORT_MIN_POWER = 4;
+constexpr unsigned EXPORT_MAX_POWER = 30;
+
+// Maps \p value onto buckets that include their lower bound instead of their upper bound
+static size_t
+getLowerInclusiveIndex(uint64_t value) noexcept
+{
+  if (value < Histogram::SUB_BUCKET_COUNT) {
+    return static_cast<size_t>(value);
+  }
+  unsigned msb = 63 - __builtin_clzll(value);
+  unsigned shift = msb - Histogram::SUB_BUCKET_BITS;
+  return ((msb - Histogram::SUB_BUCKET_BITS + 1) << Histogram::SUB_BUCKET_BITS) +
+         static_cast<size_t>((value >> shift) & (Histogram::SUB_BUCKET_COUNT - 1));
+}
+
+size_t
+Histogram::getBucketIndex(uint64_t value) noexcept
+{
+  // buckets cover (previous upper bound, upper bound], so shifting by one turns the
+  // lower-inclusive layout into an upper-inclusive one; 0 shares bucket 0 with 1
+  return value == 0 ? 0 : getLowerInclusiveIndex(value - 1);
+}
+
+uint64_t
+Histogram::getBucketUpperBound(size_t index) noexcept
+{
+  ++index;
+  if (index >= BUCKET_COUNT) {
+    return UINT64_MAX;
+  }
+  if (index < SUB_BUCKET_COUNT) {
+    return index;
+  }
+  unsigned shift = static_cast<unsigned>(index >> SUB_BUCKET_BITS) - 1;
+  uint64_t mantissa = SUB_BUCKET_COUNT + (index & (SUB_BUCKET_COUNT - 1));
+  return mantissa << shift;
+}
+
+uint64_t
+Histogram::getCountAtMost(uint64_t micros) const noexcept
+{
+  size_t last = getBucketIndex(micros);
+  uint64_t total = 0;
+  for (size_t i = 0; i <= last; ++i) {
+    total += getBucketCount(i);
+  }
+  return total;
+}
+
+uint64_t
+Histogram::getQuantile(double q) const noexcept
+{
+  uint64_t count = getCount();
+  if (count == 0) {
+    return 0;
+  }
+
+  auto rank = static_cast<uint64_t>(std::ceil(std::clamp(q, 0.0, 1.0) * count));
+  rank = std::max<uint64_t>(rank, 1);
+
+  uint64_t seen = 0;
+  for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+    seen += getBucketCount(i);
+    if (seen >= rank) {
+      return getBucketUpperBound(i);
+    }
+  }
+  return UINT64_MAX;
+}
+
+Registry&
+Registry::get()
+{
+  static Registry registry;
+  return registry;
+}
+
+Registry::Family&
+Registry::findOrInsertFamily(const std::string& name, const std::string& help, Type type)
+{
+  auto it = m_families.find(name);
+  if (it == m_families.end()) {
+    it = m_families.emplace(name, Family{type, help, {}, {}, {}}).first;
+  }
+  else if (it->second.type != type) {
+    NDN_THROW(Error("Metric " + name + " is already registered with a different type"));
+  }
+  return it->second;
+}
+
+Counter&
+Registry::addCounter(const std::string& name, const std::string& help, const std::string& labels)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto& slot = findOrInsertFamily(name, help, Type::COUNTER).counters[labels];
+  if (slot == nullptr) {
+    slot = std::make_unique<Counter>();
+  }
+  return *slot;
+}
+
+Gauge&
+Registry::addGauge(const std::string& name, const std::string& help, const std::string& labels)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto& slot = findOrInsertFamily(name, help, Type::GAUGE).gauges[labels];
+  if (slot == nullptr) {
+    slot = std::make_unique<Gauge>();
+  }
+  return *slot;
+}
+
+Histogram&
+Registry::addHistogram(const std::string& name, const std::string& help, const std::string& labels)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto& slot = findOrInsertFamily(name, help, Type::HISTOGRAM).histograms[labels];
+  if (slot == nullptr) {
+    slot = std::make_unique<Histogram>();
+  }
+  return *slot;
+}
+
+uint64_t
+Registry::addCollector(Collector collector)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_collectors.emplace(++m_lastCollectorId, std::move(collector));
+  return m_lastCollectorId;
+}
+
+void
+Registry::removeCollector(uint64_t id)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_collectors.erase(id);
+}
+
+static void
+writeSeriesName(std::ostream& os, const std::string& name, const std::string& labels,
+                const std::string& extraLabel = "")
+{
+  os << name;
+  if (!labels.empty() || !extraLabel.empty()) {
+    os << '{' << labels;
+    if (!labels.empty() && !extraLabel.empty()) {
+      os << ',';
+    }
+    os << extraLabel << '}';
+  }
+  os << ' ';
+}
+
+void
+Registry::writePrometheus(std::ostream& os) const
+{
+  // Collectors register metrics themselves, so they must run without holding the lock
+  std::vector<Collector> collectors;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& [id, collector] : m_collectors) {
+      collectors.push_back(collector);
+    }
+  }
+  for (const auto& collector : collectors) {
+    collector();
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  auto flags = os.flags();
+  auto precision = os.precision(10);
+
+  for (const auto& [name, family] : m_families) {
+    os << "# HELP " << name << ' ' << family.help << '\n';
+    switch (family.type) {
+    case Type::COUNTER:
+      os << "# TYPE " << name << " counter\n";
+      for (const auto& [labels, counter] : family.counters) {
+        writeSeriesName(os, name, labels);
+        os << counter->get() << '\n';
+      }
+      break;
+    case Type::GAUGE:
+      os << "# TYPE " << name << " gauge\n";
+      for (const auto& [labels, gauge] : family.gauges) {
+        writeSeriesName(os, name, labels);
+        os << gauge->get() << '\n';
+      }
+      break;
+    case Type::HISTOGRAM:
+      os << "# TYPE " << name << " histogram\n";
+      for (const auto& [labels, histogram] : family.histograms) {
+        // Buckets are clamped to the count read here so the exposition stays monotonic
+        // even if values are recorded concurrently
+        uint64_t count = histogram->getCount();
+        for (unsigned power = EXPORT_MIN_POWER; power <= EXPORT_MAX_POWER; ++power) {
+          uint64_t bound = uint64_t(1) << power;
+          std::ostringstream le;
+          le.precision(10);
+          le << "le=\"" << static_cast<double>(bound) / 1e6 << '"';
+          writeSeriesName(os, name + "_bucket", labels, le.str());
+          os << std::min(histogram->getCountAtMost(bound), count) << '\n';
+        }
+        writeSeriesName(os, name + "_bucket", labels, "le=\"+Inf\"");
+        os << count << '\n';
+        writeSeriesName(os, name + "_sum", labels);
+        os << static_cast<double>(histogram->getSum()) / 1e6 << '\n';
+        writeSeriesName(os, name + "_count", labels);
+        os << count << '\n';
+      }
+      break;
+    }
+  }
+
+  os.flags(flags);
+  os.precision(precision);
+}
+
+} // namespace nlsr::metrics
@@ -0,0 +1,296 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_METRICS_METRICS_REGISTRY_HPP
+#define NLSR_METRICS_METRICS_REGISTRY_HPP
+
+#include "common.hpp"
+
+#include <boost/noncopyable.hpp>
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+
+namespace nlsr::metrics {
+
+/*! \brief A monotonically increasing counter.
+ *
+ * Incrementing is a single relaxed atomic add, so counters may be bumped
+ * on any hot path without further synchronization.
+ */
+class Counter : boost::noncopyable
+{
+public:
+  void
+  increment(uint64_t delta = 1) noexcept
+  {
+    m_value.fetch_add(delta, std::memory_order_relaxed);
+  }
+
+  uint64_t
+  get() const noexcept
+  {
+    return m_value.load(std::memory_order_relaxed);
+  }
+
+private:
+  std::atomic<uint64_t> m_value{0};
+};
+
+/*! \brief A value that can go up and down, e.g., a table size or a queue depth.
+ */
+class Gauge : boost::noncopyable
+{
+public:
+  void
+  set(int64_t value) noexcept
+  {
+    m_value.store(value, std::memory_order_relaxed);
+  }
+
+  void
+  add(int64_t delta) noexcept
+  {
+    m_value.fetch_add(delta, std::memory_order_relaxed);
+  }
+
+  int64_t
+  get() const noexcept
+  {
+    return m_value.load(std::memory_order_relaxed);
+  }
+
+private:
+  std::atomic<int64_t> m_value{0};
+};
+
+/*! \brief A latency histogram with log-linear (HDR-style) buckets.
+ *
+ * Values are recorded in microseconds. Each power-of-two range is split into
+ * 2^SUB_BUCKET_BITS linear sub-buckets, which bounds the relative error of any
+ * reported quantile to 1/2^SUB_BUCKET_BITS (12.5%) over the full 64-bit range
+ * while keeping recording to three relaxed atomic adds. Buckets include their upper
+ * bound, matching the "less than or equal" meaning of Prometheus `le` labels.
+ */
+class Histogram : boost::noncopyable
+{
+public:
+  static constexpr size_t SUB_BUCKET_BITS = 3;
+  static constexpr size_t SUB_BUCKET_COUNT = size_t(1) << SUB_BUCKET_BITS;
+  static constexpr size_t BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+  void
+  record(uint64_t micros) noexcept
+  {
+    m_buckets[getBucketIndex(micros)].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(micros, std::memory_order_relaxed);
+  }
+
+  void
+  record(ndn::time::nanoseconds duration) noexcept
+  {
+    auto micros = ndn::time::duration_cast<ndn::time::microseconds>(duration).count();
+    record(static_cast<uint64_t>(micros > 0 ? micros : 0));
+  }
+
+  uint64_t
+  getCount() const noexcept
+  {
+    return m_count.load(std::memory_order_relaxed);
+  }
+
+  /*! \brief Returns the sum of all recorded values, in microseconds.
+   */
+  uint64_t
+  getSum() const noexcept
+  {
+    return m_sum.load(std::memory_order_relaxed);
+  }
+
+  uint64_t
+  getBucketCount(size_t index) const noexcept
+  {
+    return m_buckets[index].load(std::memory_order_relaxed);
+  }
+
+  /*! \brief Returns the number of recorded values smaller than or equal to \p micros.
+   *
+   * \p micros is rounded up to a bucket upper bound; every power of two is one.
+   */
+  uint64_t
+  getCountAtMost(uint64_t micros) const noexcept;
+
+  /*! \brief Returns an upper-bound estimate of quantile \p q (0 <= q <= 1), in microseconds.
+   */
+  uint64_t
+  getQuantile(double q) const noexcept;
+
+  static size_t
+  getBucketIndex(uint64_t value) noexcept;
+
+  /*! \brief Returns the largest value that maps to bucket \p index.
+   */
+  static uint64_t
+  getBucketUpperBound(size_t index) noexcept;
+
+private:
+  std::array<std::atomic<uint64_t>, BUCKET_COUNT> m_buckets{};
+  std::atomic<uint64_t> m_count{0};
+  std::atomic<uint64_t> m_sum{0};
+};
+
+/*! \brief Records the time elapsed between construction and destruction into a Histogram.
+ */
+class ScopedTimer : boost::noncopyable
+{
+public:
+  explicit
+  ScopedTimer(Histogram& histogram)
+    : m_histogram(histogram)
+    , m_start(ndn::time::steady_clock::now())
+  {
+  }
+
+  ~ScopedTimer()
+  {
+    m_histogram.record(ndn::time::steady_clock::now() - m_start);
+  }
+
+private:
+  Histogram& m_histogram;
+  ndn::time::steady_clock::time_point m_start;
+};
+
+/*! \brief Process-wide collection of named metrics.
+ *
+ * Metrics are registered once, typically at static-initialization time next to
+ * the code that updates them, and are then updated through the returned
+ * reference without touching the registry again. Registering the same name and
+ * label set twice returns the existing metric.
+ *
+ * Names follow Prometheus conventions: durations are exported in seconds
+ * (suffix "_seconds"), counters carry the suffix "_total".
+ */
+class Registry : boost::noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /*! \brief Returns the process-wide registry.
+   */
+  static Registry&
+  get();
+
+  /*! \param labels Prometheus label set without braces, e.g. `type="name"`.
+   */
+  Counter&
+  addCounter(const std::string& name, const std::string& help,
+             const std::string& labels = "");
+
+  Gauge&
+  addGauge(const std::string& name, const std::string& help,
+           const std::string& labels = "");
+
+  Histogram&
+  addHistogram(const std::string& name, const std::string& help,
+               const std::string& labels = "");
+
+  using Collector = std::function<void()>;
+
+  /*! \brief Registers a callback invoked before each exposition.
+   *
+   * Collectors refresh gauges that are too expensive to keep up to date on
+   * every change, e.g. memory estimates that require walking a table.
+   *
+   * \return an identifier to pass to removeCollector()
+   */
+  uint64_t
+  addCollector(Collector collector);
+
+  void
+  removeCollector(uint64_t id);
+
+  /*! \brief Writes all metrics in the Prometheus text exposition format (version 0.0.4).
+   */
+  void
+  writePrometheus(std::ostream& os) const;
+
+private:
+  enum class Type {
+    COUNTER,
+    GAUGE,
+    HISTOGRAM,
+  };
+
+  struct Family
+  {
+    Type type;
+    std::string help;
+    std::map<std::string, std::unique_ptr<Counter>> counters;
+    std::map<std::string, std::unique_ptr<Gauge>> gauges;
+    std::map<std::string, std::unique_ptr<Histogram>> histograms;
+  };
+
+  Family&
+  findOrInsertFamily(const std::string& name, const std::string& help, Type type);
+
+private:
+  mutable std::mutex m_mutex;
+  std::map<std::string, Family> m_families;
+  std::map<uint64_t, Collector> m_collectors;
+  uint64_t m_lastCollectorId = 0;
+};
+
+/*! \brief Registers a Registry::Collector for the lifetime of this object.
+ */
+class ScopedCollector : boost::noncopyable
+{
+public:
+  ScopedCollector(Registry& registry, Registry::Collector collector)
+    : m_registry(registry)
+    , m_id(registry.addCollector(std::move(collector)))
+  {
+  }
+
+  ~ScopedCollector()
+  {
+    m_registry.removeCollector(m_id);
+  }
+
+private:
+  Registry& m_registry;
+  uint64_t m_id;
+};
+
+} // namespace nlsr::metrics
+
+#endif // NLSR_METRICS_METRICS_REGISTRY_HPP
@@ -0,0 +1,84 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "startup-timeline.hpp"
+#include "logger.hpp"
+
+namespace nlsr::metrics {
+
+INIT_LOGGER(metrics.StartupTimeline);
+
+StartupTimeline&
+StartupTimeline::get()
+{
+  static StartupTimeline timeline;
+  return timeline;
+}
+
+StartupTimeline::StartupTimeline()
+  : m_start(ndn::time::steady_clock::now())
+{
+  for (size_t i = 0; i < N_MILESTONES; ++i) {
+    m_histograms[i] = &Registry::get().addHistogram("nlsr_startup_seconds",
+      "Time from startup to each bootstrap milestone",
+      std::string("milestone=\"") + toString(static_cast<Milestone>(i)) + '"');
+  }
+}
+
+void
+StartupTimeline::start()
+{
+  m_start = ndn::time::steady_clock::now();
+  m_elapsed.fill(std::nullopt);
+}
+
+void
+StartupTimeline::mark(Milestone milestone)
+{
+  auto& elapsed = m_elapsed[static_cast<size_t>(milestone)];
+  if (elapsed) {
+    return;
+  }
+  elapsed = ndn::time::steady_clock::now() - m_start;
+  m_histograms[static_cast<size_t>(milestone)]->record(*elapsed);
+  NLSR_LOG_INFO("Startup milestone " << toString(milestone) << " reached after " <<
+                ndn::time::duration_cast<ndn::time::milliseconds>(*elapsed));
+}
+
+const char*
+StartupTimeline::toString(Milestone milestone)
+{
+  switch (milestone) {
+  case Milestone::FACES_READY:
+    return "faces_ready";
+  case Milestone::FIRST_HELLO:
+    return "first_hello";
+  case Milestone::NEIGHBORS_PROBED:
+    return "neighbors_probed";
+  case Milestone::FIRST_ADJ_LSA:
+    return "first_adj_lsa";
+  case Milestone::FIRST_ROUTE:
+    return "first_route";
+  }
+  return "unknown";
+}
+
+} // namespace nlsr::metrics
@@ -0,0 +1,90 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_METRICS_STARTUP_TIMELINE_HPP
+#define NLSR_METRICS_STARTUP_TIMELINE_HPP
+
+#include "metrics-registry.hpp"
+
+#include <array>
+#include <optional>
+
+namespace nlsr::metrics {
+
+/*! \brief Records when the router reaches each step of its bootstrap.
+ *
+ * Each milestone is recorded once per start, as the time elapsed since start(),
+ * into the nlsr_startup_seconds histogram labeled with the milestone name.
+ */
+class StartupTimeline : boost::noncopyable
+{
+public:
+  enum class Milestone {
+    /// The first face dataset has been processed
+    FACES_READY,
+    /// A neighbor answered a Hello Interest
+    FIRST_HELLO,
+    /// Every neighbor answered a Hello Interest or timed out
+    NEIGHBORS_PROBED,
+    /// This router originated its first adjacency LSA
+    FIRST_ADJ_LSA,
+    /// The first route computed from the LSDB was installed in the FIB
+    FIRST_ROUTE,
+  };
+
+  static constexpr size_t N_MILESTONES = static_cast<size_t>(Milestone::FIRST_ROUTE) + 1;
+
+  /*! \brief Returns the process-wide timeline.
+   */
+  static StartupTimeline&
+  get();
+
+  /*! \brief Starts a new timeline, forgetting the milestones already reached.
+   */
+  void
+  start();
+
+  /*! \brief Records \p milestone, unless it was already reached since start().
+   */
+  void
+  mark(Milestone milestone);
+
+  std::optional<ndn::time::nanoseconds>
+  getElapsed(Milestone milestone) const
+  {
+    return m_elapsed[static_cast<size_t>(milestone)];
+  }
+
+  static const char*
+  toString(Milestone milestone);
+
+private:
+  StartupTimeline();
+
+private:
+  ndn::time::steady_clock::time_point m_start;
+  std::array<std::optional<ndn::time::nanoseconds>, N_MILESTONES> m_elapsed;
+  std::array<Histogram*, N_MILESTONES> m_histograms;
+};
+
+} // namespace nlsr::metrics
+
+#endif // NLSR_METRICS_STARTUP_TIMELINE_HPP
@@ -23,6 +23,9 @@
 #include "common.hpp"
 #include "tlv-nlsr.hpp"
 
+#include <algorithm>
+#include <limits>
+
 namespace nlsr {
 
 NamePrefixList::NamePrefixList() = default;
@@ -34,33 +37,88 @@ NamePrefixList::NamePrefixList(std::initializer_list<ndn::Name> names)
   }
 }
 
+NamePrefixList::SourceMask
+NamePrefixList::getSourceBit(const std::string& source)
+{
+  auto& names = getSourceNames();
+  auto it = std::find(names.begin(), names.end(), source);
+  if (it == names.end()) {
+    if (names.size() == std::numeric_limits<SourceMask>::digits) {
+      NDN_THROW(std::length_error("Too many distinct name prefix sources"));
+    }
+    it = names.insert(names.end(), source);
+  }
+  return SourceMask(1) << std::distance(names.begin(), it);
+}
+
+std::vector<std::string>&
+NamePrefixList::getSourceNames()
+{
+  static std::vector<std::string> names;
+  return names;
+}
+
+std::vector<PrefixInfo>::const_iterator
+NamePrefixList::lowerBound(const ndn::Name& name) const
+{
+  return std::lower_bound(m_prefixes.begin(), m_prefixes.end(), name,
+                          [] (const PrefixInfo& info, const ndn::Name& name) {
+                            return info.getName() < name;
+                          });
+}
+
+bool
+NamePrefixList::insertAt(size_t pos, const PrefixInfo& info, SourceMask bit)
+{
+  if (pos < m_prefixes.size() && m_prefixes[pos].getName() == info.getName()) {
+    m_prefixes[pos] = info;
+    bool isNew = (m_sources[pos] & bit) == 0;
+    m_sources[pos] |= bit;
+    return isNew;
+  }
+  m_prefixes.insert(m_prefixes.begin() + pos, info);
+  m_sources.insert(m_sources.begin() + pos, bit);
+  return true;
+}
+
 bool
 NamePrefixList::insert(const ndn::Name& name, const std::string& source, double cost)
 {
-  auto& soucePrefixInfo = m_namesSources[name];
-  soucePrefixInfo.costObj = PrefixInfo(name, cost);
-  return soucePrefixInfo.sources.insert(source).second;
+  return insert(PrefixInfo(name, cost), source);
 }
 
 bool
 NamePrefixList::insert(const PrefixInfo& nameCost)
 {
-  auto& soucePrefixInfo = m_namesSources[nameCost.getName()];
-  soucePrefixInfo.costObj = nameCost;
-  return soucePrefixInfo.sources.insert("").second;
+  return insert(nameCost, "");
+}
+
+bool
+NamePrefixList::insert(const PrefixInfo& nameCost, const std::string& source)
+{
+  auto bit = getSourceBit(source);
+  // Lists are usually built in canonical order, e.g. when decoding a Name LSA
+  if (m_prefixes.empty() || m_prefixes.back().getName() < nameCost.getName()) {
+    return insertAt(m_prefixes.size(), nameCost, bit);
+  }
+  return insertAt(std::distance(m_prefixes.cbegin(), lowerBound(nameCost.getName())), nameCost, bit);
 }
 
 bool
 NamePrefixList::erase(const ndn::Name& name, const std::string& source)
 {
-  auto it = m_namesSources.find(name);
-  if (it == m_namesSources.end()) {
+  auto it = lowerBound(name);
+  if (it == m_prefixes.end() || it->getName() != name) {
     return false;
   }
 
-  bool isRemoved = it->second.sources.erase(source);
-  if (it->second.sources.empty()) {
-    m_namesSources.erase(it);
+  size_t pos = std::distance(m_prefixes.cbegin(), it);
+  auto bit = getSourceBit(source);
+  bool isRemoved = (m_sources[pos] & bit) != 0;
+  m_sources[pos] &= ~bit;
+  if (m_sources[pos] == 0) {
+    m_prefixes.erase(it);
+    m_sources.erase(m_sources.begin() + pos);
   }
   return isRemoved;
 }
@@ -68,40 +126,38 @@ NamePrefixList::erase(const ndn::Name& name, const std::string& source)
 const PrefixInfo&
 NamePrefixList::getPrefixInfoForName(const ndn::Name& name) const
 {
-  auto it = m_namesSources.find(name);
-  BOOST_ASSERT(it != m_namesSources.end());
-  return it->second.costObj;
+  auto it = lowerBound(name);
+  BOOST_ASSERT(it != m_prefixes.end() && it->getName() == name);
+  return *it;
 }
 
 std::list<ndn::Name>
 NamePrefixList::getNames() const
 {
   std::list<ndn::Name> names;
-  for (const auto& [name, sources] : m_namesSources) {
-    names.emplace_back(name);
+  for (const auto& info : m_prefixes) {
+    names.emplace_back(info.getName());
   }
   return names;
 }
 
-std::list<PrefixInfo>
-NamePrefixList::getPrefixInfo() const
-{
-  std::list<PrefixInfo> nameCosts;
-  for (const auto& [name, soucePrefixInfo] : m_namesSources) {
-    nameCosts.emplace_back(name, soucePrefixInfo.costObj.getCost());
-  }
-  return nameCosts;
-}
-
 #ifdef WITH_TESTS
 
 std::set<std::string>
 NamePrefixList::getSources(const ndn::Name& name) const
 {
-  if (auto it = m_namesSources.find(name); it != m_namesSources.end()) {
-    return it->second.sources;
+  std::set<std::string> sources;
+  auto it = lowerBound(name);
+  if (it != m_prefixes.end() && it->getName() == name) {
+    auto mask = m_sources[std::distance(m_prefixes.cbegin(), it)];
+    const auto& names = getSourceNames();
+    for (size_t i = 0; i < names.size(); ++i) {
+      if (mask & (SourceMask(1) << i)) {
+        sources.insert(names[i]);
+      }
+    }
   }
-  return {};
+  return sources;
 }
 
 #endif
@@ -109,11 +165,14 @@ NamePrefixList::getSources(const ndn::Name& name) const
 std::ostream&
 operator<<(std::ostream& os, const NamePrefixList& list)
 {
+  const auto& sourceNames = NamePrefixList::getSourceNames();
   os << "Name prefix list: {\n";
-  for (const auto& [name, sources] : list.m_namesSources) {
-    os << name << "\nSources:\n";
-    for (const auto& source : sources.sources) {
-      os << "  " << source << "\n";
+  for (size_t i = 0; i < list.m_prefixes.size(); ++i) {
+    os << list.m_prefixes[i].getName() << "\nSources:\n";
+    for (size_t bit = 0; bit < sourceNames.size(); ++bit) {
+      if (list.m_sources[i] & (NamePrefixList::SourceMask(1) << bit)) {
+        os << "  " << sourceNames[bit] << "\n";
+      }
     }
   }
   os << "}" << std::endl;
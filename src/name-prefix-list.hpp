@@ -30,9 +30,9 @@
 
 #include <initializer_list>
 #include <list>
-#include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace nlsr {
 
@@ -99,6 +99,13 @@ private:
   mutable ndn::Block m_wire;
 };
 
+/*! \brief The set of name prefixes advertised by a router, each with a cost and the
+ *         sources that requested it.
+ *
+ * Entries are kept in a vector sorted by name, so that lookups are binary searches,
+ * iteration is sequential and two lists can be compared in a single merge pass.
+ * Sources are interned process-wide and stored as a bitmask per entry.
+ */
 class NamePrefixList : private boost::equality_comparable<NamePrefixList>
 {
 public:
@@ -117,6 +124,9 @@ public:
   bool
   insert(const PrefixInfo& nameCost);
 
+  bool
+  insert(const PrefixInfo& nameCost, const std::string& source);
+
   /*! \brief Deletes name and source combination
       \retval true Name and source combination is deleted.
       \retval false Name and source combination does not exist.
@@ -127,17 +137,37 @@ public:
   size_t
   size() const
   {
-    return m_namesSources.size();
+    return m_prefixes.size();
   }
 
   const PrefixInfo&
   getPrefixInfoForName(const ndn::Name& name) const;
 
+  /*! \brief Returns a copy of the names, in canonical order.
+   */
   std::list<ndn::Name>
   getNames() const;
 
-  std::list<PrefixInfo>
-  getPrefixInfo() const;
+  /*! \brief Returns the entries in canonical name order, without copying.
+   */
+  const std::vector<PrefixInfo>&
+  getPrefixInfo() const
+  {
+    return m_prefixes;
+  }
+
+  /*! \brief Makes this list contain the names of \p other, in a single merge pass.
+
+      Names present in both lists keep their current cost and sources, names only in
+      \p other are inserted with the default source, and names only in this list are
+      removed. \p onAdded and \p onRemoved are invoked with each such PrefixInfo,
+      in name order.
+
+      \return whether any name was added or removed
+   */
+  template<typename OnAdded, typename OnRemoved>
+  bool
+  mergeFrom(const NamePrefixList& other, const OnAdded& onAdded, const OnRemoved& onRemoved);
 
 #ifdef WITH_TESTS
   /*! Returns the sources that this name has.
@@ -150,9 +180,30 @@ public:
   void
   clear()
   {
-    m_namesSources.clear();
+    m_prefixes.clear();
+    m_sources.clear();
   }
 
+private:
+  using SourceMask = uint64_t;
+
+  /*! \brief Returns the bit assigned to \p source, assigning one if needed.
+      \throw std::length_error more than 64 distinct sources are in use
+   */
+  static SourceMask
+  getSourceBit(const std::string& source);
+
+  /*! \brief Returns the interned sources, indexed by bit position.
+   */
+  static std::vector<std::string>&
+  getSourceNames();
+
+  std::vector<PrefixInfo>::const_iterator
+  lowerBound(const ndn::Name& name) const;
+
+  bool
+  insertAt(size_t pos, const PrefixInfo& info, SourceMask bit);
+
 private: // non-member operators
   // NOTE: the following "hidden friend" operators are available via
   //       argument-dependent lookup only and must be defined inline.
@@ -161,24 +212,64 @@ private: // non-member operators
   friend bool
   operator==(const NamePrefixList& lhs, const NamePrefixList& rhs)
   {
-    return lhs.getPrefixInfo() == rhs.getPrefixInfo();
+    return lhs.m_prefixes == rhs.m_prefixes;
   }
 
-  struct PrefixInfoSource
-  {
-    std::set<std::string> sources;
-    // Because NFD only readvertises each prefix once, this will be the first cost
-    // announced via NFD
-    PrefixInfo costObj;
-  };
-
 private:
-  std::map<ndn::Name, PrefixInfoSource> m_namesSources;
+  // Sorted by name; m_sources[i] holds the sources of m_prefixes[i].
+  // Because NFD only readvertises each prefix once, the cost is the first one
+  // announced via NFD
+  std::vector<PrefixInfo> m_prefixes;
+  std::vector<SourceMask> m_sources;
 
   friend std::ostream&
   operator<<(std::ostream& os, const NamePrefixList& list);
 };
 
+template<typename OnAdded, typename OnRemoved>
+bool
+NamePrefixList::mergeFrom(const NamePrefixList& other, const OnAdded& onAdded,
+                          const OnRemoved& onRemoved)
+{
+  static const SourceMask defaultSource = getSourceBit("");
+
+  std::vector<PrefixInfo> prefixes;
+  std::vector<SourceMask> sources;
+  prefixes.reserve(other.size());
+  sources.reserve(other.size());
+
+  bool isChanged = false;
+  size_t i = 0;
+  size_t j = 0;
+  while (i < m_prefixes.size() || j < other.m_prefixes.size()) {
+    int order = i == m_prefixes.size() ? 1 :
+                j == other.m_prefixes.size() ? -1 :
+                m_prefixes[i].getName().compare(other.m_prefixes[j].getName());
+    if (order < 0) {
+      onRemoved(m_prefixes[i]);
+      isChanged = true;
+      ++i;
+    }
+    else if (order > 0) {
+      onAdded(other.m_prefixes[j]);
+      prefixes.push_back(other.m_prefixes[j]);
+      sources.push_back(defaultSource);
+      isChanged = true;
+      ++j;
+    }
+    else {
+      prefixes.push_back(std::move(m_prefixes[i]));
+      sources.push_back(m_sources[i]);
+      ++i;
+      ++j;
+    }
+  }
+
+  m_prefixes = std::move(prefixes);
+  m_sources = std::move(sources);
+  return isChanged;
+}
+
 NDN_CXX_DECLARE_WIRE_ENCODE_INSTANTIATIONS(PrefixInfo);
 
 } // namespace nlsr
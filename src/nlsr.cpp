@@ -7,7 +7,10 @@
 
 #include "nlsr.hpp"
 #include "adjacent.hpp"
+#include "area.hpp"
+#include "conf-file-processor.hpp"
 #include "logger.hpp"
+#include "metrics/startup-timeline.hpp"
 
 #include <cstdlib>
 #include <cstdio>
@@ -21,24 +24,34 @@ namespace nlsr {
 
 INIT_LOGGER(Nlsr);
 
+// Several notifications are usually lost together, wait for the stream to recover
+constexpr ndn::time::seconds FACE_RESYNC_DELAY = 1_s;
+
 Nlsr::Nlsr(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam)
   : m_face(face)
+  , m_keyChain(keyChain)
   , m_scheduler(face.getIoContext())
   , m_confParam(confParam)
   , m_adjacencyList(confParam.getAdjacencyList())
   , m_namePrefixList(confParam.getNamePrefixList())
+  , m_confReloader(confParam)
+  , m_admission(m_face.getIoContext(), m_confParam,
+                [this] { return m_eventLoopMonitor.getLag(); })
   , m_fib(m_face, m_scheduler, m_adjacencyList, m_confParam, keyChain)
-  , m_lsdb(m_face, keyChain, m_confParam)
+  , m_lsdb(m_face, keyChain, m_confParam, m_statistics, m_admission)
   , m_routingTable(m_scheduler, m_lsdb, m_confParam)
+  , m_whatIfAnalyzer(m_lsdb, m_confParam)
   , m_namePrefixTable(confParam.getRouterPrefix(), m_fib, m_routingTable,
                       m_routingTable.afterRoutingChange, m_lsdb.onLsdbModified)
-  , m_helloProtocol(m_face, keyChain, confParam, m_routingTable, m_lsdb, *this)
+  , m_helloProtocol(m_face, keyChain, confParam, m_routingTable, m_lsdb, m_statistics, *this,
+                    m_admission)
   , m_linkCostManager(std::make_unique<LinkCostManager>(m_face, keyChain, m_confParam, 
-                                                       m_adjacencyList, m_lsdb, m_routingTable, m_fib))
+                                                       m_adjacencyList, m_lsdb, m_routingTable, m_fib,
+                                                       m_admission))
   , m_onNewLsaConnection(m_lsdb.getSync().onNewLsa.connect(
       [this] (const ndn::Name& updateName, uint64_t sequenceNumber,
               const ndn::Name& originRouter, uint64_t incomingFaceId) {
-        registerStrategyForCerts(originRouter);
+        registerStrategyForCerts(area::getAdvertisingRouter(originRouter));
       }))
   , m_onPrefixRegistrationSuccess(m_fib.onPrefixRegistrationSuccess.connect(
       [this] (const ndn::Name& name) {
@@ -53,7 +66,9 @@ Nlsr::Nlsr(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam)
         }
       }))
   , m_dispatcher(m_face, keyChain)
-  , m_datasetHandler(m_dispatcher, m_lsdb, m_routingTable)
+  , m_datasetHandler(m_dispatcher, m_lsdb, m_routingTable, m_whatIfAnalyzer, m_statistics,
+                     m_adjacencyList, [this] (metrics::MemoryReport& report) { accountMemory(report); },
+                     m_admission)
   , m_controller(m_face, keyChain)
   , m_faceDatasetController(m_face, keyChain)
   , m_prefixUpdateProcessor(m_dispatcher,
@@ -63,19 +78,38 @@ Nlsr::Nlsr(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam)
       m_confParam.getConfFileNameDynamic())
   , m_nfdRibCommandProcessor(m_dispatcher,
       m_namePrefixList,
-      m_lsdb)
-  , m_statsCollector(m_lsdb, m_helloProtocol)
+      m_lsdb,
+      m_face.getIoContext())
+  , m_eventLoopMonitor(m_face.getIoContext(), m_confParam.getEventLoopHeartbeat(),
+                       m_confParam.getSlowHandlerThreshold())
+  , m_memoryCollector(metrics::Registry::get(), [this] {
+      metrics::MemoryReport report;
+      accountMemory(report);
+      report.publish(metrics::Registry::get());
+    })
   , m_faceMonitor(m_face)
   , m_terminateSignals(face.getIoContext(), SIGINT, SIGTERM)
+  , m_reloadSignals(face.getIoContext(), SIGHUP)
 {
   NLSR_LOG_DEBUG("Initializing Nlsr");
+  metrics::StartupTimeline::get().start();
 
   m_faceMonitor.onNotification.connect(std::bind(&Nlsr::onFaceEventNotification, this, _1));
+  // After a Nack or an undecodable notification, the subscriber resumes from the latest
+  // notification, so the events in between are lost. A timeout only means that no
+  // event was published during the Interest lifetime.
+  m_faceMonitor.onNack.connect([this] (const auto&) { scheduleFaceResync(); });
+  m_faceMonitor.onDecodeError.connect([this] (const auto&) { scheduleFaceResync(); });
   m_faceMonitor.start();
 
   m_fib.setStrategy(m_confParam.getLsaPrefix(), Fib::MULTICAST_STRATEGY, 0);
   m_fib.setStrategy(m_confParam.getSyncPrefix(), Fib::MULTICAST_STRATEGY, 0);
 
+  if (m_confParam.isAreaBorderRouter()) {
+    m_areaSummarizer = std::make_unique<AreaSummarizer>(m_scheduler, m_lsdb, m_confParam,
+                                                        m_routingTable.afterRoutingChange);
+  }
+
   NLSR_LOG_DEBUG("Default NLSR identity: " << m_confParam.getSigningInfo().getSignerName());
 
   addDispatcherTopPrefix(ndn::Name(m_confParam.getRouterPrefix()).append("nlsr"));
@@ -83,9 +117,36 @@ Nlsr::Nlsr(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam)
 
   enableIncomingFaceIdIndication();
 
+  auto& readvertisePolicy = m_nfdRibCommandProcessor.getPolicy();
+  readvertisePolicy.setHoldDown(m_confParam.getReadvertiseHoldDown());
+  readvertisePolicy.setMaxChangesPerSecond(m_confParam.getReadvertiseMaxChangesPerSecond());
+  for (const auto& aggregate : m_confParam.getReadvertiseAggregates()) {
+    readvertisePolicy.addAggregate(aggregate);
+  }
+
+  if (!m_confParam.getMetricsFile().empty() || !m_confParam.getMetricsSocket().empty()) {
+    m_metricsExporter = std::make_unique<metrics::MetricsExporter>(m_face.getIoContext(),
+                                                                   metrics::Registry::get());
+    try {
+      if (!m_confParam.getMetricsFile().empty()) {
+        m_metricsExporter->enableFileExport(m_confParam.getMetricsFile(),
+                                            m_confParam.getMetricsFileInterval());
+      }
+      if (!m_confParam.getMetricsSocket().empty()) {
+        m_metricsExporter->enableSocketExport(m_confParam.getMetricsSocket());
+      }
+    }
+    catch (const std::exception& e) {
+      NLSR_LOG_ERROR("Cannot enable metrics export: " << e.what());
+    }
+  }
+
+  m_isFaceDatasetFetchPending = true;
   initializeFaces(std::bind(&Nlsr::processFaceDataset, this, _1),
                   std::bind(&Nlsr::onFaceDatasetFetchTimeout, this, _1, _2, 0));
 
+  m_prefixUpdateProcessor.replayJournal();
+
   m_adjacencyList.writeLog();
   NLSR_LOG_DEBUG(m_namePrefixList);
 
@@ -98,6 +159,9 @@ Nlsr::Nlsr(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam)
   m_terminateSignals.async_wait([this] (auto&&... args) {
     terminate(std::forward<decltype(args)>(args)...);
   });
+  m_reloadSignals.async_wait([this] (auto&&... args) {
+    onReloadSignal(std::forward<decltype(args)>(args)...);
+  });
 
   // ✅ 教学要点：HelloProtocol事件连接的重要性
   // 这些连接让LinkCostManager能够实时感知邻居状态变化
@@ -130,21 +194,46 @@ Nlsr::Nlsr(ndn::Face& face, ndn::KeyChain& keyChain, ConfParameter& confParam)
     NLSR_LOG_INFO("🧠 ML-adaptive routing enabled, intelligent learning will start with routing calculations");
   }
 
-  // ✅ 教学要点：延迟启动策略的重要性
-  // LinkCostManager需要在HelloProtocol稳定后才能开始工作
-  // 这确保了邻居发现和状态同步都已经完成
-  m_scheduler.schedule(ndn::time::seconds(100), [this] {
-    m_linkCostManager->initialize();
-    
-    // ✅ 关键：连接成本更新信号，这是智能路由的核心机制
-    m_linkCostManager->onNeighborCostUpdated.connect(
-      [this](const ndn::Name& neighbor, double newCost) {
-        this->onNeighborCostUpdated(neighbor, newCost);
-      });
-    
-    m_linkCostManager->start();
-    NLSR_LOG_INFO("✅ LinkCostManager started - intelligent routing infrastructure ready");
-  });
+  // LinkCostManager starts right away: probing of each neighbor begins with its
+  // first successful hello, so there is no need to wait for hellos to settle
+  m_linkCostManager->initialize();
+  m_linkCostManager->onNeighborCostUpdated.connect(
+    [this] (const ndn::Name& neighbor, double newCost) {
+      this->onNeighborCostUpdated(neighbor, newCost);
+    });
+  m_linkCostManager->start();
+}
+
+void
+Nlsr::accountMemory(metrics::MemoryReport& report) const
+{
+  m_lsdb.accountMemory(report);
+  m_routingTable.accountMemory(report);
+  m_namePrefixTable.accountMemory(report);
+  m_fib.accountMemory(report);
+  if (m_linkCostManager != nullptr) {
+    m_linkCostManager->accountMemory(report);
+  }
+
+  const auto& faceUris = NextHop::getInternedFaceUris();
+  size_t faceUriBytes = faceUris.size() * (metrics::MemoryReport::TREE_NODE_OVERHEAD +
+                                           sizeof(ndn::FaceUri));
+  for (const auto& faceUri : faceUris) {
+    faceUriBytes += metrics::MemoryReport::estimateFaceUri(faceUri);
+  }
+  report.add("nexthop.face-uris", faceUris.size(), faceUriBytes);
+
+  // Every LSA owns an expiration or refresh event, every FIB entry a refresh event and
+  // every neighbor at most one hello event. An event costs its EventInfo, the callback
+  // captured by std::function and the shared_ptr control block, about 128 bytes.
+  constexpr size_t EVENT_SIZE = 128;
+  size_t events = m_adjacencyList.size();
+  for (const char* owner : {"lsdb.lsas", "fib"}) {
+    if (const auto* entry = report.find(owner); entry != nullptr) {
+      events += entry->objects;
+    }
+  }
+  report.add("scheduler.events", events, events * EVENT_SIZE);
 }
 
 // ✅ 教学要点：事件处理方法的设计模式
@@ -224,6 +313,140 @@ Nlsr::terminate(const boost::system::error_code& error, int signalNo)
   m_face.getIoContext().stop();
 }
 
+void
+Nlsr::onReloadSignal(const boost::system::error_code& error, int signalNo)
+{
+  if (error)
+    return;
+  NLSR_LOG_INFO("Caught signal " << signalNo << " (" << ::strsignal(signalNo) << "), "
+                "reloading " << m_confParam.getConfFileName());
+  reloadConfiguration();
+
+  m_reloadSignals.async_wait([this] (auto&&... args) {
+    onReloadSignal(std::forward<decltype(args)>(args)...);
+  });
+}
+
+bool
+Nlsr::reloadConfiguration()
+{
+  ConfParameter candidate(m_face, m_keyChain, m_confParam.getConfFileName());
+  ConfFileProcessor processor(candidate);
+  if (!processor.processConfFileForReload()) {
+    NLSR_LOG_ERROR("Invalid configuration file, keeping the running configuration");
+    return false;
+  }
+
+  auto diff = m_confReloader.computeDiff(candidate);
+  for (const auto& option : diff.ignoredOptions) {
+    NLSR_LOG_WARN("Change of " << option << " takes effect after a restart");
+  }
+  if (diff.empty()) {
+    NLSR_LOG_INFO("No configuration change to apply");
+    return true;
+  }
+  m_confReloader.commit(candidate);
+
+  if (diff.areTimersChanged) {
+    NLSR_LOG_INFO("Applying new timers");
+    m_lsdb.setAdjLsaBuildInterval(ndn::time::seconds(m_confParam.getAdjLsaBuildInterval()));
+    m_lsdb.setLsaRefreshTime(ndn::time::seconds(m_confParam.getLsaRefreshTime()));
+    m_routingTable.setRoutingCalcInterval(ndn::time::seconds(m_confParam.getRoutingCalcInterval()));
+    m_fib.setEntryRefreshTime(2 * m_confParam.getLsaRefreshTime());
+
+    auto& readvertisePolicy = m_nfdRibCommandProcessor.getPolicy();
+    readvertisePolicy.setHoldDown(m_confParam.getReadvertiseHoldDown());
+    readvertisePolicy.setMaxChangesPerSecond(m_confParam.getReadvertiseMaxChangesPerSecond());
+  }
+
+  bool isAdjLsaChanged = false;
+  for (const auto& neighbor : diff.removedNeighbors) {
+    isAdjLsaChanged |= removeNeighbor(neighbor);
+  }
+  for (const auto& adjacent : diff.addedNeighbors) {
+    addNeighbor(adjacent);
+  }
+  if (!diff.addedNeighbors.empty()) {
+    // the faces of the new neighbors may already exist
+    assignFaces();
+  }
+
+  // With hyperbolic routing, link costs are not used
+  if (m_confParam.getHyperbolicState() != HYPERBOLIC_STATE_ON) {
+    for (const auto& changed : diff.changedNeighbors) {
+      auto adjacent = m_adjacencyList.findAdjacent(changed.getName());
+      if (adjacent == m_adjacencyList.end()) {
+        continue;
+      }
+      NLSR_LOG_INFO("Link cost of " << changed.getName() << " changed to " << changed.getLinkCost());
+      adjacent->setLinkCost(changed.getLinkCost());
+      adjacent->setTopologyCosts(changed.getTopologyCosts());
+      m_linkCostManager->setOriginalLinkCost(changed.getName(), changed.getLinkCost());
+      if (adjacent->getFaceId() != 0) {
+        registerAdjacencyPrefixes(*adjacent, ndn::time::milliseconds::max());
+      }
+      isAdjLsaChanged |= adjacent->getStatus() == Adjacent::STATUS_ACTIVE;
+    }
+  }
+
+  if (isAdjLsaChanged) {
+    if (m_confParam.getHyperbolicState() == HYPERBOLIC_STATE_ON) {
+      m_routingTable.scheduleRoutingTableCalculation();
+    }
+    else {
+      m_lsdb.scheduleAdjLsaBuild();
+    }
+  }
+
+  bool isNameLsaChanged = false;
+  for (const auto& prefix : diff.addedPrefixes) {
+    NLSR_LOG_INFO("Advertising " << prefix);
+    isNameLsaChanged |= m_namePrefixList.insert(prefix);
+  }
+  for (const auto& prefix : diff.removedPrefixes) {
+    NLSR_LOG_INFO("Withdrawing " << prefix);
+    isNameLsaChanged |= m_namePrefixList.erase(prefix);
+  }
+  if (isNameLsaChanged) {
+    m_lsdb.scheduleNameLsaBuild();
+  }
+
+  return true;
+}
+
+void
+Nlsr::addNeighbor(const Adjacent& adjacent)
+{
+  NLSR_LOG_INFO("Adding neighbor " << adjacent.getName() << " at " << adjacent.getFaceUri());
+  Adjacent neighbor(adjacent);
+  if (m_confParam.getHyperbolicState() == HYPERBOLIC_STATE_ON) {
+    neighbor.setLinkCost(0);
+  }
+  m_adjacencyList.insert(neighbor);
+  m_linkCostManager->addNeighbor(neighbor);
+}
+
+bool
+Nlsr::removeNeighbor(const ndn::Name& neighbor)
+{
+  auto adjacent = m_adjacencyList.findAdjacent(neighbor);
+  if (adjacent == m_adjacencyList.end()) {
+    return false;
+  }
+
+  NLSR_LOG_INFO("Removing neighbor " << neighbor);
+  bool wasActive = adjacent->getStatus() == Adjacent::STATUS_ACTIVE;
+  if (adjacent->getFaceId() != 0) {
+    // the face itself may still be in use, only the routes of NLSR are removed
+    m_fib.unregisterPrefix(neighbor, adjacent->getFaceUri());
+    m_fib.unregisterPrefix(m_confParam.getLsaPrefix(), adjacent->getFaceUri());
+    m_fib.unregisterPrefix(m_confParam.getSyncPrefix(), adjacent->getFaceUri());
+  }
+  m_linkCostManager->removeNeighbor(neighbor);
+  m_adjacencyList.erase(neighbor);
+  return wasActive;
+}
+
 // ✅ 其余方法保持完全不变，维持系统的稳定性
 void
 Nlsr::registerStrategyForCerts(const ndn::Name& originRouter)
@@ -291,27 +514,9 @@ Nlsr::onFaceEventNotification(const ndn::nfd::FaceEventNotification& faceEventNo
 
   switch (faceEventNotification.getKind()) {
     case ndn::nfd::FACE_EVENT_DESTROYED: {
-      uint64_t faceId = faceEventNotification.getFaceId();
-
-      auto adjacent = m_adjacencyList.findAdjacent(faceId);
-
-      if (adjacent != m_adjacencyList.end()) {
-        NLSR_LOG_DEBUG("Face to " << adjacent->getName() << " with face id: " << faceId << " destroyed");
-
-        adjacent->setFaceId(0);
-
-        if (adjacent->getStatus() == Adjacent::STATUS_ACTIVE) {
-          adjacent->setStatus(Adjacent::STATUS_INACTIVE);
-          adjacent->setInterestTimedOutNo(m_confParam.getInterestRetryNumber());
-
-          if (m_confParam.getHyperbolicState() == HYPERBOLIC_STATE_ON) {
-            m_routingTable.scheduleRoutingTableCalculation();
-          }
-          else {
-            m_lsdb.scheduleAdjLsaBuild();
-          }
-        }
-      }
+      m_faceIndex.erase(faceEventNotification.getFaceId());
+      m_helloFaceIds.erase(faceEventNotification.getFaceId());
+      onFaceDestroyed(faceEventNotification.getFaceId());
       break;
     }
     case ndn::nfd::FACE_EVENT_CREATED: {
@@ -323,18 +528,21 @@ Nlsr::onFaceEventNotification(const ndn::nfd::FaceEventNotification& faceEventNo
         NLSR_LOG_WARN(e.what());
         return;
       }
-      auto adjacent = m_adjacencyList.findAdjacent(faceUri);
       uint64_t faceId = faceEventNotification.getFaceId();
+      m_faceIndex.insert(faceEventNotification.getRemoteUri(), faceId);
+
+      auto adjacent = m_adjacencyList.findAdjacent(faceUri);
 
       if (adjacent != m_adjacencyList.end() &&
           (adjacent->getFaceId() == 0 || adjacent->getFaceId() != faceId))
       {
         NLSR_LOG_DEBUG("Face creation event matches neighbor: " << adjacent->getName()
                         << ". New Face ID: " << faceId << ". Registering prefixes.");
-        adjacent->setFaceId(faceId);
+        m_adjacencyList.setFaceId(adjacent, faceId);
 
         registerAdjacencyPrefixes(*adjacent, ndn::time::milliseconds::max());
       }
+      assignHelloFaces();
       break;
     }
     default:
@@ -354,24 +562,130 @@ void
 Nlsr::processFaceDataset(const std::vector<ndn::nfd::FaceStatus>& faces)
 {
   NLSR_LOG_DEBUG("Processing face dataset");
+  metrics::StartupTimeline::get().mark(metrics::StartupTimeline::Milestone::FACES_READY);
+  m_isFaceDatasetFetchPending = false;
 
-  for (auto&& adjacent : m_adjacencyList.getAdjList()) {
-    const std::string& faceUriString = adjacent.getFaceUri().toString();
-    for (const auto& faceStatus : faces) {
-      if (adjacent.getFaceId() == 0 && faceUriString == faceStatus.getRemoteUri()) {
-        NLSR_LOG_DEBUG("FaceUri: " << faceStatus.getRemoteUri() <<
-                   " FaceId: "<< faceStatus.getFaceId());
-        adjacent.setFaceId(faceStatus.getFaceId());
-        this->registerAdjacencyPrefixes(adjacent, ndn::time::milliseconds::max());
-      }
+  m_faceIndex.reset(faces);
+
+  // faces destroyed while notifications were lost
+  std::vector<uint64_t> destroyed;
+  for (const auto& adjacent : m_adjacencyList.getAdjList()) {
+    if (adjacent.getFaceId() != 0 && !m_faceIndex.contains(adjacent.getFaceId())) {
+      destroyed.push_back(adjacent.getFaceId());
     }
+  }
+  for (uint64_t faceId : destroyed) {
+    onFaceDestroyed(faceId);
+  }
+  for (auto it = m_helloFaceIds.begin(); it != m_helloFaceIds.end();) {
+    it = m_faceIndex.contains(*it) ? std::next(it) : m_helloFaceIds.erase(it);
+  }
+
+  assignFaces();
+
+  for (const auto& adjacent : m_adjacencyList.getAdjList()) {
     if (adjacent.getFaceId() == 0) {
       NLSR_LOG_WARN("The adjacency " << adjacent.getName() <<
                 " has no Face information in this dataset.");
     }
   }
+  // From now on, face event notifications keep the index up to date
+}
 
-  scheduleDatasetFetch();
+void
+Nlsr::assignFaces()
+{
+  for (auto adjacent = m_adjacencyList.getAdjList().begin();
+       adjacent != m_adjacencyList.getAdjList().end(); ++adjacent) {
+    uint64_t faceId = m_faceIndex.getFaceId(adjacent->getFaceUri().toString());
+    if (faceId != 0 && faceId != adjacent->getFaceId()) {
+      NLSR_LOG_DEBUG("FaceUri: " << adjacent->getFaceUri() << " FaceId: " << faceId);
+      m_adjacencyList.setFaceId(adjacent, faceId);
+      this->registerAdjacencyPrefixes(*adjacent, ndn::time::milliseconds::max());
+    }
+  }
+  assignHelloFaces();
+}
+
+void
+Nlsr::assignHelloFaces()
+{
+  for (const auto& adjacent : m_adjacencyList.getAdjList()) {
+    if (!adjacent.isHelloMulticast()) {
+      continue;
+    }
+    uint64_t faceId = m_faceIndex.getFaceId(adjacent.getHelloFaceUri().toString());
+    if (faceId != 0 && m_helloFaceIds.insert(faceId).second) {
+      registerHelloFace(faceId);
+    }
+  }
+}
+
+void
+Nlsr::registerHelloFace(uint64_t faceId)
+{
+  if (m_helloFaceIds.size() == 1) {
+    // one Hello Interest reaches every segment; /localhop keeps it from going further
+    m_fib.setStrategy(m_confParam.getHelloPrefix(), Fib::MULTICAST_STRATEGY, 0);
+  }
+
+  NLSR_LOG_DEBUG("Registering " << m_confParam.getHelloPrefix() << " on multicast face " << faceId);
+  m_controller.start<ndn::nfd::RibRegisterCommand>(
+    ndn::nfd::ControlParameters()
+      .setName(m_confParam.getHelloPrefix())
+      .setFaceId(faceId)
+      .setOrigin(ndn::nfd::ROUTE_ORIGIN_NLSR),
+    [this] (const ndn::nfd::ControlParameters&) {
+      m_helloProtocol.startMulticastHello();
+    },
+    [this, faceId] (const ndn::nfd::ControlResponse& response) {
+      NLSR_LOG_WARN("Failed to register " << m_confParam.getHelloPrefix() << " on face " <<
+                    faceId << " (code: " << response.getCode() << ", reason: " <<
+                    response.getText() << ")");
+      // retried with the next face dataset
+      m_helloFaceIds.erase(faceId);
+    });
+}
+
+void
+Nlsr::onFaceDestroyed(uint64_t faceId)
+{
+  auto adjacent = m_adjacencyList.findAdjacent(faceId);
+  if (adjacent == m_adjacencyList.end()) {
+    return;
+  }
+
+  NLSR_LOG_DEBUG("Face to " << adjacent->getName() << " with face id: " << faceId << " destroyed");
+
+  m_adjacencyList.setFaceId(adjacent, 0);
+
+  if (adjacent->getStatus() == Adjacent::STATUS_ACTIVE) {
+    adjacent->setStatus(Adjacent::STATUS_INACTIVE);
+    adjacent->setInterestTimedOutNo(m_confParam.getInterestRetryNumber());
+
+    if (m_confParam.getHyperbolicState() == HYPERBOLIC_STATE_ON) {
+      m_routingTable.scheduleRoutingTableCalculation();
+    }
+    else {
+      m_lsdb.scheduleAdjLsaBuild();
+    }
+  }
+}
+
+void
+Nlsr::scheduleFaceResync()
+{
+  if (m_isFaceDatasetFetchPending) {
+    return;
+  }
+  NLSR_LOG_DEBUG("Face notifications may have been lost, fetching face dataset in " <<
+                 FACE_RESYNC_DELAY);
+  m_isFaceDatasetFetchPending = true;
+  m_scheduler.schedule(FACE_RESYNC_DELAY, [this] {
+    initializeFaces(
+      [this] (const auto& faces) { processFaceDataset(faces); },
+      [this] (uint32_t code, const std::string& msg) { onFaceDatasetFetchTimeout(code, msg, 0); });
+  });
 }
 
 void
@@ -410,7 +724,7 @@ Nlsr::onFaceDatasetFetchTimeout(uint32_t code,
 void
 Nlsr::scheduleDatasetFetch()
 {
-  NLSR_LOG_DEBUG("Scheduling dataset fetch in " << m_confParam.getFaceDatasetFetchInterval());
+  NLSR_LOG_DEBUG("Scheduling dataset fetch retry in " << m_confParam.getFaceDatasetFetchInterval());
 
   m_scheduler.schedule(m_confParam.getFaceDatasetFetchInterval(), [this] {
     initializeFaces(
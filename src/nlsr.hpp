@@ -9,20 +9,28 @@
 #define NLSR_NLSR_HPP
 
 #include "adjacency-list.hpp"
+#include "admission-controller.hpp"
 #include "conf-parameter.hpp"
+#include "conf-reloader.hpp"
+#include "face-index.hpp"
 #include "hello-protocol.hpp"
 #include "lsdb.hpp"
 #include "name-prefix-list.hpp"
 #include "test-access-control.hpp"
 #include "publisher/dataset-interest-handler.hpp"
 #include "route/fib.hpp"
+#include "route/area-summarizer.hpp"
 #include "route/name-prefix-table.hpp"
 #include "route/routing-table.hpp"
+#include "route/what-if-analyzer.hpp"
 #include "update/prefix-update-processor.hpp"
 #include "update/nfd-rib-command-processor.hpp"
 #include "utility/name-helper.hpp"
-#include "stats-collector.hpp"
+#include "statistics.hpp"
 #include "link-cost-manager.hpp"
+#include "metrics/event-loop-monitor.hpp"
+#include "metrics/memory-report.hpp"
+#include "metrics/metrics-exporter.hpp"
 
 #include <ndn-cxx/face.hpp>
 #include <ndn-cxx/encoding/nfd-constants.hpp>
@@ -37,6 +45,8 @@
 
 #include <boost/asio/signal_set.hpp>
 
+#include <set>
+
 namespace nlsr {
 
 class Nlsr
@@ -70,6 +80,25 @@ public:
   // 只暴露必要的接口，避免不必要的复杂性
   LinkCostManager& getLinkCostManager() { return *m_linkCostManager; }
 
+  /*! \brief Adds the estimated memory usage of every subsystem to \p report.
+   *
+   * The scheduler does not expose its queue, so its row is derived from the
+   * number of objects known to own a pending event.
+   */
+  void
+  accountMemory(metrics::MemoryReport& report) const;
+
+  /*! \brief Rereads the configuration file and applies what changed, without a restart.
+   *
+   * Neighbors are added or removed, configured link costs and advertised prefixes are
+   * updated, and timers take effect from their next use. Options that cannot change at
+   * runtime, such as the router name or the sync protocol, are logged and ignored.
+   *
+   * \return whether the configuration file is valid; if not, nothing is changed
+   */
+  bool
+  reloadConfiguration();
+
 private:
   void
   registerStrategyForCerts(const ndn::Name& originRouter);
@@ -91,6 +120,37 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   processFaceDataset(const std::vector<ndn::nfd::FaceStatus>& faces);
 
 private:
+  /*! \brief Gives every adjacency the Face ID found for its FaceUri in the face index,
+   *         and registers its prefixes on the faces that changed.
+   */
+  void
+  assignFaces();
+
+  /*! \brief Routes the Hello prefix to the multicast faces shared with neighbors, once
+   *         each face appears in the face index.
+   */
+  void
+  assignHelloFaces();
+
+  void
+  registerHelloFace(uint64_t faceId);
+
+  void
+  onFaceDestroyed(uint64_t faceId);
+
+  /*! \brief Fetches the face dataset again, after face event notifications may have been lost.
+   */
+  void
+  scheduleFaceResync();
+
+  void
+  addNeighbor(const Adjacent& adjacent);
+
+  /*! \return whether the neighbor was active, i.e., the adjacency LSA changes
+   */
+  bool
+  removeNeighbor(const ndn::Name& neighbor);
+
   void
   registerAdjacencyPrefixes(const Adjacent& adj, ndn::time::milliseconds timeout);
 
@@ -109,6 +169,9 @@ private:
   void
   terminate(const boost::system::error_code& error, int signalNo);
 
+  void
+  onReloadSignal(const boost::system::error_code& error, int signalNo);
+
 public:
   static inline const ndn::Name LOCALHOST_PREFIX{"/localhost/nlsr"};
 
@@ -123,16 +186,22 @@ public:
 
 private:
   ndn::Face& m_face;
+  ndn::KeyChain& m_keyChain;
   ndn::Scheduler m_scheduler;
   ConfParameter& m_confParam;
   AdjacencyList& m_adjacencyList;
   NamePrefixList& m_namePrefixList;
+  ConfReloader m_confReloader;
   std::vector<ndn::Name> m_strategySetOnRouters;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /// Declared before the components whose Interest filters it admits
+  AdmissionController m_admission;
+  Statistics m_statistics;
   Fib m_fib;
   Lsdb m_lsdb;
   RoutingTable m_routingTable;
+  WhatIfAnalyzer m_whatIfAnalyzer;
   NamePrefixTable m_namePrefixTable;
   HelloProtocol m_helloProtocol;
   
@@ -140,6 +209,8 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   // 将LinkCostManager放在HelloProtocol之后，确保依赖关系正确
   // 这样LinkCostManager可以在构造时安全地引用HelloProtocol相关的组件
   std::unique_ptr<LinkCostManager> m_linkCostManager;
+  /// Only created on an area border router
+  std::unique_ptr<AreaSummarizer> m_areaSummarizer;
 
 private:
   ndn::signal::ScopedConnection m_onNewLsaConnection;
@@ -158,11 +229,18 @@ PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   update::PrefixUpdateProcessor m_prefixUpdateProcessor;
   update::NfdRibCommandProcessor m_nfdRibCommandProcessor;
 
-  StatsCollector m_statsCollector;
-
 private:
+  std::unique_ptr<metrics::MetricsExporter> m_metricsExporter;
+  metrics::EventLoopMonitor m_eventLoopMonitor;
+  metrics::ScopedCollector m_memoryCollector;
   ndn::nfd::FaceMonitor m_faceMonitor;
+  FaceIndex m_faceIndex;
+  /// Multicast faces on which the Hello prefix is registered
+  std::set<uint64_t> m_helloFaceIds;
+  /// Whether a face dataset fetch is scheduled or in progress
+  bool m_isFaceDatasetFetchPending = false;
   boost::asio::signal_set m_terminateSignals;
+  boost::asio::signal_set m_reloadSignals;
   
   // ✅ 教学要点：避免重复的系统级ML对象
   // 之前的设计中考虑过在Nlsr类中添加ML计算器，但这会与RoutingTable中的产生冲突
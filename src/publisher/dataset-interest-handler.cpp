@@ -20,8 +20,12 @@
  */
 
 #include "dataset-interest-handler.hpp"
+#include "admission-controller.hpp"
 #include "nlsr.hpp"
 #include "logger.hpp"
+#include "tlv-nlsr.hpp"
+#include "metrics/event-loop-monitor.hpp"
+#include "metrics/metrics-registry.hpp"
 
 #include <ndn-cxx/mgmt/nfd/control-response.hpp>
 #include <ndn-cxx/util/regex.hpp>
@@ -34,25 +38,63 @@ const ndn::PartialName ADJACENCIES_DATASET{"lsdb/adjacencies"};
 const ndn::PartialName COORDINATES_DATASET{"lsdb/coordinates"};
 const ndn::PartialName NAMES_DATASET{"lsdb/names"};
 const ndn::PartialName RT_DATASET{"routing-table"};
+const ndn::PartialName METRICS_DATASET{"metrics"};
+const ndn::PartialName STATISTICS_DATASET{"statistics"};
+const ndn::PartialName MEMORY_DATASET{"memory"};
+const ndn::PartialName WHATIF_DATASET{"whatif"};
 
 DatasetInterestHandler::DatasetInterestHandler(ndn::mgmt::Dispatcher& dispatcher,
                                                const Lsdb& lsdb,
-                                               const RoutingTable& rt)
+                                               const RoutingTable& rt,
+                                               WhatIfAnalyzer& whatIf,
+                                               const Statistics& stats,
+                                               const AdjacencyList& adjacencies,
+                                               MemoryReporter memoryReporter,
+                                               AdmissionController& admission)
   : m_lsdb(lsdb)
   , m_routingTable(rt)
+  , m_whatIf(whatIf)
+  , m_stats(stats)
+  , m_adjacencies(adjacencies)
+  , m_memoryReporter(std::move(memoryReporter))
 {
   dispatcher.addStatusDataset(ADJACENCIES_DATASET,
-    ndn::mgmt::makeAcceptAllAuthorization(),
+    admission.makeDatasetAuthorization(),
     std::bind(&DatasetInterestHandler::publishLsaStatus<AdjLsa>, this, _1, _2, _3));
   dispatcher.addStatusDataset(COORDINATES_DATASET,
-    ndn::mgmt::makeAcceptAllAuthorization(),
+    admission.makeDatasetAuthorization(),
     std::bind(&DatasetInterestHandler::publishLsaStatus<CoordinateLsa>, this, _1, _2, _3));
   dispatcher.addStatusDataset(NAMES_DATASET,
-    ndn::mgmt::makeAcceptAllAuthorization(),
+    admission.makeDatasetAuthorization(),
     std::bind(&DatasetInterestHandler::publishLsaStatus<NameLsa>, this, _1, _2, _3));
   dispatcher.addStatusDataset(RT_DATASET,
-    ndn::mgmt::makeAcceptAllAuthorization(),
+    admission.makeDatasetAuthorization(),
     std::bind(&DatasetInterestHandler::publishRtStatus, this, _1, _2, _3));
+  dispatcher.addStatusDataset(METRICS_DATASET,
+    admission.makeDatasetAuthorization(),
+    std::bind(&DatasetInterestHandler::publishMetrics, this, _1, _2, _3));
+  dispatcher.addStatusDataset(STATISTICS_DATASET,
+    admission.makeDatasetAuthorization(),
+    std::bind(&DatasetInterestHandler::publishStatistics, this, _1, _2, _3));
+  dispatcher.addStatusDataset(MEMORY_DATASET,
+    admission.makeDatasetAuthorization(),
+    std::bind(&DatasetInterestHandler::publishMemory, this, _1, _2, _3));
+  // A what-if request runs a route computation and tells how the network reacts to
+  // failures, so it is only answered to local operators
+  dispatcher.addStatusDataset(WHATIF_DATASET,
+    [authorization = admission.makeDatasetAuthorization()] (
+        const ndn::Name& prefix, const ndn::Interest& interest,
+        const ndn::mgmt::ControlParametersBase* params,
+        const ndn::mgmt::AcceptContinuation& accept,
+        const ndn::mgmt::RejectContinuation& reject) {
+      if (prefix != Nlsr::LOCALHOST_PREFIX) {
+        NLSR_LOG_DEBUG("Rejecting what-if request " << interest.getName() << " outside " <<
+                       Nlsr::LOCALHOST_PREFIX);
+        return reject(ndn::mgmt::RejectReply::STATUS403);
+      }
+      authorization(prefix, interest, params, accept, reject);
+    },
+    std::bind(&DatasetInterestHandler::publishWhatIf, this, _1, _2, _3));
 }
 
 template <typename T>
@@ -60,6 +102,7 @@ void
 DatasetInterestHandler::publishLsaStatus(const ndn::Name& topPrefix, const ndn::Interest& interest,
                                          ndn::mgmt::StatusDatasetContext& context)
 {
+  metrics::HandlerScope scope(metrics::HandlerTag::DISPATCHER, "publishLsaStatus");
   NLSR_LOG_TRACE("Received interest: " << interest);
   auto lsaRange = m_lsdb.getLsdbIterator<T>();
   for (auto lsaIt = lsaRange.first; lsaIt != lsaRange.second; ++lsaIt) {
@@ -72,9 +115,78 @@ void
 DatasetInterestHandler::publishRtStatus(const ndn::Name& topPrefix, const ndn::Interest& interest,
                                         ndn::mgmt::StatusDatasetContext& context)
 {
+  metrics::HandlerScope scope(metrics::HandlerTag::DISPATCHER, "publishRtStatus");
   NLSR_LOG_TRACE("Received interest: " << interest);
   context.append(m_routingTable.wireEncode());
   context.end();
 }
 
+void
+DatasetInterestHandler::publishMetrics(const ndn::Name& topPrefix, const ndn::Interest& interest,
+                                       ndn::mgmt::StatusDatasetContext& context)
+{
+  metrics::HandlerScope scope(metrics::HandlerTag::DISPATCHER, "publishMetrics");
+  NLSR_LOG_TRACE("Received interest: " << interest);
+  std::ostringstream os;
+  metrics::Registry::get().writePrometheus(os);
+  context.append(ndn::makeStringBlock(tlv::Metrics, os.str()));
+  context.end();
+}
+
+void
+DatasetInterestHandler::publishStatistics(const ndn::Name& topPrefix, const ndn::Interest& interest,
+                                          ndn::mgmt::StatusDatasetContext& context)
+{
+  metrics::HandlerScope scope(metrics::HandlerTag::DISPATCHER, "publishStatistics");
+  NLSR_LOG_TRACE("Received interest: " << interest);
+  std::ostringstream os;
+  printStatistics(os, m_stats, m_adjacencies);
+  context.append(ndn::makeStringBlock(tlv::Statistics, os.str()));
+  context.end();
+}
+
+void
+DatasetInterestHandler::publishMemory(const ndn::Name& topPrefix, const ndn::Interest& interest,
+                                      ndn::mgmt::StatusDatasetContext& context)
+{
+  metrics::HandlerScope scope(metrics::HandlerTag::DISPATCHER, "publishMemory");
+  NLSR_LOG_TRACE("Received interest: " << interest);
+  metrics::MemoryReport report;
+  if (m_memoryReporter) {
+    m_memoryReporter(report);
+  }
+  std::ostringstream os;
+  os << report;
+  context.append(ndn::makeStringBlock(tlv::Memory, os.str()));
+  context.end();
+}
+
+void
+DatasetInterestHandler::publishWhatIf(const ndn::Name& topPrefix, const ndn::Interest& interest,
+                                      ndn::mgmt::StatusDatasetContext& context)
+{
+  metrics::HandlerScope scope(metrics::HandlerTag::DISPATCHER, "publishWhatIf");
+  NLSR_LOG_TRACE("Received interest: " << interest);
+
+  // The changes follow the dataset name, as a TopologyChangeList in one name component
+  size_t changesIndex = topPrefix.size() + WHATIF_DATASET.size();
+  std::vector<TopologyChange> changes;
+  try {
+    if (interest.getName().size() <= changesIndex) {
+      NDN_THROW(TopologyChange::Error("Missing topology changes"));
+    }
+    changes = TopologyChange::decodeList(interest.getName()[changesIndex].blockFromValue());
+  }
+  catch (const ndn::tlv::Error& e) {
+    NLSR_LOG_DEBUG("Cannot decode what-if request: " << e.what());
+    context.reject(ndn::nfd::ControlResponse(400, e.what()));
+    return;
+  }
+
+  std::ostringstream os;
+  os << m_whatIf.analyze(changes);
+  context.append(ndn::makeStringBlock(tlv::WhatIf, os.str()));
+  context.end();
+}
+
 } // namespace nlsr
@@ -34,7 +34,10 @@
 #include "route/routing-table-entry.hpp"
 #include "route/routing-table.hpp"
 #include "route/nexthop-list.hpp"
+#include "route/what-if-analyzer.hpp"
 #include "lsdb.hpp"
+#include "statistics.hpp"
+#include "metrics/memory-report.hpp"
 
 #include <ndn-cxx/face.hpp>
 #include <ndn-cxx/mgmt/dispatcher.hpp>
@@ -42,6 +45,8 @@
 
 namespace nlsr {
 
+class AdmissionController;
+
 namespace dataset {
 inline const ndn::Name::Component ADJACENCY_COMPONENT{"adjacencies"};
 inline const ndn::Name::Component NAME_COMPONENT{"names"};
@@ -62,9 +67,18 @@ public:
     using std::runtime_error::runtime_error;
   };
 
+  /*! \brief Fills a MemoryReport with the current state of every subsystem.
+   */
+  using MemoryReporter = std::function<void(metrics::MemoryReport&)>;
+
   DatasetInterestHandler(ndn::mgmt::Dispatcher& dispatcher,
                          const Lsdb& lsdb,
-                         const RoutingTable& rt);
+                         const RoutingTable& rt,
+                         WhatIfAnalyzer& whatIf,
+                         const Statistics& stats,
+                         const AdjacencyList& adjacencies,
+                         MemoryReporter memoryReporter,
+                         AdmissionController& admission);
 
 private:
   /*! \brief provide routing-table dataset
@@ -80,9 +94,37 @@ private:
   publishLsaStatus(const ndn::Name& topPrefix, const ndn::Interest& interest,
                    ndn::mgmt::StatusDatasetContext& context);
 
+  /*! \brief provide metrics dataset in the Prometheus text format
+   */
+  void
+  publishMetrics(const ndn::Name& topPrefix, const ndn::Interest& interest,
+                 ndn::mgmt::StatusDatasetContext& context);
+
+  /*! \brief provide packet and per-neighbor traffic statistics as text
+   */
+  void
+  publishStatistics(const ndn::Name& topPrefix, const ndn::Interest& interest,
+                    ndn::mgmt::StatusDatasetContext& context);
+
+  /*! \brief provide estimated memory usage per subsystem as text
+   */
+  void
+  publishMemory(const ndn::Name& topPrefix, const ndn::Interest& interest,
+                ndn::mgmt::StatusDatasetContext& context);
+
+  /*! \brief provide the effect of the topology changes carried in the Interest name as text
+   */
+  void
+  publishWhatIf(const ndn::Name& topPrefix, const ndn::Interest& interest,
+                ndn::mgmt::StatusDatasetContext& context);
+
 private:
   const Lsdb& m_lsdb;
   const RoutingTable& m_routingTable;
+  WhatIfAnalyzer& m_whatIf;
+  const Statistics& m_stats;
+  const AdjacencyList& m_adjacencies;
+  MemoryReporter m_memoryReporter;
 };
 
 } // namespace nlsr
@@ -0,0 +1,145 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "area-summarizer.hpp"
+#include "routing-calculator.hpp"
+
+#include "area.hpp"
+#include "logger.hpp"
+#include "metrics/event-loop-monitor.hpp"
+#include "metrics/metrics-registry.hpp"
+
+#include <algorithm>
+
+namespace nlsr {
+
+INIT_LOGGER(route.AreaSummarizer);
+
+namespace {
+
+auto& summaryBuildDuration = metrics::Registry::get().addHistogram(
+  "nlsr_area_summary_build_duration_seconds",
+  "Time spent computing the summaries of an area border router");
+
+} // namespace
+
+AreaSummarizer::AreaSummarizer(ndn::Scheduler& scheduler, Lsdb& lsdb,
+                               const ConfParameter& confParam,
+                               AfterRoutingChange& afterRoutingChange)
+  : m_scheduler(scheduler)
+  , m_lsdb(lsdb)
+  , m_confParam(confParam)
+  , m_afterRoutingChange(afterRoutingChange.connect([this] (const auto&) { scheduleBuild(); }))
+  , m_afterLsdbModified(lsdb.onLsdbModified.connect(
+      [this] (const std::shared_ptr<Lsa>& lsa, LsdbUpdate, const auto&, const auto&) {
+        if (lsa->getType() == Lsa::Type::NAME &&
+            area::getAdvertisingRouter(lsa->getOriginRouter()) != m_confParam.getRouterPrefix()) {
+          scheduleBuild();
+        }
+      }))
+{
+}
+
+void
+AreaSummarizer::scheduleBuild()
+{
+  m_buildEvent = m_scheduler.schedule(SUMMARY_BUILD_DELAY, [this] {
+    metrics::HandlerScope scope(metrics::HandlerTag::ROUTING_TABLE, "buildAreaSummaries");
+    build();
+  });
+}
+
+void
+AreaSummarizer::build()
+{
+  metrics::ScopedTimer timer(summaryBuildDuration);
+  for (const auto& area : m_confParam.getAreas()) {
+    m_lsdb.installOwnSummaryLsa(area, summarize(area));
+  }
+}
+
+NamePrefixList
+AreaSummarizer::summarize(const std::string& area) const
+{
+  const auto& thisRouter = m_confParam.getRouterPrefix();
+  const auto& areas = m_confParam.getAreas();
+  auto& sync = m_lsdb.getSync();
+
+  // SPF over the links of this area only
+  std::vector<std::shared_ptr<Lsa>> adjLsas;
+  auto adjRange = m_lsdb.getLsdbIterator<AdjLsa>();
+  for (auto it = adjRange.first; it != adjRange.second; ++it) {
+    const auto& origin = (*it)->getOriginRouter();
+    if (origin == thisRouter || sync.isInArea(origin, area)) {
+      adjLsas.push_back(*it);
+    }
+  }
+  auto distances = calculateLinkStateDistances(adjLsas, thisRouter);
+
+  // A name advertised by several routers is summarized with the lowest cost
+  std::map<ndn::Name, double> costs;
+  auto addName = [&costs] (const ndn::Name& name, double cost) {
+    auto [it, isNew] = costs.emplace(name, cost);
+    if (!isNew) {
+      it->second = std::min(it->second, cost);
+    }
+  };
+
+  auto nameRange = m_lsdb.getLsdbIterator<NameLsa>();
+  for (auto it = nameRange.first; it != nameRange.second; ++it) {
+    const auto& origin = (*it)->getOriginRouter();
+    auto router = area::getAdvertisingRouter(origin);
+    if (router == thisRouter || !sync.isInArea(origin, area)) {
+      continue;
+    }
+
+    auto summarizedArea = area::getSummarizedArea(origin);
+    if (summarizedArea) {
+      // Names of other areas only leave the backbone, and the areas this router is
+      // attached to are summarized from their own routers instead
+      if (area != area::BACKBONE ||
+          std::find(areas.begin(), areas.end(), *summarizedArea) != areas.end()) {
+        continue;
+      }
+    }
+
+    auto distance = distances.find(router);
+    if (distance == distances.end()) {
+      continue;
+    }
+    if (!summarizedArea) {
+      addName(router, distance->second);
+    }
+    auto nameLsa = std::static_pointer_cast<NameLsa>(*it);
+    for (const auto& info : nameLsa->getNpl().getPrefixInfo()) {
+      addName(info.getName(), distance->second + info.getCost());
+    }
+  }
+
+  NamePrefixList summary;
+  for (const auto& [name, cost] : costs) {
+    summary.insert(name, "", cost);
+  }
+  NLSR_LOG_TRACE("Summary of area " << area << ": " << summary.size() << " names");
+  return summary;
+}
+
+} // namespace nlsr
@@ -0,0 +1,78 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_ROUTE_AREA_SUMMARIZER_HPP
+#define NLSR_ROUTE_AREA_SUMMARIZER_HPP
+
+#include "lsdb.hpp"
+#include "signals.hpp"
+#include "test-access-control.hpp"
+
+#include <ndn-cxx/util/scheduler.hpp>
+
+#include <boost/noncopyable.hpp>
+
+namespace nlsr {
+
+/*! \brief Quiet period after the last routing or Name LSA change before summaries are rebuilt.
+ */
+inline constexpr ndn::time::milliseconds SUMMARY_BUILD_DELAY = 500_ms;
+
+/*! \brief Originates, on an area border router, the summary of each of its areas.
+ *
+ * The summary of an area lists the names advertised by the routers of that area,
+ * each with the cost of reaching it from this router within the area, which is
+ * computed by running SPF over the Adjacency LSAs of that area only. The summary
+ * of the backbone also carries the summaries received there from the border
+ * routers of areas this router is not attached to.
+ *
+ * Routers of the other areas reach these names through this router, so their
+ * LSDB and SPF only cover their own area plus the summaries.
+ */
+class AreaSummarizer : boost::noncopyable
+{
+public:
+  AreaSummarizer(ndn::Scheduler& scheduler, Lsdb& lsdb, const ConfParameter& confParam,
+                 AfterRoutingChange& afterRoutingChange);
+
+  void
+  scheduleBuild();
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  void
+  build();
+
+  NamePrefixList
+  summarize(const std::string& area) const;
+
+private:
+  ndn::Scheduler& m_scheduler;
+  Lsdb& m_lsdb;
+  const ConfParameter& m_confParam;
+
+  ndn::scheduler::ScopedEventId m_buildEvent;
+  ndn::signal::ScopedConnection m_afterRoutingChange;
+  ndn::signal::ScopedConnection m_afterLsdbModified;
+};
+
+} // namespace nlsr
+
+#endif // NLSR_ROUTE_AREA_SUMMARIZER_HPP
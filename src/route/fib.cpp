@@ -22,18 +22,48 @@
 #include "adjacency-list.hpp"
 #include "conf-parameter.hpp"
 #include "logger.hpp"
+#include "metrics/event-loop-monitor.hpp"
+#include "metrics/memory-report.hpp"
+#include "metrics/startup-timeline.hpp"
 #include "nexthop-list.hpp"
+#include "trace.hpp"
+#include "metrics/metrics-registry.hpp"
 
 #include <ndn-cxx/mgmt/nfd/control-command.hpp>
 
 #include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <map>
 
 namespace nlsr {
 
 INIT_LOGGER(route.Fib);
 
+namespace {
+
+auto& registerDuration = metrics::Registry::get().addHistogram("nlsr_fib_command_duration_seconds",
+  "Round-trip time of NFD management commands issued by the FIB", "command=\"register\"");
+auto& unregisterDuration = metrics::Registry::get().addHistogram("nlsr_fib_command_duration_seconds",
+  "Round-trip time of NFD management commands issued by the FIB", "command=\"unregister\"");
+auto& strategyDuration = metrics::Registry::get().addHistogram("nlsr_fib_command_duration_seconds",
+  "Round-trip time of NFD management commands issued by the FIB", "command=\"strategy-set\"");
+auto& pendingCommands = metrics::Registry::get().addGauge("nlsr_fib_pending_commands",
+  "NFD management commands sent by the FIB and not yet answered");
+auto& fibEntries = metrics::Registry::get().addGauge("nlsr_fib_entries",
+  "Number of name prefixes installed in the FIB");
+
+/*! \brief Marks an NFD command as answered and records its round-trip time.
+ */
+void
+completeCommand(metrics::Histogram& histogram, ndn::time::steady_clock::time_point sent)
+{
+  pendingCommands.add(-1);
+  histogram.record(ndn::time::steady_clock::now() - sent);
+}
+
+} // namespace
+
 Fib::Fib(ndn::Face& face, ndn::Scheduler& scheduler, AdjacencyList& adjacencyList,
          ConfParameter& conf, ndn::security::KeyChain& keyChain)
   : m_scheduler(scheduler)
@@ -56,6 +86,7 @@ Fib::remove(const ndn::Name& name)
       unregisterPrefix((it->second).name, nexthop.getConnectingFaceUri());
     }
     m_table.erase(it);
+    fibEntries.set(m_table.size());
   }
 }
 
@@ -65,6 +96,9 @@ Fib::addNextHopsToFibEntryAndNfd(FibEntry& entry, const NextHopsUriSortedSet& ho
   const ndn::Name& name = entry.name;
 
   bool shouldRegister = isNotNeighbor(name);
+  if (shouldRegister && hopsToAdd.size() > 0) {
+    metrics::StartupTimeline::get().mark(metrics::StartupTimeline::Milestone::FIRST_ROUTE);
+  }
 
   for (const auto& hop : hopsToAdd)
   {
@@ -74,7 +108,7 @@ Fib::addNextHopsToFibEntryAndNfd(FibEntry& entry, const NextHopsUriSortedSet& ho
 
     if (shouldRegister) {
       // Add nexthop to NDN-FIB
-      registerPrefix(name, ndn::FaceUri(hop.getConnectingFaceUri()),
+      registerPrefix(name, hop.getConnectingFaceUri(),
                      hop.getRouteCostAsAdjustedInteger(),
                      ndn::time::seconds(m_refreshTime + GRACE_PERIOD),
                      ndn::nfd::ROUTE_FLAG_CAPTURE, 0);
@@ -85,6 +119,7 @@ Fib::addNextHopsToFibEntryAndNfd(FibEntry& entry, const NextHopsUriSortedSet& ho
 void
 Fib::update(const ndn::Name& name, const NexthopList& allHops)
 {
+  metrics::HandlerScope scope(metrics::HandlerTag::FIB, "update");
   NLSR_LOG_DEBUG("Fib::update called");
 
   // Get the max possible faces which is the minimum of the configuration setting and
@@ -110,6 +145,7 @@ Fib::update(const ndn::Name& name, const NexthopList& allHops)
     addNextHopsToFibEntryAndNfd(entry, hopsToAdd);
 
     entryIt = m_table.try_emplace(name, std::move(entry)).first;
+    fibEntries.set(m_table.size());
   }
   // Existing FIB entry that may or may not have nextHops
   else {
@@ -125,10 +161,10 @@ Fib::update(const ndn::Name& name, const NexthopList& allHops)
     FibEntry& entry = entryIt->second;
     addNextHopsToFibEntryAndNfd(entry, hopsToAdd);
 
-    std::set<NextHop, NextHopUriSortedComparator> hopsToRemove;
+    NextHopsUriSortedSet::Container hopsToRemove;
     std::set_difference(entry.nexthopSet.begin(), entry.nexthopSet.end(),
                         hopsToAdd.begin(), hopsToAdd.end(),
-                        std::inserter(hopsToRemove, hopsToRemove.begin()),
+                        std::back_inserter(hopsToRemove),
                         NextHopUriSortedComparator());
 
     bool isUpdatable = isNotNeighbor(entry.name);
@@ -187,9 +223,21 @@ Fib::registerPrefix(const ndn::Name& namePrefix, const ndn::FaceUri& faceUri,
      .setOrigin(ndn::nfd::ROUTE_ORIGIN_NLSR);
 
     NLSR_LOG_DEBUG("Registering prefix: " << faceParameters.getName() << " faceUri: " << faceUri);
+    NLSR_TRACE(fib__register__sent, namePrefix.toUri().c_str(), faceUri.toString().c_str(), faceCost);
+    auto sent = ndn::time::steady_clock::now();
+    pendingCommands.add(1);
     m_controller.start<ndn::nfd::RibRegisterCommand>(faceParameters,
-      std::bind(&Fib::onRegistrationSuccess, this, _1, faceUri),
-      std::bind(&Fib::onRegistrationFailure, this, _1, faceParameters, faceUri, times));
+      [=] (const ndn::nfd::ControlParameters& param) {
+        completeCommand(registerDuration, sent);
+        NLSR_TRACE(fib__register__ack, param.getName().toUri().c_str(), param.getFaceId(), 200);
+        onRegistrationSuccess(param, faceUri);
+      },
+      [=] (const ndn::nfd::ControlResponse& response) {
+        completeCommand(registerDuration, sent);
+        NLSR_TRACE(fib__register__ack, faceParameters.getName().toUri().c_str(),
+                   faceParameters.getFaceId(), response.getCode());
+        onRegistrationFailure(response, faceParameters, faceUri, times);
+      });
   }
   else {
     NLSR_LOG_WARN("Error: No Face Id for face uri: " << faceUri);
@@ -205,7 +253,7 @@ Fib::onRegistrationSuccess(const ndn::nfd::ControlParameters& param,
 
   auto adjacent = m_adjacencyList.findAdjacent(faceUri);
   if (adjacent != m_adjacencyList.end()) {
-    adjacent->setFaceId(param.getFaceId());
+    m_adjacencyList.setFaceId(adjacent, param.getFaceId());
   }
   onPrefixRegistrationSuccess(param.getName());
 }
@@ -248,12 +296,16 @@ Fib::unregisterPrefix(const ndn::Name& namePrefix, const ndn::FaceUri& faceUri)
       .setFaceId(faceId)
       .setOrigin(ndn::nfd::ROUTE_ORIGIN_NLSR);
 
+    auto sent = ndn::time::steady_clock::now();
+    pendingCommands.add(1);
     m_controller.start<ndn::nfd::RibUnregisterCommand>(controlParameters,
-      [] (const ndn::nfd::ControlParameters& commandSuccessResult) {
+      [sent] (const ndn::nfd::ControlParameters& commandSuccessResult) {
+        completeCommand(unregisterDuration, sent);
         NLSR_LOG_DEBUG("Unregister successful Prefix: " << commandSuccessResult.getName() <<
                        " Face Id: " << commandSuccessResult.getFaceId());
       },
-      [] (const ndn::nfd::ControlResponse& response) {
+      [sent] (const ndn::nfd::ControlResponse& response) {
+        completeCommand(unregisterDuration, sent);
         NLSR_LOG_DEBUG("Failed in unregistering name: " << response.getText() <<
                        " (code " << response.getCode() << ")");
       });
@@ -268,9 +320,17 @@ Fib::setStrategy(const ndn::Name& name, const ndn::Name& strategy, uint32_t coun
     .setName(name)
     .setStrategy(strategy);
 
+  auto sent = ndn::time::steady_clock::now();
+  pendingCommands.add(1);
   m_controller.start<ndn::nfd::StrategyChoiceSetCommand>(parameters,
-    std::bind(&Fib::onSetStrategySuccess, this, _1),
-    std::bind(&Fib::onSetStrategyFailure, this, _1, parameters, count));
+    [=] (const ndn::nfd::ControlParameters& commandSuccessResult) {
+      completeCommand(strategyDuration, sent);
+      onSetStrategySuccess(commandSuccessResult);
+    },
+    [=] (const ndn::nfd::ControlResponse& response) {
+      completeCommand(strategyDuration, sent);
+      onSetStrategyFailure(response, parameters, count);
+    });
 }
 
 void
@@ -313,6 +373,7 @@ Fib::scheduleLoop(FibEntry& entry)
 void
 Fib::refreshEntry(const ndn::Name& name, AfterRefreshCallback refreshCb)
 {
+  metrics::HandlerScope scope(metrics::HandlerTag::FIB, "refreshEntry");
   auto it = m_table.find(name);
   if (it == m_table.end()) {
     return;
@@ -345,4 +406,17 @@ Fib::writeLog()
   }
 }
 
+void
+Fib::accountMemory(metrics::MemoryReport& report) const
+{
+  using metrics::MemoryReport;
+
+  size_t bytes = 0;
+  for (const auto& [name, entry] : m_table) {
+    bytes += sizeof(std::pair<const ndn::Name, FibEntry>) + MemoryReport::TREE_NODE_OVERHEAD +
+             2 * MemoryReport::estimateName(name) + MemoryReport::estimateNexthops(entry.nexthopSet);
+  }
+  report.add("fib", m_table.size(), bytes);
+}
+
 } // namespace nlsr
@@ -46,6 +46,10 @@ using AfterRefreshCallback = std::function<void(FibEntry&)>;
 class AdjacencyList;
 class ConfParameter;
 
+namespace metrics {
+class MemoryReport;
+} // namespace metrics
+
 /*! \brief Maps names to lists of next hops, and exports this information to NFD.
  *
  * The FIB (Forwarding Information Base) is the "authoritative" source
@@ -90,6 +94,14 @@ public:
   void
   update(const ndn::Name& name, const NexthopList& allHops);
 
+  /*! \brief Returns how many next hops are installed per name prefix, or 0 for all of them.
+   */
+  uint32_t
+  getMaxFacesPerPrefix() const
+  {
+    return m_confParameter.getMaxFacesPerPrefix();
+  }
+
   void
   setEntryRefreshTime(int32_t fert)
   {
@@ -130,6 +142,11 @@ public:
   void
   writeLog();
 
+  /*! \brief Adds the estimated memory usage of the FIB entries to \p report.
+   */
+  void
+  accountMemory(metrics::MemoryReport& report) const;
+
 private:
   /*! \brief Indicates whether a prefix is a direct neighbor or not.
    *
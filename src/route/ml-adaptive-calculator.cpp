@@ -16,6 +16,7 @@
 #include "adjacent.hpp"
 #include "logger.hpp"
 #include "conf-parameter.hpp"
+#include "metrics/memory-report.hpp"
 
 // 3. 最后包含标准库和boost库（在明确的命名空间中使用）
 #include <algorithm>
@@ -496,6 +497,29 @@ MLAdaptiveCalculator::shouldTriggerModelUpdate(double predictionError)
   return false;
 }
 
+void
+MLAdaptiveCalculator::accountMemory(metrics::MemoryReport& report) const
+{
+  using metrics::MemoryReport;
+
+  // std::deque allocates in fixed-size blocks, so the per-element cost is close to sizeof(T)
+  size_t objects = 0;
+  size_t bytes = 0;
+  for (const auto& [name, history] : m_performanceHistory) {
+    objects += history.size();
+    bytes += sizeof(std::pair<const ndn::Name, std::deque<PerformanceRecord>>) +
+             MemoryReport::HASH_NODE_OVERHEAD + MemoryReport::estimateName(name) +
+             history.size() * sizeof(PerformanceRecord);
+  }
+  for (const auto& [name, history] : m_rttHistory) {
+    objects += history.size();
+    bytes += sizeof(std::pair<const ndn::Name, std::deque<double>>) +
+             MemoryReport::HASH_NODE_OVERHEAD + MemoryReport::estimateName(name) +
+             history.size() * sizeof(double);
+  }
+  report.add("ml.history", objects, bytes);
+}
+
 void
 MLAdaptiveCalculator::adaptLearningRate()
 {
@@ -78,6 +78,11 @@ public:
   
   const Statistics& getStatistics() const { return m_statistics; }
 
+  /*! \brief Adds the estimated memory usage of the performance and RTT histories to \p report.
+   */
+  void
+  accountMemory(metrics::MemoryReport& report) const;
+
 private:
   /**
    * @brief 轻量级线性回归模型
@@ -24,21 +24,67 @@
 #include "common.hpp"
 #include "nexthop.hpp"
 #include "logger.hpp"
+#include "metrics/memory-report.hpp"
+
+#include <algorithm>
+#include <iterator>
 
 namespace nlsr {
 
 INIT_LOGGER(route.NamePrefixTableEntry);
 
+namespace {
+
+NextHop
+addPrefixCost(const NextHop& nh, double cost)
+{
+  // Copied rather than rebuilt from the FaceUri, which would look it up again
+  NextHop adjusted(nh);
+  adjusted.setRouteCost(nh.getRouteCost() + cost);
+  adjusted.setHyperbolic(false);
+  return adjusted;
+}
+
+} // namespace
+
+uint64_t
+NamePrefixTableEntry::computeRank(const RoutingTablePoolEntry& rtpe, double cost) const
+{
+  const auto& nexthops = rtpe.getTopologyNexthopList(m_topology);
+  if (nexthops.empty()) {
+    return NO_ROUTE;
+  }
+  // The next hops are sorted by cost, which adding the same prefix cost preserves
+  return addPrefixCost(*nexthops.begin(), cost).getRouteCostAsAdjustedInteger();
+}
+
 void
-NamePrefixTableEntry::generateNhlfromRteList()
+NamePrefixTableEntry::generateNhlfromRteList(size_t maxNexthops)
 {
   m_nexthopList.clear();
-  for (auto iterator = m_rteList.begin(); iterator != m_rteList.end(); ++iterator) {
-    for (auto nhItr = (*iterator)->getNexthopList().getNextHops().begin();
-         nhItr != (*iterator)->getNexthopList().getNextHops().end();
-         ++nhItr) {
-      m_nexthopList.addNextHop((*nhItr));
+  for (const auto& [rank, rtpe] : m_originsByRank) {
+    if (rank == NO_ROUTE) {
+      // this origin and all following ones are unreachable
+      break;
+    }
+    // Every next hop through this origin, and through the costlier origins after it, would
+    // sort after the current K-th cheapest next hop, so it cannot be selected
+    if (maxNexthops > 0 && m_nexthopList.size() >= maxNexthops &&
+        std::next(m_nexthopList.begin(), maxNexthops - 1)->getRouteCostAsAdjustedInteger() < rank) {
+      break;
     }
+
+    double cost = m_origins.at(rtpe).cost;
+    for (const auto& nh : rtpe->getTopologyNexthopList(m_topology).getNextHops()) {
+      m_nexthopList.addNextHop(addPrefixCost(nh, cost));
+    }
+  }
+
+  if (maxNexthops > 0 && m_nexthopList.size() > maxNexthops) {
+    NexthopList cheapest;
+    std::for_each(m_nexthopList.begin(), std::next(m_nexthopList.begin(), maxNexthops),
+                  [&cheapest] (const NextHop& nh) { cheapest.addNextHop(nh); });
+    m_nexthopList = std::move(cheapest);
   }
 }
 
@@ -48,6 +94,9 @@ NamePrefixTableEntry::removeRoutingTableEntry(std::shared_ptr<RoutingTablePoolEn
   auto iterator = std::find(m_rteList.begin(), m_rteList.end(), entryPtr);
 
   if (iterator != m_rteList.end()) {
+    auto originIt = m_origins.find(entryPtr.get());
+    m_originsByRank.erase({originIt->second.rank, entryPtr.get()});
+    m_origins.erase(originIt);
     (*iterator)->decrementUseCount();
     // Remove this NamePrefixEntry from the RoutingTablePoolEntry
     (*iterator)->namePrefixTableEntries.erase(getNamePrefix());
@@ -61,19 +110,36 @@ NamePrefixTableEntry::removeRoutingTableEntry(std::shared_ptr<RoutingTablePoolEn
 }
 
 void
-NamePrefixTableEntry::addRoutingTableEntry(std::shared_ptr<RoutingTablePoolEntry> entryPtr)
+NamePrefixTableEntry::addRoutingTableEntry(std::shared_ptr<RoutingTablePoolEntry> entryPtr,
+                                           double cost)
 {
-  auto iterator = std::find(m_rteList.begin(), m_rteList.end(), entryPtr);
+  auto [originIt, isNew] = m_origins.try_emplace(entryPtr.get());
+  Origin& origin = originIt->second;
 
   // Ensure that this is a new entry
-  if (iterator == m_rteList.end()) {
+  if (isNew) {
     // Adding a new routing entry to the NPT entry
     entryPtr->incrementUseCount();
     m_rteList.push_back(entryPtr);
   }
-  // Note: we don't need to update in the else case because these are
-  // pointers, and they are centrally-located in the NPT and will all
-  // be updated there.
+  else {
+    // The next hops are shared through the pool, so only the rank needs updating
+    m_originsByRank.erase({origin.rank, entryPtr.get()});
+  }
+
+  origin.cost = cost;
+  origin.rank = computeRank(*entryPtr, cost);
+  m_originsByRank.emplace(origin.rank, entryPtr.get());
+}
+
+size_t
+NamePrefixTableEntry::estimateOriginIndexBytes() const
+{
+  using metrics::MemoryReport;
+  return m_origins.size() * (MemoryReport::HASH_NODE_OVERHEAD +
+                             sizeof(decltype(m_origins)::value_type) +
+                             MemoryReport::TREE_NODE_OVERHEAD +
+                             sizeof(decltype(m_originsByRank)::value_type));
 }
 
 bool
@@ -92,10 +158,13 @@ std::ostream&
 operator<<(std::ostream& os, const NamePrefixTableEntry& entry)
 {
   os << "Name: " << entry.getNamePrefix() << "\n";
+  if (!entry.getTopology().empty()) {
+    os << "Topology: " << entry.getTopology() << "\n";
+  }
 
   for (const auto& entryPtr : entry.getRteList()) {
     os << "  Destination: " << entryPtr->getDestination() << "\n";
-    os << entryPtr->getNexthopList();
+    os << entryPtr->getTopologyNexthopList(entry.getTopology());
   }
   return os;
 }
@@ -26,7 +26,10 @@
 #include "test-access-control.hpp"
 #include "nexthop.hpp"
 
+#include <limits>
 #include <list>
+#include <set>
+#include <unordered_map>
 #include <utility>
 
 namespace nlsr {
@@ -38,8 +41,9 @@ public:
   {
   }
 
-  NamePrefixTableEntry(const ndn::Name& namePrefix)
+  NamePrefixTableEntry(const ndn::Name& namePrefix, const std::string& topology = "")
     : m_namePrefix(namePrefix)
+    , m_topology(topology)
     , m_nexthopList()
   {
   }
@@ -50,6 +54,15 @@ public:
     return m_namePrefix;
   }
 
+  /*! \brief Returns the topology whose next hops are used for this name prefix,
+   *         or an empty string for the default topology.
+   */
+  const std::string&
+  getTopology() const
+  {
+    return m_topology;
+  }
+
   const std::list<std::shared_ptr<RoutingTablePoolEntry>>&
   getRteList() const
   {
@@ -62,10 +75,11 @@ public:
   void
   resetRteListNextHop()
   {
-    if (m_rteList.size() > 0) {
-      for (auto it = m_rteList.begin(); it != m_rteList.end(); ++it) {
-        (*it)->getNexthopList().clear();
-      }
+    m_originsByRank.clear();
+    for (const auto& rtpe : m_rteList) {
+      rtpe->getNexthopList().clear();
+      m_origins.at(rtpe.get()).rank = NO_ROUTE;
+      m_originsByRank.emplace(NO_ROUTE, rtpe.get());
     }
   }
 
@@ -87,11 +101,16 @@ public:
     return m_nexthopList;
   }
 
-  /*! \brief Collect all next-hops that are advertised by this entry's
-   * routing entries.
+  /*! \brief Collect the cheapest next-hops that are advertised by this entry's
+   * routing entries in its topology, with the cost of the name prefix at each origin added.
+   * \param maxNexthops How many next hops to keep, or 0 to keep all of them.
+   *
+   * Origins are visited by increasing cost of their cheapest next hop, and the walk stops
+   * once no remaining origin can offer one of the \p maxNexthops cheapest next hops, so that
+   * prefixes advertised by many origins only merge the next hops of the closest ones.
    */
   void
-  generateNhlfromRteList();
+  generateNhlfromRteList(size_t maxNexthops = 0);
 
   /*! \brief Removes a routing entry from this NPT entry.
    * \return The number of NPTs using the just-removed routing entry.
@@ -101,22 +120,53 @@ public:
 
   /*! \brief Adds a routing entry to this NPT entry.
    * \param rtpePtr The routing entry.
+   * \param cost The cost of the name prefix at the origin router of \p rtpePtr.
    *
    * Adds a routing table pool entry to this NPT entry's list
    * (reminder: each RTPE has a next-hop list). They are used to
    * calculate this entry's overall next-hop list.
+   *
+   * If the routing entry was already added, its cost is updated and it is ranked again
+   * by its current next hops, so this must be called whenever they change.
    */
   void
-  addRoutingTableEntry(std::shared_ptr<RoutingTablePoolEntry> rtpePtr);
+  addRoutingTableEntry(std::shared_ptr<RoutingTablePoolEntry> rtpePtr, double cost = 0);
+
+  /*! \brief Returns the estimated heap usage of the ranking of the routing entries.
+   */
+  size_t
+  estimateOriginIndexBytes() const;
 
   void
   writeLog();
 
+private:
+  static constexpr uint64_t NO_ROUTE = std::numeric_limits<uint64_t>::max();
+
+  /*! \brief Returns the adjusted cost of the cheapest next hop towards this name prefix
+   *         through \p rtpe , or NO_ROUTE if there is none.
+   */
+  uint64_t
+  computeRank(const RoutingTablePoolEntry& rtpe, double cost) const;
+
+  struct Origin
+  {
+    /// cost of the name prefix at the origin router
+    double cost = 0;
+    /// key of the origin in m_originsByRank
+    uint64_t rank = NO_ROUTE;
+  };
+
 private:
   ndn::Name m_namePrefix;
+  std::string m_topology;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   std::list<std::shared_ptr<RoutingTablePoolEntry>> m_rteList;
+  /// the routing entries of m_rteList, with the cost of the name prefix at each origin
+  std::unordered_map<const RoutingTablePoolEntry*, Origin> m_origins;
+  /// the routing entries of m_rteList, by increasing cost of their cheapest next hop
+  std::set<std::pair<uint64_t, const RoutingTablePoolEntry*>> m_originsByRank;
   NexthopList m_nexthopList;
 };
 
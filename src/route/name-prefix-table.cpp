@@ -21,9 +21,13 @@
 
 #include "name-prefix-table.hpp"
 
+#include "area.hpp"
 #include "logger.hpp"
+#include "metrics/event-loop-monitor.hpp"
+#include "metrics/memory-report.hpp"
 #include "nlsr.hpp"
 #include "routing-table.hpp"
+#include "metrics/metrics-registry.hpp"
 
 #include <algorithm>
 #include <list>
@@ -33,6 +37,17 @@ namespace nlsr {
 
 INIT_LOGGER(route.NamePrefixTable);
 
+namespace {
+
+auto& nptUpdateFromLsdb = metrics::Registry::get().addHistogram("nlsr_npt_update_duration_seconds",
+  "Time spent updating the name prefix table", "trigger=\"lsdb\"");
+auto& nptUpdateFromRoutes = metrics::Registry::get().addHistogram("nlsr_npt_update_duration_seconds",
+  "Time spent updating the name prefix table", "trigger=\"routing-table\"");
+auto& nptEntries = metrics::Registry::get().addGauge("nlsr_npt_entries",
+  "Number of entries in the name prefix table");
+
+} // namespace
+
 NamePrefixTable::NamePrefixTable(const ndn::Name& ownRouterName, Fib& fib,
                                  RoutingTable& routingTable,
                                  AfterRoutingChange& afterRoutingChangeSignal,
@@ -65,10 +80,12 @@ NamePrefixTable::updateFromLsdb(std::shared_ptr<Lsa> lsa, LsdbUpdate updateType,
                                 const std::list<nlsr::PrefixInfo>& namesToAdd,
                                 const std::list<nlsr::PrefixInfo>& namesToRemove)
 {
-  if (m_ownRouterName == lsa->getOriginRouter()) {
+  metrics::HandlerScope scope(metrics::HandlerTag::NAME_PREFIX_TABLE, "updateFromLsdb");
+  if (m_ownRouterName == area::getAdvertisingRouter(lsa->getOriginRouter())) {
     return;
   }
   NLSR_LOG_TRACE("Got update from Lsdb for router: " << lsa->getOriginRouter());
+  metrics::ScopedTimer timer(nptUpdateFromLsdb);
 
   if (updateType == LsdbUpdate::INSTALLED) {
     addEntry(lsa->getOriginRouter(), lsa->getOriginRouter());
@@ -106,7 +123,8 @@ NamePrefixTable::updateFromLsdb(std::shared_ptr<Lsa> lsa, LsdbUpdate updateType,
     removeEntry(lsa->getOriginRouter(), lsa->getOriginRouter());
     if (lsa->getType() == Lsa::Type::NAME) {
       auto nlsa = std::static_pointer_cast<NameLsa>(lsa);
-      for (const auto& name : nlsa->getNpl().getNames()) {
+      for (const auto& prefix : nlsa->getNpl().getPrefixInfo()) {
+        const auto& name = prefix.getName();
         if (name != m_ownRouterName) {
           m_nexthopCost.erase(m_nexthopCost.find(DestNameKey(lsa->getOriginRouter(), name)));
           removeEntry(name, lsa->getOriginRouter());
@@ -116,16 +134,11 @@ NamePrefixTable::updateFromLsdb(std::shared_ptr<Lsa> lsa, LsdbUpdate updateType,
   }
 }
 
-NexthopList
-NamePrefixTable::adjustNexthopCosts(const NexthopList& nhlist, const ndn::Name& nameToCheck, const ndn::Name& destRouterName)
+double
+NamePrefixTable::getPrefixCost(const ndn::Name& name, const ndn::Name& destRouter) const
 {
-  NexthopList new_nhList;
-  for (const auto& nh : nhlist.getNextHops()) {
-      const NextHop newNextHop = NextHop(nh.getConnectingFaceUri(), nh.getRouteCost() +
-                                              m_nexthopCost[DestNameKey(destRouterName, nameToCheck)]);
-      new_nhList.addNextHop(newNextHop);
-  }
-  return new_nhList;
+  auto it = m_nexthopCost.find(DestNameKey(destRouter, name));
+  return it == m_nexthopCost.end() ? 0 : it->second;
 }
 
 void
@@ -155,6 +168,7 @@ NamePrefixTable::addEntry(const ndn::Name& name, const ndn::Name& destRouter)
     else {
       rtpe = RoutingTablePoolEntry(*routeEntryPtr, 0);
     }
+    updateTopologyNexthops(rtpe);
 
     // Add the new pool object to the pool.
     rtpePtr = addRtpeToPool(rtpe);
@@ -169,15 +183,16 @@ NamePrefixTable::addEntry(const ndn::Name& name, const ndn::Name& destRouter)
   if (nameItr == m_table.end()) {
     NLSR_LOG_DEBUG("Adding origin: " << rtpePtr->getDestination()
                    << " to a new name prefix: " << name);
-    npte = std::make_shared<NamePrefixTableEntry>(name);
-    npte->addRoutingTableEntry(rtpePtr);
-    npte->generateNhlfromRteList();
+    npte = std::make_shared<NamePrefixTableEntry>(name, m_routingTable.getTopologyOf(name));
+    npte->addRoutingTableEntry(rtpePtr, getPrefixCost(name, destRouter));
+    npte->generateNhlfromRteList(m_fib.getMaxFacesPerPrefix());
     m_table.push_back(npte);
+    nptEntries.set(m_table.size());
 
     // If this entry has next hops, we need to inform the FIB
     if (npte->getNexthopList().size() > 0) {
       NLSR_LOG_TRACE("Updating FIB with next hops for " << npte->getNamePrefix());
-      m_fib.update(name, adjustNexthopCosts(npte->getNexthopList(), name, destRouter));
+      m_fib.update(name, npte->getNexthopList());
     }
     // The routing table may recalculate and add a routing table entry
     // with no next hops to replace an existing routing table entry. In
@@ -194,12 +209,12 @@ NamePrefixTable::addEntry(const ndn::Name& name, const ndn::Name& destRouter)
     npte = *nameItr;
     NLSR_LOG_TRACE("Adding origin: " << rtpePtr->getDestination() <<
                    " to existing prefix: " << **nameItr);
-    (*nameItr)->addRoutingTableEntry(rtpePtr);
-    (*nameItr)->generateNhlfromRteList();
+    (*nameItr)->addRoutingTableEntry(rtpePtr, getPrefixCost(name, destRouter));
+    (*nameItr)->generateNhlfromRteList(m_fib.getMaxFacesPerPrefix());
 
     if ((*nameItr)->getNexthopList().size() > 0) {
       NLSR_LOG_TRACE("Updating FIB with next hops for " << (**nameItr));
-      m_fib.update(name, adjustNexthopCosts((*nameItr)->getNexthopList(), name, destRouter));
+      m_fib.update(name, (*nameItr)->getNexthopList());
     }
     else {
       NLSR_LOG_TRACE(npte->getNamePrefix() << " has no next hops; removing from FIB");
@@ -261,13 +276,14 @@ NamePrefixTable::removeEntry(const ndn::Name& name, const ndn::Name& destRouter)
       NLSR_LOG_TRACE(**nameItr << " has no routing table entries;"
                      << " removing from table and FIB");
       m_table.erase(nameItr);
+      nptEntries.set(m_table.size());
       m_fib.remove(name);
     }
     else {
       NLSR_LOG_TRACE(**nameItr << " has other routing table entries;"
                      << " updating FIB with next hops");
-      (*nameItr)->generateNhlfromRteList();
-      m_fib.update(name, adjustNexthopCosts((*nameItr)->getNexthopList(), name, destRouter));
+      (*nameItr)->generateNhlfromRteList(m_fib.getMaxFacesPerPrefix());
+      m_fib.update(name, (*nameItr)->getNexthopList());
     }
   }
   else {
@@ -279,11 +295,14 @@ NamePrefixTable::removeEntry(const ndn::Name& name, const ndn::Name& destRouter)
 void
 NamePrefixTable::updateWithNewRoute(const std::list<RoutingTableEntry>& entries)
 {
+  metrics::HandlerScope scope(metrics::HandlerTag::NAME_PREFIX_TABLE, "updateWithNewRoute");
   NLSR_LOG_DEBUG("Updating table with newly calculated routes");
+  metrics::ScopedTimer timer(nptUpdateFromRoutes);
 
   // Iterate over each pool entry we have
   for (auto&& poolEntryPair : m_rtpool) {
     auto&& poolEntry = poolEntryPair.second;
+    bool areTopologyNexthopsChanged = updateTopologyNexthops(*poolEntry);
     auto sourceEntry = std::find_if(entries.begin(), entries.end(),
                                     [&poolEntry] (const RoutingTableEntry& entry) {
                                       return poolEntry->getDestination() == entry.getDestination();
@@ -306,6 +325,14 @@ NamePrefixTable::updateWithNewRoute(const std::list<RoutingTableEntry>& entries)
         addEntry(nameEntryFullPtr->getNamePrefix(), poolEntry->getDestination());
       }
     }
+    else if (areTopologyNexthopsChanged) {
+      NLSR_LOG_DEBUG("Routing entry: " << poolEntry->getDestination()
+                     << " has changed next-hops in other topologies.");
+      for (const auto& nameEntry : poolEntry->namePrefixTableEntries) {
+        auto nameEntryFullPtr = nameEntry.second.lock();
+        addEntry(nameEntryFullPtr->getNamePrefix(), poolEntry->getDestination());
+      }
+    }
     else {
       NLSR_LOG_TRACE("No change in routing entry:" << poolEntry->getDestination()
                  << ", no action necessary.");
@@ -313,6 +340,24 @@ NamePrefixTable::updateWithNewRoute(const std::list<RoutingTableEntry>& entries)
   }
 }
 
+bool
+NamePrefixTable::updateTopologyNexthops(RoutingTablePoolEntry& rtpe)
+{
+  std::map<std::string, NexthopList> nexthopLists;
+  for (const auto& [topology, table] : m_routingTable.getTopologyTables()) {
+    auto rte = m_routingTable.findRoutingTableEntry(rtpe.getDestination(), topology);
+    if (rte != nullptr) {
+      nexthopLists.emplace(topology, rte->getNexthopList());
+    }
+  }
+
+  if (nexthopLists == rtpe.topologyNexthopLists) {
+    return false;
+  }
+  rtpe.topologyNexthopLists = std::move(nexthopLists);
+  return true;
+}
+
 // Inserts the routing table pool entry into the NPT's RTE storage
 // pool.  This cannot fail, so the pool is guaranteed to contain the
 // item after this occurs.
@@ -346,6 +391,35 @@ NamePrefixTable::writeLog()
   NLSR_LOG_DEBUG(*this);
 }
 
+void
+NamePrefixTable::accountMemory(metrics::MemoryReport& report) const
+{
+  using metrics::MemoryReport;
+
+  size_t entryBytes = 0;
+  for (const auto& entry : m_table) {
+    entryBytes += sizeof(NamePrefixTableEntry) + MemoryReport::LIST_NODE_OVERHEAD +
+                  sizeof(entry) + MemoryReport::estimateName(entry->getNamePrefix()) +
+                  MemoryReport::estimateNexthops(entry->getNexthopList()) +
+                  entry->getRteList().size() * (sizeof(std::shared_ptr<RoutingTablePoolEntry>) +
+                                                MemoryReport::LIST_NODE_OVERHEAD) +
+                  entry->estimateOriginIndexBytes();
+  }
+  report.add("npt.entries", m_table.size(), entryBytes);
+
+  size_t poolBytes = 0;
+  for (const auto& [name, rtpe] : m_rtpool) {
+    poolBytes += sizeof(RoutingTablePoolEntry) + MemoryReport::HASH_NODE_OVERHEAD +
+                 sizeof(RoutingTableEntryPool::value_type) + 2 * MemoryReport::estimateName(name) +
+                 MemoryReport::estimateNexthops(rtpe->getNexthopList());
+    for (const auto& [topology, nexthops] : rtpe->topologyNexthopLists) {
+      poolBytes += MemoryReport::TREE_NODE_OVERHEAD + topology.capacity() +
+                   MemoryReport::estimateNexthops(nexthops);
+    }
+  }
+  report.add("npt.pool", m_rtpool.size(), poolBytes);
+}
+
 std::ostream&
 operator<<(std::ostream& os, const NamePrefixTable& table)
 {
@@ -49,9 +49,6 @@ public:
 
   ~NamePrefixTable();
 
-  NexthopList
-  adjustNexthopCosts(const NexthopList& nhlist, const ndn::Name& nameToCheck, const ndn::Name& destRouterName);
-
   /*! \brief Add, update, or remove Names according to the Lsdb update
     \param lsa The LSA class pointer
     \param updateType Update type from Lsdb (INSTALLED, UPDATED, REMOVED)
@@ -130,12 +127,29 @@ public:
   void
   writeLog();
 
+  /*! \brief Adds the estimated memory usage of the NPT and its routing table pool to \p report.
+   */
+  void
+  accountMemory(metrics::MemoryReport& report) const;
+
   const_iterator
   begin() const;
 
   const_iterator
   end() const;
 
+private:
+  /*! \brief Returns the cost of \p name as advertised by \p destRouter , 0 if unknown.
+   */
+  double
+  getPrefixCost(const ndn::Name& name, const ndn::Name& destRouter) const;
+
+  /*! \brief Copies the next hops of \p rtpe in the configured topologies from the routing table.
+   *  \return whether they changed
+   */
+  bool
+  updateTopologyNexthops(RoutingTablePoolEntry& rtpe);
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   RoutingTableEntryPool m_rtpool;
 
@@ -27,7 +27,9 @@
 #include <ndn-cxx/face.hpp>
 #include <ndn-cxx/util/ostream-joiner.hpp>
 
-#include <set>
+#include <boost/container/small_vector.hpp>
+
+#include <algorithm>
 
 namespace nlsr {
 
@@ -40,10 +42,19 @@ struct NextHopUriSortedComparator
   }
 };
 
+/*! \brief A list of next hops, sorted with \p T and holding at most one next hop per face.
+ *
+ * The next hops are kept in a sorted vector that stores the first INLINE_CAPACITY of them
+ * in place: routes rarely have more, so that lists are copied and compared without
+ * allocating.
+ */
 template<typename T = std::less<NextHop>>
 class NexthopListT
 {
 public:
+  static constexpr size_t INLINE_CAPACITY = 4;
+  using Container = boost::container::small_vector<NextHop, INLINE_CAPACITY>;
+
   NexthopListT() = default;
 
   /*! \brief Adds a next hop to the list.
@@ -57,15 +68,13 @@ public:
   addNextHop(const NextHop& nh)
   {
     auto it = std::find_if(m_nexthopList.begin(), m_nexthopList.end(),
-      [&nh] (const auto& item) {
-        return item.getConnectingFaceUri() == nh.getConnectingFaceUri();
-      });
+                           [&nh] (const auto& item) { return item.hasSameFace(nh); });
     if (it == m_nexthopList.end()) {
-      m_nexthopList.insert(nh);
+      insertSorted(nh);
     }
     else if (it->getRouteCost() > nh.getRouteCost()) {
       m_nexthopList.erase(it);
-      m_nexthopList.insert(nh);
+      insertSorted(nh);
     }
   }
 
@@ -89,22 +98,29 @@ public:
     return m_nexthopList.size();
   }
 
+  bool
+  empty() const
+  {
+    return m_nexthopList.empty();
+  }
+
   void
   clear()
   {
     m_nexthopList.clear();
   }
 
-  const std::set<NextHop, T>&
+  const Container&
   getNextHops() const
   {
     return m_nexthopList;
   }
 
   typedef T value_type;
-  typedef typename std::set<NextHop, T>::iterator iterator;
-  typedef typename std::set<NextHop, T>::const_iterator const_iterator;
-  typedef typename std::set<NextHop, T>::reverse_iterator reverse_iterator;
+  // like the elements of a set, the next hops cannot be modified in place
+  typedef typename Container::const_iterator iterator;
+  typedef typename Container::const_iterator const_iterator;
+  typedef typename Container::const_reverse_iterator reverse_iterator;
 
   iterator
   begin() const
@@ -143,7 +159,15 @@ public:
   }
 
 private:
-  std::set<NextHop, T> m_nexthopList;
+  void
+  insertSorted(const NextHop& nh)
+  {
+    m_nexthopList.insert(std::upper_bound(m_nexthopList.begin(), m_nexthopList.end(), nh, T()),
+                         nh);
+  }
+
+private:
+  Container m_nexthopList;
 };
 
 typedef NexthopListT<> NexthopList;
@@ -23,6 +23,8 @@
 
 #include <ndn-cxx/encoding/block-helpers.hpp>
 
+#include <set>
+
 namespace nlsr {
 
 template<ndn::encoding::Tag TAG>
@@ -32,7 +34,7 @@ NextHop::wireEncode(ndn::EncodingImpl<TAG>& block) const
   size_t totalLength = 0;
 
   totalLength += ndn::encoding::prependDoubleBlock(block, nlsr::tlv::CostDouble, m_routeCost);
-  totalLength += ndn::encoding::prependStringBlock(block, nlsr::tlv::Uri, m_connectingFaceUri.toString());
+  totalLength += ndn::encoding::prependStringBlock(block, nlsr::tlv::Uri, m_connectingFaceUri->toString());
 
   totalLength += block.prependVarNumber(totalLength);
   totalLength += block.prependVarNumber(nlsr::tlv::NextHop);
@@ -42,43 +44,36 @@ NextHop::wireEncode(ndn::EncodingImpl<TAG>& block) const
 
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(NextHop);
 
-const ndn::Block&
+ndn::Block
 NextHop::wireEncode() const
 {
-  if (m_wire.hasWire()) {
-    return m_wire;
-  }
-
+  // Not cached: a cached Block would make every copy of a next hop expensive
   ndn::EncodingEstimator estimator;
   size_t estimatedSize = wireEncode(estimator);
 
   ndn::EncodingBuffer buffer(estimatedSize, 0);
   wireEncode(buffer);
 
-  m_wire = buffer.block();
-
-  return m_wire;
+  return buffer.block();
 }
 
 void
 NextHop::wireDecode(const ndn::Block& wire)
 {
-  m_connectingFaceUri = {};
+  m_connectingFaceUri = internFaceUri({});
   m_routeCost = 0;
 
-  m_wire = wire;
-
-  if (m_wire.type() != nlsr::tlv::NextHop) {
-    NDN_THROW(Error("NextHop", m_wire.type()));
+  if (wire.type() != nlsr::tlv::NextHop) {
+    NDN_THROW(Error("NextHop", wire.type()));
   }
 
-  m_wire.parse();
+  wire.parse();
 
-  auto val = m_wire.elements_begin();
+  auto val = wire.elements_begin();
 
-  if (val != m_wire.elements_end() && val->type() == nlsr::tlv::Uri) {
+  if (val != wire.elements_end() && val->type() == nlsr::tlv::Uri) {
     try {
-      m_connectingFaceUri = ndn::FaceUri(ndn::encoding::readString(*val));
+      m_connectingFaceUri = internFaceUri(ndn::FaceUri(ndn::encoding::readString(*val)));
     }
     catch (const ndn::FaceUri::Error& e) {
       NDN_THROW_NESTED(Error("Invalid Uri"));
@@ -89,7 +84,7 @@ NextHop::wireDecode(const ndn::Block& wire)
     NDN_THROW(Error("Missing required Uri field"));
   }
 
-  if (val != m_wire.elements_end() && val->type() == nlsr::tlv::CostDouble) {
+  if (val != wire.elements_end() && val->type() == nlsr::tlv::CostDouble) {
     m_routeCost = ndn::encoding::readDouble(*val);
     ++val;
   }
@@ -98,6 +93,20 @@ NextHop::wireDecode(const ndn::Block& wire)
   }
 }
 
+std::set<ndn::FaceUri>&
+NextHop::faceUris()
+{
+  // The nodes of a std::set are never moved, so the pointers stay valid
+  static std::set<ndn::FaceUri> faceUris;
+  return faceUris;
+}
+
+const ndn::FaceUri*
+NextHop::internFaceUri(const ndn::FaceUri& faceUri)
+{
+  return &*faceUris().insert(faceUri).first;
+}
+
 std::ostream&
 operator<<(std::ostream& os, const NextHop& hop)
 {
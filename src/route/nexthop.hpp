@@ -32,6 +32,7 @@
 
 #include <cmath>
 #include <ostream>
+#include <set>
 
 namespace nlsr {
 
@@ -41,6 +42,10 @@ namespace nlsr {
  *                Uri
  *                Cost
  *
+ * The FaceUri is interned: a NextHop only holds a pointer to the single copy of its FaceUri,
+ * so that next hops are trivially copyable and compare their faces by address. The FaceUri
+ * itself is only used to encode the next hop and to build the NFD commands.
+ *
  * \sa https://redmine.named-data.net/projects/nlsr/wiki/Routing_Table_Dataset
  */
 class NextHop : private boost::totally_ordered<NextHop>
@@ -51,7 +56,7 @@ public:
   NextHop() = default;
 
   NextHop(const ndn::FaceUri& cfu, double rc)
-    : m_connectingFaceUri(cfu)
+    : m_connectingFaceUri(internFaceUri(cfu))
     , m_routeCost(rc)
   {
   }
@@ -65,13 +70,21 @@ public:
   const ndn::FaceUri&
   getConnectingFaceUri() const
   {
-    return m_connectingFaceUri;
+    return *m_connectingFaceUri;
   }
 
   void
   setConnectingFaceUri(const ndn::FaceUri& cfu)
   {
-    m_connectingFaceUri = cfu;
+    m_connectingFaceUri = internFaceUri(cfu);
+  }
+
+  /*! \brief Returns whether \p other goes through the same face, without comparing FaceUris.
+   */
+  bool
+  hasSameFace(const NextHop& other) const
+  {
+    return m_connectingFaceUri == other.m_connectingFaceUri;
   }
 
   uint64_t
@@ -116,7 +129,7 @@ public:
   size_t
   wireEncode(ndn::EncodingImpl<TAG>& block) const;
 
-  const ndn::Block&
+  ndn::Block
   wireEncode() const;
 
   void
@@ -131,7 +144,7 @@ private: // non-member operators
   operator==(const NextHop& lhs, const NextHop& rhs)
   {
     return lhs.getRouteCostAsAdjustedInteger() == rhs.getRouteCostAsAdjustedInteger() &&
-           lhs.getConnectingFaceUri() == rhs.getConnectingFaceUri();
+           lhs.hasSameFace(rhs);
   }
 
   friend bool
@@ -141,13 +154,30 @@ private: // non-member operators
            std::forward_as_tuple(rhs.getRouteCostAsAdjustedInteger(), rhs.getConnectingFaceUri());
   }
 
+  /*! \brief Returns the FaceUris interned so far, for memory accounting.
+   */
+  static const std::set<ndn::FaceUri>&
+  getInternedFaceUris()
+  {
+    return faceUris();
+  }
+
+private:
+  static std::set<ndn::FaceUri>&
+  faceUris();
+
+  /*! \brief Returns the single copy of \p faceUri shared by all next hops.
+   *
+   * Interned FaceUris are never released: a router only ever uses a handful of faces.
+   */
+  static const ndn::FaceUri*
+  internFaceUri(const ndn::FaceUri& faceUri);
+
 private:
-  ndn::FaceUri m_connectingFaceUri;
+  const ndn::FaceUri* m_connectingFaceUri = internFaceUri({});
   double m_routeCost = 0.0;
   bool m_isHyperbolic = false;
 
-  mutable ndn::Block m_wire;
-
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /*! \brief Used to adjust floating point route costs to integers
       Since NFD uses integer route costs in the FIB, hyperbolic paths with similar route costs
@@ -78,7 +78,7 @@ HyperbolicRoutingCalculator::calculatePath(NameMap& map, RoutingTable& rt,
   auto thisRouter = map.getMappingNoByRouterName(m_thisRouterName);
 
   // Iterate over directly connected neighbors
-  std::list<Adjacent> neighbors = adjacencies.getAdjList();
+  const auto& neighbors = adjacencies.getAdjList();
   for (auto adj = neighbors.begin(); adj != neighbors.end(); ++adj) {
 
     // Don't calculate nexthops using an inactive router
@@ -26,9 +26,14 @@
 #include "adjacent.hpp"
 #include "logger.hpp"
 #include "nlsr.hpp"
+#include "trace.hpp"
+#include "utility/arena.hpp"
 
 #include <boost/multi_array.hpp>
 
+#include <functional>
+#include <map>
+
 namespace nlsr {
 namespace {
 
@@ -38,13 +43,29 @@ constexpr int EMPTY_PARENT = -12345;
 constexpr double INF_DISTANCE = 2147483647;
 constexpr int NO_NEXT_HOP = -12345;
 
+using util::Arena;
+using util::ArenaMap;
+using util::ArenaVector;
+
 /**
  * @brief Adjacency matrix.
  *
  * The matrix shall be a 2D array with N rows and N columns, where N is the number of routers.
  * Element i,j is the cost from router i to router j.
+ *
+ * Like all other transient structures of a calculation, matrices are allocated in the arena
+ * of the calculation, which is reset at once when the calculation is over.
+ */
+using AdjMatrix = boost::multi_array<double, 2, util::ArenaAllocator<double>>;
+
+/**
+ * @brief Allocate a matrix of @p nRouters rows and columns in @p arena .
  */
-using AdjMatrix = boost::multi_array<double, 2>;
+AdjMatrix
+allocateAdjMatrix(size_t nRouters, Arena& arena)
+{
+  return AdjMatrix(boost::extents[nRouters][nRouters], boost::c_storage_order(), arena);
+}
 
 struct PrintAdjMatrix
 {
@@ -94,41 +115,71 @@ operator<<(std::ostream& os, const PrintAdjMatrix& p)
 }
 
 /**
- * @brief Allocate and populate adjacency matrix.
+ * @brief A link announced in an Adjacency LSA, from router @c row to router @c col .
  *
- * The adjacency matrix is resized to match the number of routers in @p map .
- * Costs from Adjacency LSAs are filled into the matrix; in case of a mismatch in bidirectional
- * costs, the higher cost is assigned for both directions.
- * All other elements are set to @c NON_ADJACENT_COST .
+ * The links are gathered once per calculation and shared by all topologies, which only
+ * differ in the cost of each link.
  */
-AdjMatrix
-makeAdjMatrix(const Lsdb& lsdb, NameMap& map)
+struct AnnouncedLink
 {
-  // Create the matrix to have N rows and N columns, where N is number of routers.
-  size_t nRouters = map.size();
-  AdjMatrix matrix(boost::extents[nRouters][nRouters]);
+  int32_t row;
+  int32_t col;
+  const Adjacent* adjacent;
+};
 
-  // Initialize all elements to NON_ADJACENT_COST.
-  std::fill_n(matrix.origin(), matrix.num_elements(), Adjacent::NON_ADJACENT_COST);
+/**
+ * @brief List the links between the routers in @p map announced in Adjacency LSAs.
+ *
+ * The returned links point into the LSAs, which must outlive them.
+ */
+template<typename IteratorType>
+ArenaVector<AnnouncedLink>
+gatherAnnouncedLinks(IteratorType first, IteratorType last, NameMap& map, Arena& arena)
+{
+  auto nRouters = static_cast<int32_t>(map.size());
+  ArenaVector<AnnouncedLink> links(arena);
 
   // For each LSA represented in the map
-  auto lsaRange = lsdb.getLsdbIterator<AdjLsa>();
-  for (auto lsaIt = lsaRange.first; lsaIt != lsaRange.second; ++lsaIt) {
+  for (auto lsaIt = first; lsaIt != last; ++lsaIt) {
     auto adjLsa = std::static_pointer_cast<AdjLsa>(*lsaIt);
     auto row = map.getMappingNoByRouterName(adjLsa->getOriginRouter());
 
-    std::list<Adjacent> adl = adjLsa->getAdl().getAdjList();
+    const auto& adl = adjLsa->getAdl().getAdjList();
     // For each adjacency represented in the LSA
     for (const auto& adjacent : adl) {
       auto col = map.getMappingNoByRouterName(adjacent.getName());
-      double cost = adjacent.getLinkCost();
-
-      if (row && col && *row < static_cast<int32_t>(nRouters)
-          && *col < static_cast<int32_t>(nRouters)) {
-        matrix[*row][*col] = cost;
+      if (row && col && *row < nRouters && *col < nRouters) {
+        links.push_back(AnnouncedLink{*row, *col, &adjacent});
       }
     }
   }
+  return links;
+}
+
+/**
+ * @brief Allocate and populate adjacency matrix.
+ *
+ * The adjacency matrix is resized to @p nRouters .
+ * Costs of @p links in @p topology , or their link costs if @p topology is nullptr, are filled
+ * into the matrix; in case of a mismatch in bidirectional costs, the higher cost is assigned
+ * for both directions.
+ * All other elements are set to @c NON_ADJACENT_COST .
+ */
+AdjMatrix
+makeAdjMatrix(const ArenaVector<AnnouncedLink>& links, size_t nRouters, const Topology* topology,
+              Arena& arena)
+{
+  // Create the matrix to have N rows and N columns, where N is number of routers.
+  AdjMatrix matrix = allocateAdjMatrix(nRouters, arena);
+
+  // Initialize all elements to NON_ADJACENT_COST.
+  std::fill_n(matrix.origin(), matrix.num_elements(), Adjacent::NON_ADJACENT_COST);
+
+  for (const auto& link : links) {
+    matrix[link.row][link.col] = topology == nullptr ?
+                                 link.adjacent->getLinkCost() :
+                                 getTopologyLinkCost(*link.adjacent, *topology);
+  }
 
   // Links that do not have the same cost for both directions should
   // have their costs corrected:
@@ -168,8 +219,33 @@ makeAdjMatrix(const Lsdb& lsdb, NameMap& map)
   return matrix;
 }
 
+/**
+ * @brief Flag the routers in @p map whose Adjacency LSA forbids transit traffic.
+ */
+template<typename IteratorType>
+ArenaVector<bool>
+gatherNoTransitRouters(IteratorType first, IteratorType last, const NameMap& map, Arena& arena)
+{
+  ArenaVector<bool> noTransit(map.size(), false, arena);
+  for (auto lsaIt = first; lsaIt != last; ++lsaIt) {
+    auto adjLsa = std::static_pointer_cast<AdjLsa>(*lsaIt);
+    auto router = map.getMappingNoByRouterName(adjLsa->getOriginRouter());
+    if (router && static_cast<size_t>(*router) < noTransit.size()) {
+      noTransit[*router] = adjLsa->isNoTransit();
+    }
+  }
+  return noTransit;
+}
+
+template<typename IteratorType>
+AdjMatrix
+makeAdjMatrix(IteratorType first, IteratorType last, NameMap& map, Arena& arena)
+{
+  return makeAdjMatrix(gatherAnnouncedLinks(first, last, map, arena), map.size(), nullptr, arena);
+}
+
 void
-sortQueueByDistance(std::vector<int>& q, const std::vector<double>& dist, size_t start)
+sortQueueByDistance(ArenaVector<int>& q, const ArenaVector<double>& dist, size_t start)
 {
   for (size_t i = start; i < q.size(); ++i) {
     for (size_t j = i + 1; j < q.size(); ++j) {
@@ -181,7 +257,7 @@ sortQueueByDistance(std::vector<int>& q, const std::vector<double>& dist, size_t
 }
 
 bool
-isNotExplored(std::vector<int>& q, int u, size_t start)
+isNotExplored(ArenaVector<int>& q, int u, size_t start)
 {
   for (size_t i = start; i < q.size(); i++) {
     if (q[i] == u) {
@@ -200,11 +276,11 @@ struct Link
 /**
  * @brief List adjacencies and link costs from a source router.
  */
-std::vector<Link>
-gatherLinks(const AdjMatrix& matrix, int sourceRouter)
+ArenaVector<Link>
+gatherLinks(const AdjMatrix& matrix, int sourceRouter, Arena& arena)
 {
   size_t nRouters = matrix.size();
-  std::vector<Link> result;
+  ArenaVector<Link> result(arena);
   result.reserve(nRouters);
   for (size_t i = 0; i < nRouters; ++i) {
     if (i == static_cast<size_t>(sourceRouter)) {
@@ -254,22 +330,22 @@ public:
   }
 
 public:
-  std::vector<int> parent;
-  std::vector<double> distance;
+  ArenaVector<int> parent;
+  ArenaVector<double> distance;
 };
 
 /**
  * @brief Compute the shortest path from a source router to every other router.
  */
 DijkstraResult
-calculateDijkstraPath(const AdjMatrix& matrix, int sourceRouter)
+calculateDijkstraPath(const AdjMatrix& matrix, int sourceRouter, Arena& arena)
 {
   size_t nRouters = matrix.size();
-  std::vector<int> parent(nRouters, EMPTY_PARENT);
+  ArenaVector<int> parent(nRouters, EMPTY_PARENT, arena);
   // Array where the ith element is the distance to the router with mapping no i.
-  std::vector<double> distance(nRouters, INF_DISTANCE);
+  ArenaVector<double> distance(nRouters, INF_DISTANCE, arena);
   // Each cell represents the router with that mapping no.
-  std::vector<int> q(nRouters);
+  ArenaVector<int> q(nRouters, 0, arena);
   for (size_t i = 0 ; i < nRouters; ++i) {
     q[i] = static_cast<int>(i);
   }
@@ -308,24 +384,386 @@ calculateDijkstraPath(const AdjMatrix& matrix, int sourceRouter)
   return DijkstraResult{std::move(parent), std::move(distance)};
 }
 
+/**
+ * @brief Shortest paths over a reduced graph, expanded to all routers.
+ *
+ * Routers that never carry transit traffic do not change the shortest paths between the
+ * other routers, so they are removed before Dijkstra's algorithm runs:
+ *  - routers whose Adjacency LSA carries the no-transit flag;
+ *  - degree-1 routers, repeatedly, so that whole trees hanging off the network disappear;
+ *  - chains of degree-2 routers, each replaced by one link with the cost of the chain.
+ *
+ * The distances and parents of the removed routers are then derived from those of the
+ * routers they hang off. This gives the same distances as Dijkstra's algorithm over the
+ * whole matrix, and the same paths up to the choice among paths of equal cost.
+ *
+ * Links are those with a non-negative cost in both directions; the row of the source
+ * router alone may further disable links, as done by simulateOneNeighbor().
+ */
+class ReducedGraph
+{
+public:
+  ReducedGraph(const AdjMatrix& matrix, int sourceRouter, const ArenaVector<bool>& noTransit,
+               Arena& arena);
+
+  DijkstraResult
+  calculatePath() const;
+
+private:
+  bool
+  isLinked(size_t u, size_t v) const
+  {
+    return u != v && m_matrix[u][v] >= 0 && m_matrix[v][u] >= 0;
+  }
+
+  bool
+  isNoTransit(size_t router) const
+  {
+    return static_cast<int>(router) != m_source && router < m_noTransit.size() &&
+           m_noTransit[router];
+  }
+
+private:
+  /// A degree-1 router, attached to a single router or to none if it is isolated
+  struct Stub
+  {
+    int router;
+    int attachedTo;
+  };
+
+  /// Routers of a chain, including the routers at both ends
+  using Chain = ArenaVector<int>;
+
+  const AdjMatrix& m_matrix;
+  int m_source;
+  const ArenaVector<bool>& m_noTransit;
+  Arena& m_arena;
+
+  ArenaVector<int> m_noTransitRouters;
+  /// in the order of their removal
+  ArenaVector<Stub> m_stubs;
+  ArenaVector<Chain> m_chains;
+  /// chains that replace the link between their ends, keyed by (front, back) and (back, front)
+  ArenaMap<std::pair<int, int>, size_t> m_chainLinks;
+
+  /// routers in the reduced graph, indexed by their position in m_coreMatrix
+  ArenaVector<int> m_core;
+  AdjMatrix m_coreMatrix;
+};
+
+ReducedGraph::ReducedGraph(const AdjMatrix& matrix, int sourceRouter,
+                           const ArenaVector<bool>& noTransit, Arena& arena)
+  : m_matrix(matrix)
+  , m_source(sourceRouter)
+  , m_noTransit(noTransit)
+  , m_arena(arena)
+  , m_noTransitRouters(arena)
+  , m_stubs(arena)
+  , m_chains(arena)
+  , m_chainLinks(arena)
+  , m_core(arena)
+  , m_coreMatrix(allocateAdjMatrix(0, arena))
+{
+  int nRouters = static_cast<int>(matrix.size());
+  ArenaVector<bool> isRemoved(nRouters, false, arena);
+  for (int i = 0; i < nRouters; ++i) {
+    if (isNoTransit(i)) {
+      isRemoved[i] = true;
+      m_noTransitRouters.push_back(i);
+    }
+  }
+
+  ArenaVector<ArenaVector<int>> neighbors(nRouters, ArenaVector<int>(arena), arena);
+  for (int u = 0; u < nRouters; ++u) {
+    for (int v = u + 1; v < nRouters; ++v) {
+      if (!isRemoved[u] && !isRemoved[v] && isLinked(u, v)) {
+        neighbors[u].push_back(v);
+        neighbors[v].push_back(u);
+      }
+    }
+  }
+  ArenaVector<size_t> degree(nRouters, 0, arena);
+  for (int u = 0; u < nRouters; ++u) {
+    degree[u] = neighbors[u].size();
+  }
+
+  // Prune degree-1 routers until none is left
+  ArenaVector<int> stubs(arena);
+  for (int u = 0; u < nRouters; ++u) {
+    if (!isRemoved[u] && u != m_source && degree[u] <= 1) {
+      stubs.push_back(u);
+    }
+  }
+  while (!stubs.empty()) {
+    int u = stubs.back();
+    stubs.pop_back();
+    auto it = std::find_if(neighbors[u].begin(), neighbors[u].end(),
+                           [&] (int v) { return !isRemoved[v]; });
+    int attachedTo = it == neighbors[u].end() ? -1 : *it;
+    isRemoved[u] = true;
+    m_stubs.push_back(Stub{u, attachedTo});
+    if (attachedTo >= 0 && --degree[attachedTo] == 1 && attachedTo != m_source) {
+      stubs.push_back(attachedTo);
+    }
+  }
+
+  // Collapse chains of degree-2 routers
+  auto isChainRouter = [&] (int u) {
+    return !isRemoved[u] && u != m_source && degree[u] == 2;
+  };
+  auto getOtherNeighbor = [&] (int u, int previous) {
+    for (int v : neighbors[u]) {
+      if (!isRemoved[v] && v != previous) {
+        return v;
+      }
+    }
+    return -1;
+  };
+  // Walk from start through next, until the first router that is not in the chain
+  auto walk = [&] (int start, int next) {
+    Chain routers(arena);
+    int previous = start;
+    while (isChainRouter(next) && next != start) {
+      routers.push_back(next);
+      int following = getOtherNeighbor(next, previous);
+      previous = next;
+      next = following;
+    }
+    routers.push_back(next);
+    return routers;
+  };
+
+  ArenaVector<bool> isVisited(nRouters, false, arena);
+  ArenaMap<std::pair<int, int>, double> chainLinkCosts(arena);
+  for (int x = 0; x < nRouters; ++x) {
+    if (!isChainRouter(x) || isVisited[x]) {
+      continue;
+    }
+    int first = getOtherNeighbor(x, -1);
+    auto left = walk(x, first);
+    if (left.back() == x) {
+      // a ring of degree-2 routers is disconnected from the source router
+      for (int u : left) {
+        isVisited[u] = true;
+      }
+      continue;
+    }
+    auto right = walk(x, getOtherNeighbor(x, first));
+
+    Chain chain(left.rbegin(), left.rend(), arena);
+    chain.push_back(x);
+    chain.insert(chain.end(), right.begin(), right.end());
+    for (size_t i = 1; i + 1 < chain.size(); ++i) {
+      isVisited[chain[i]] = true;
+    }
+    // The first hop of a path from the source router must stay visible
+    if (chain.front() == m_source || chain.back() == m_source) {
+      continue;
+    }
+
+    for (size_t i = 1; i + 1 < chain.size(); ++i) {
+      isRemoved[chain[i]] = true;
+    }
+    if (chain.front() != chain.back()) {
+      double cost = 0;
+      for (size_t i = 1; i < chain.size(); ++i) {
+        cost += m_matrix[chain[i - 1]][chain[i]];
+      }
+      std::pair<int, int> key = std::minmax(chain.front(), chain.back());
+      auto bestCost = chainLinkCosts.find(key);
+      if (bestCost == chainLinkCosts.end() || cost < bestCost->second) {
+        chainLinkCosts[key] = cost;
+        m_chainLinks[{chain.front(), chain.back()}] = m_chains.size();
+        m_chainLinks[{chain.back(), chain.front()}] = m_chains.size();
+      }
+    }
+    m_chains.push_back(std::move(chain));
+  }
+
+  // Build the matrix of the remaining routers
+  ArenaVector<int> coreIndex(nRouters, -1, arena);
+  for (int u = 0; u < nRouters; ++u) {
+    if (!isRemoved[u]) {
+      coreIndex[u] = static_cast<int>(m_core.size());
+      m_core.push_back(u);
+    }
+  }
+  size_t nCore = m_core.size();
+  m_coreMatrix.resize(boost::extents[nCore][nCore]);
+  for (size_t i = 0; i < nCore; ++i) {
+    for (size_t j = 0; j < nCore; ++j) {
+      m_coreMatrix[i][j] = m_matrix[m_core[i]][m_core[j]];
+    }
+  }
+  for (auto it = m_chainLinks.begin(); it != m_chainLinks.end();) {
+    auto [front, back] = it->first;
+    double& cost = m_coreMatrix[coreIndex[front]][coreIndex[back]];
+    double chainCost = chainLinkCosts[std::minmax(front, back)];
+    // A direct link that is not more expensive is preferred over the chain
+    if (cost >= 0 && cost <= chainCost) {
+      it = m_chainLinks.erase(it);
+      continue;
+    }
+    cost = chainCost;
+    ++it;
+  }
+
+  NLSR_LOG_DEBUG("Reduced " << nRouters << " routers to " << nCore << " (" <<
+                 m_noTransitRouters.size() << " no-transit, " << m_stubs.size() << " stubs, " <<
+                 m_chains.size() << " chains)");
+}
+
+DijkstraResult
+ReducedGraph::calculatePath() const
+{
+  size_t nRouters = m_matrix.size();
+  ArenaVector<int> parent(nRouters, EMPTY_PARENT, m_arena);
+  ArenaVector<double> distance(nRouters, INF_DISTANCE, m_arena);
+
+  auto sourceIt = std::find(m_core.begin(), m_core.end(), m_source);
+  auto core = calculateDijkstraPath(m_coreMatrix, static_cast<int>(sourceIt - m_core.begin()),
+                                    m_arena);
+  for (size_t i = 0; i < m_core.size(); ++i) {
+    int router = m_core[i];
+    distance[router] = core.distance[i];
+    if (core.parent[i] == EMPTY_PARENT) {
+      continue;
+    }
+    int coreParent = m_core[core.parent[i]];
+    auto chainLink = m_chainLinks.find({coreParent, router});
+    if (chainLink == m_chainLinks.end()) {
+      parent[router] = coreParent;
+    }
+    else {
+      const auto& chain = m_chains[chainLink->second];
+      parent[router] = chain.front() == router ? chain[1] : chain[chain.size() - 2];
+    }
+  }
+
+  for (const auto& chain : m_chains) {
+    size_t last = chain.size() - 1;
+    ArenaVector<double> viaFront(chain.size(), INF_DISTANCE, m_arena);
+    ArenaVector<double> viaBack(chain.size(), INF_DISTANCE, m_arena);
+    viaFront[0] = distance[chain[0]];
+    for (size_t i = 1; i < last && viaFront[0] != INF_DISTANCE; ++i) {
+      viaFront[i] = viaFront[i - 1] + m_matrix[chain[i - 1]][chain[i]];
+    }
+    viaBack[last] = distance[chain[last]];
+    for (size_t i = last - 1; i > 0 && viaBack[last] != INF_DISTANCE; --i) {
+      viaBack[i] = viaBack[i + 1] + m_matrix[chain[i + 1]][chain[i]];
+    }
+
+    // When the chain is on the path to one of its ends, all its routers are reached from
+    // the other end, regardless of rounding in the sums of costs
+    bool isFromFront = parent[chain[last]] == chain[last - 1];
+    bool isFromBack = parent[chain[0]] == chain[1];
+    for (size_t i = 1; i < last; ++i) {
+      bool useFront = isFromFront ||
+                      (!isFromBack && viaFront[i] <= viaBack[i] && viaFront[i] != INF_DISTANCE);
+      if (useFront) {
+        distance[chain[i]] = viaFront[i];
+        parent[chain[i]] = chain[i - 1];
+      }
+      else if (viaBack[i] != INF_DISTANCE) {
+        distance[chain[i]] = viaBack[i];
+        parent[chain[i]] = chain[i + 1];
+      }
+    }
+  }
+
+  for (auto it = m_stubs.rbegin(); it != m_stubs.rend(); ++it) {
+    if (it->attachedTo < 0 || distance[it->attachedTo] == INF_DISTANCE) {
+      continue;
+    }
+    distance[it->router] = distance[it->attachedTo] + m_matrix[it->attachedTo][it->router];
+    parent[it->router] = it->attachedTo;
+  }
+
+  for (int router : m_noTransitRouters) {
+    for (size_t u = 0; u < nRouters; ++u) {
+      if (!isLinked(u, router) || isNoTransit(u) || distance[u] == INF_DISTANCE) {
+        continue;
+      }
+      double newDistance = distance[u] + m_matrix[u][router];
+      if (newDistance < distance[router]) {
+        distance[router] = newDistance;
+        parent[router] = static_cast<int>(u);
+      }
+    }
+  }
+
+  return DijkstraResult{std::move(parent), std::move(distance)};
+}
+
+/**
+ * @brief State shared by the shortest path computations of one routing calculation.
+ */
+struct Calculation
+{
+  using AddNextHop = std::function<void(const ndn::Name& destination, NextHop& nh,
+                                        const std::string& topology)>;
+
+  const NameMap& map;
+  int sourceRouter;
+  /// receives the next hops towards each destination
+  AddNextHop addNextHop;
+  const ConfParameter& confParam;
+  Arena& arena;
+  /// whether each router, by mapping number, must not be transited
+  ArenaVector<bool> noTransit;
+  /// FaceUri of each neighbor by mapping number, or nullptr for other routers
+  ArenaVector<const ndn::FaceUri*> nextHopFaces;
+};
+
+/**
+ * @brief Index the FaceUris of the neighbors by their mapping number.
+ *
+ * Next hops are then resolved with one lookup, instead of a search of the adjacency list
+ * and a copy of the adjacency for each destination.
+ */
+ArenaVector<const ndn::FaceUri*>
+indexNextHopFaces(const NameMap& map, const AdjacencyList& adjacencies, Arena& arena)
+{
+  ArenaVector<const ndn::FaceUri*> faces(map.size(), nullptr, arena);
+  for (const auto& adjacent : adjacencies.getAdjList()) {
+    auto router = map.getMappingNoByRouterName(adjacent.getName());
+    if (router && static_cast<size_t>(*router) < faces.size()) {
+      faces[*router] = &adjacent.getFaceUri();
+    }
+  }
+  return faces;
+}
+
+/**
+ * @brief Make a Calculation::AddNextHop that inserts next hops into @p rt .
+ */
+Calculation::AddNextHop
+makeRoutingTableSink(RoutingTable& rt)
+{
+  return [&rt] (const ndn::Name& destination, NextHop& nh, const std::string& topology) {
+    rt.addNextHop(destination, nh, topology);
+  };
+}
+
 /**
  * @brief Insert shortest paths into the routing table.
  */
 void
-addNextHopsToRoutingTable(RoutingTable& rt, const NameMap& map, int sourceRouter,
-                          const AdjacencyList& adjacencies, const DijkstraResult& dr)
+addNextHopsToRoutingTable(const Calculation& calc, const DijkstraResult& dr,
+                          const std::string& topology)
 {
   NLSR_LOG_DEBUG("addNextHopsToRoutingTable Called");
-  int nRouters = static_cast<int>(map.size());
+  static const ndn::FaceUri NO_FACE;
+  int nRouters = static_cast<int>(calc.map.size());
 
   // For each router we have
   for (int i = 0; i < nRouters; ++i) {
-    if (i == sourceRouter) {
+    if (i == calc.sourceRouter) {
       continue;
     }
 
     // Obtain the next hop that was determined by the algorithm
-    int nextHopRouter = dr.getNextHop(i, sourceRouter);
+    int nextHopRouter = dr.getNextHop(i, calc.sourceRouter);
     if (nextHopRouter == NO_NEXT_HOP) {
       continue;
     }
@@ -333,13 +771,90 @@ addNextHopsToRoutingTable(RoutingTable& rt, const NameMap& map, int sourceRouter
 
     // Fetch its distance
     double routeCost = dr.distance[i];
-    // Fetch its actual name
-    auto nextHopRouterName = map.getRouterNameByMappingNo(nextHopRouter);
-    BOOST_ASSERT(nextHopRouterName.has_value());
-    auto nextHopFace = adjacencies.getAdjacent(*nextHopRouterName).getFaceUri();
+    const ndn::FaceUri* nextHopFace = calc.nextHopFaces[nextHopRouter];
     // Add next hop to routing table
-    NextHop nh(nextHopFace, routeCost);
-    rt.addNextHop(*map.getRouterNameByMappingNo(i), nh);
+    NextHop nh(nextHopFace == nullptr ? NO_FACE : *nextHopFace, routeCost);
+    calc.addNextHop(*calc.map.getRouterNameByMappingNo(i), nh, topology);
+  }
+}
+
+/**
+ * @brief Insert the shortest paths over @p matrix into the routing table of @p topology .
+ */
+void
+addShortestPaths(AdjMatrix& matrix, const Calculation& calc, const std::string& topology)
+{
+  if (calc.confParam.getMaxFacesPerPrefix() == 1) {
+    // In the single path case we can simply run Dijkstra's algorithm.
+    auto dr = ReducedGraph(matrix, calc.sourceRouter, calc.noTransit, calc.arena).calculatePath();
+    // Inform the routing table of the new next hops.
+    addNextHopsToRoutingTable(calc, dr, topology);
+  }
+  else {
+    // Multi Path
+    // Gets a sparse listing of adjacencies for path calculation
+    auto links = gatherLinks(matrix, calc.sourceRouter, calc.arena);
+    for (const auto& link : links) {
+      // The Dijkstra buffers of one neighbor are released before the next one
+      util::ArenaScope scope(calc.arena);
+      // Simulate that only the current neighbor is accessible
+      simulateOneNeighbor(matrix, calc.sourceRouter, link);
+      NLSR_LOG_DEBUG((PrintAdjMatrix{matrix, calc.map}));
+      // Do Dijkstra's algorithm using the current neighbor as your start.
+      auto dr = ReducedGraph(matrix, calc.sourceRouter, calc.noTransit, calc.arena).calculatePath();
+      // Update the routing table with the calculations.
+      addNextHopsToRoutingTable(calc, dr, topology);
+    }
+  }
+}
+
+/**
+ * @brief Apply hypothetical @p changes to @p matrix .
+ *
+ * Changes that refer to routers or links absent from @p matrix are ignored.
+ */
+void
+applyTopologyChanges(AdjMatrix& matrix, const NameMap& map,
+                     const std::vector<TopologyChange>& changes)
+{
+  size_t nRouters = map.size();
+  for (const auto& change : changes) {
+    auto router = map.getMappingNoByRouterName(change.getRouter());
+    if (!router || static_cast<size_t>(*router) >= nRouters) {
+      continue;
+    }
+
+    if (change.getKind() == TopologyChange::Kind::ROUTER_DOWN) {
+      for (size_t other = 0; other < nRouters; ++other) {
+        matrix[*router][other] = Adjacent::NON_ADJACENT_COST;
+        matrix[other][*router] = Adjacent::NON_ADJACENT_COST;
+      }
+      continue;
+    }
+
+    auto other = map.getMappingNoByRouterName(change.getOtherRouter());
+    if (!other || static_cast<size_t>(*other) >= nRouters || matrix[*router][*other] < 0) {
+      continue;
+    }
+    double cost = change.getKind() == TopologyChange::Kind::LINK_DOWN ?
+                  Adjacent::NON_ADJACENT_COST : change.getCost();
+    matrix[*router][*other] = cost;
+    matrix[*other][*router] = cost;
+  }
+}
+
+/**
+ * @brief Insert the shortest paths of each configured topology into its routing table.
+ */
+void
+addTopologyShortestPaths(const ArenaVector<AnnouncedLink>& links, const Calculation& calc)
+{
+  for (const auto& topology : calc.confParam.getTopologies()) {
+    // Each topology reuses the storage of the matrix of the previous one
+    util::ArenaScope scope(calc.arena);
+    AdjMatrix matrix = makeAdjMatrix(links, calc.map.size(), &topology, calc.arena);
+    NLSR_LOG_DEBUG("Topology " << topology.name << ":\n" << (PrintAdjMatrix{matrix, calc.map}));
+    addShortestPaths(matrix, calc, topology.name);
   }
 }
 
@@ -357,29 +872,98 @@ calculateLinkStateRoutingPath(NameMap& map, RoutingTable& rt, ConfParameter& con
     return;
   }
 
-  AdjMatrix matrix = makeAdjMatrix(lsdb, map);
+  NLSR_TRACE(spf__begin, map.size());
+  Arena& arena = rt.getCalculationArena();
+  // The links are gathered once and shared by all topologies
+  auto lsaRange = lsdb.getLsdbIterator<AdjLsa>();
+  auto links = gatherAnnouncedLinks(lsaRange.first, lsaRange.second, map, arena);
+  Calculation calc{map, *sourceRouter, makeRoutingTableSink(rt), confParam, arena,
+                   gatherNoTransitRouters(lsaRange.first, lsaRange.second, map, arena),
+                   indexNextHopFaces(map, confParam.getAdjacencyList(), arena)};
+
+  AdjMatrix matrix = makeAdjMatrix(links, map.size(), nullptr, arena);
   NLSR_LOG_DEBUG((PrintAdjMatrix{matrix, map}));
+  addShortestPaths(matrix, calc, "");
 
-  if (confParam.getMaxFacesPerPrefix() == 1) {
-    // In the single path case we can simply run Dijkstra's algorithm.
-    auto dr = calculateDijkstraPath(matrix, *sourceRouter);
-    // Inform the routing table of the new next hops.
-    addNextHopsToRoutingTable(rt, map, *sourceRouter, confParam.getAdjacencyList(), dr);
+  addTopologyShortestPaths(links, calc);
+  NLSR_TRACE(spf__end, map.size(), rt.getRoutingTableEntry().size());
+}
+
+void
+calculateTopologyRoutingPaths(NameMap& map, RoutingTable& rt, ConfParameter& confParam,
+                              const Lsdb& lsdb)
+{
+  auto sourceRouter = map.getMappingNoByRouterName(confParam.getRouterPrefix());
+  if (confParam.getTopologies().empty() || !sourceRouter) {
+    return;
   }
-  else {
-    // Multi Path
-    // Gets a sparse listing of adjacencies for path calculation
-    auto links = gatherLinks(matrix, *sourceRouter);
-    for (const auto& link : links) {
-      // Simulate that only the current neighbor is accessible
-      simulateOneNeighbor(matrix, *sourceRouter, link);
-      NLSR_LOG_DEBUG((PrintAdjMatrix{matrix, map}));
-      // Do Dijkstra's algorithm using the current neighbor as your start.
-      auto dr = calculateDijkstraPath(matrix, *sourceRouter);
-      // Update the routing table with the calculations.
-      addNextHopsToRoutingTable(rt, map, *sourceRouter, confParam.getAdjacencyList(), dr);
+
+  Arena& arena = rt.getCalculationArena();
+  auto lsaRange = lsdb.getLsdbIterator<AdjLsa>();
+  auto links = gatherAnnouncedLinks(lsaRange.first, lsaRange.second, map, arena);
+  Calculation calc{map, *sourceRouter, makeRoutingTableSink(rt), confParam, arena,
+                   gatherNoTransitRouters(lsaRange.first, lsaRange.second, map, arena),
+                   indexNextHopFaces(map, confParam.getAdjacencyList(), arena)};
+  addTopologyShortestPaths(links, calc);
+}
+
+std::map<ndn::Name, NexthopList>
+calculateLinkStatePaths(const Lsdb& lsdb, const ConfParameter& confParam,
+                        const std::vector<TopologyChange>& changes)
+{
+  std::map<ndn::Name, NexthopList> paths;
+
+  auto lsaRange = lsdb.getLsdbIterator<AdjLsa>();
+  auto map = NameMap::createFromAdjLsdb(lsaRange.first, lsaRange.second);
+  auto sourceRouter = map.getMappingNoByRouterName(confParam.getRouterPrefix());
+  if (!sourceRouter) {
+    return paths;
+  }
+
+  // The LSAs are the shared, read-only snapshot of the topology, and the changes are only
+  // applied to the matrix of this calculation
+  Arena arena;
+  auto links = gatherAnnouncedLinks(lsaRange.first, lsaRange.second, map, arena);
+  Calculation calc{map, *sourceRouter,
+                   [&paths] (const ndn::Name& destination, NextHop& nh, const std::string&) {
+                     paths[destination].addNextHop(nh);
+                   },
+                   confParam, arena,
+                   gatherNoTransitRouters(lsaRange.first, lsaRange.second, map, arena),
+                   indexNextHopFaces(map, confParam.getAdjacencyList(), arena)};
+
+  AdjMatrix matrix = makeAdjMatrix(links, map.size(), nullptr, arena);
+  applyTopologyChanges(matrix, map, changes);
+  addShortestPaths(matrix, calc, "");
+  return paths;
+}
+
+std::map<ndn::Name, double>
+calculateLinkStateDistances(const std::vector<std::shared_ptr<Lsa>>& adjLsas,
+                            const ndn::Name& sourceRouterName)
+{
+  std::map<ndn::Name, double> distances;
+
+  // Only the origins are mapped: links to routers outside of adjLsas are ignored
+  NameMap map;
+  for (const auto& lsa : adjLsas) {
+    map.addEntry(lsa->getOriginRouter());
+  }
+  auto sourceRouter = map.getMappingNoByRouterName(sourceRouterName);
+  if (!sourceRouter) {
+    return distances;
+  }
+
+  Arena arena;
+  AdjMatrix matrix = makeAdjMatrix(adjLsas.begin(), adjLsas.end(), map, arena);
+  auto noTransit = gatherNoTransitRouters(adjLsas.begin(), adjLsas.end(), map, arena);
+  auto dr = ReducedGraph(matrix, *sourceRouter, noTransit, arena).calculatePath();
+  for (size_t i = 0; i < map.size(); ++i) {
+    if (dr.distance[i] != INF_DISTANCE) {
+      distances.emplace(*map.getRouterNameByMappingNo(i), dr.distance[i]);
     }
   }
+  return distances;
 }
 
 } // namespace nlsr
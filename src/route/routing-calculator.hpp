@@ -23,21 +23,61 @@
 
 #include "common.hpp"
 #include "lsdb.hpp"
+#include "route/nexthop-list.hpp"
+#include "route/topology-change.hpp"
+
+#include <map>
+#include <vector>
 
 namespace nlsr {
 
 class NameMap;
 class RoutingTable;
 
+/*! \brief Computes the routing table of the default topology and of each configured topology.
+ */
 void
 calculateLinkStateRoutingPath(NameMap& map, RoutingTable& rt, ConfParameter& confParam,
                               const Lsdb& lsdb);
 
+/*! \brief Computes the routing table of each configured topology, but not of the default one.
+ *
+ * Used when the default topology is computed by another calculator.
+ */
+void
+calculateTopologyRoutingPaths(NameMap& map, RoutingTable& rt, ConfParameter& confParam,
+                              const Lsdb& lsdb);
+
 void
 calculateHyperbolicRoutingPath(NameMap& map, RoutingTable& rt, Lsdb& lsdb,
                                AdjacencyList& adjacencies, ndn::Name thisRouterName,
                                bool isDryRun);
 
+/*! \brief Computes the next hops of the default topology towards every router reachable
+ *         from this one, as if \p changes had been applied to the topology.
+ *
+ * Neither the LSDB nor any routing table is modified, and changes that refer to unknown
+ * routers or links are ignored.
+ *
+ * \return the next hops towards each reachable router, sorted by cost
+ */
+std::map<ndn::Name, NexthopList>
+calculateLinkStatePaths(const Lsdb& lsdb, const ConfParameter& confParam,
+                        const std::vector<TopologyChange>& changes);
+
+/*! \brief Computes the cost of the shortest path from \p sourceRouterName to every
+ *         router reachable over the links advertised in \p adjLsas.
+ *
+ * Only the given Adjacency LSAs are considered, and links to routers without an LSA
+ * among them are ignored, so that an area border router can compute the distances
+ * within one of its areas.
+ *
+ * \return the distance of each reachable router, including the source itself
+ */
+std::map<ndn::Name, double>
+calculateLinkStateDistances(const std::vector<std::shared_ptr<Lsa>>& adjLsas,
+                            const ndn::Name& sourceRouterName);
+
 } // namespace nlsr
 
 #endif // NLSR_ROUTING_CALCULATOR_HPP
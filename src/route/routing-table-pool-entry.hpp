@@ -25,6 +25,7 @@
 #include "nexthop-list.hpp"
 
 #include <ndn-cxx/name.hpp>
+#include <map>
 #include <unordered_map>
 
 namespace nlsr {
@@ -96,8 +97,25 @@ public:
     m_nexthopList = std::move(nhl);
   }
 
+  /*! \brief Returns the next hops towards the destination in \p topology.
+   *
+   * An empty \p topology denotes the default topology.
+   */
+  const NexthopList&
+  getTopologyNexthopList(const std::string& topology) const
+  {
+    static const NexthopList noNexthops;
+    if (topology.empty()) {
+      return m_nexthopList;
+    }
+    auto it = topologyNexthopLists.find(topology);
+    return it == topologyNexthopLists.end() ? noNexthops : it->second;
+  }
+
 public:
   std::unordered_map<ndn::Name, std::weak_ptr<NamePrefixTableEntry>> namePrefixTableEntries;
+  /// Next hops towards the destination in the configured topologies where it is reachable
+  std::map<std::string, NexthopList> topologyNexthopLists;
 
 private:
   uint64_t m_useCount;
@@ -12,15 +12,32 @@
 #include "load-aware-routing-calculator.hpp"
 #include "ml-adaptive-calculator.hpp"  // 注意：文件名要与实际文件名一致
 
+#include "area.hpp"
 #include "conf-parameter.hpp"
 #include "logger.hpp"
 #include "nlsr.hpp"
 #include "tlv-nlsr.hpp"
+#include "metrics/event-loop-monitor.hpp"
+#include "metrics/memory-report.hpp"
+#include "metrics/metrics-registry.hpp"
+
+#include <set>
 
 namespace nlsr {
 
 INIT_LOGGER(route.RoutingTable);
 
+namespace {
+
+auto& spfDuration = metrics::Registry::get().addHistogram("nlsr_spf_duration_seconds",
+  "Duration of routing table calculations");
+auto& spfRuns = metrics::Registry::get().addCounter("nlsr_spf_runs_total",
+  "Routing table calculations performed");
+auto& spfArenaBytes = metrics::Registry::get().addGauge("nlsr_spf_arena_bytes",
+  "Bytes allocated from the arena by the last routing table calculation");
+
+} // namespace
+
 RoutingTable::RoutingTable(ndn::Scheduler& scheduler, Lsdb& lsdb, ConfParameter& confParam)
   // ✅ 教学要点：初始化列表顺序必须与头文件中成员声明顺序完全一致
   // 这是C++的基本要求，违反会导致编译警告甚至未定义行为
@@ -69,6 +86,13 @@ RoutingTable::RoutingTable(ndn::Scheduler& scheduler, Lsdb& lsdb, ConfParameter&
         }
       }
 
+      // A new summary is only reachable once its area border router has been resolved
+      if (updateType == LsdbUpdate::INSTALLED && type == Lsa::Type::NAME &&
+          area::getSummarizedArea(lsa->getOriginRouter()) &&
+          area::getAdvertisingRouter(lsa->getOriginRouter()) != m_confParam.getRouterPrefix()) {
+        scheduleCalculation = true;
+      }
+
       if (scheduleCalculation) {
         scheduleRoutingTableCalculation();
       }
@@ -86,11 +110,14 @@ RoutingTable::~RoutingTable()
 
 void RoutingTable::calculate()
 {
+  metrics::HandlerScope scope(metrics::HandlerTag::ROUTING_TABLE, "calculate");
   m_lsdb.writeLog();
   NLSR_LOG_TRACE("Calculating routing table");
 
   if (m_isRoutingTableCalculating == false) {
     m_isRoutingTableCalculating = true;
+    metrics::ScopedTimer spfTimer(spfDuration);
+    spfRuns.increment();
 
     // ✅ 教学要点：算法优先级设计的考虑
     // ML自适应算法优先级最高，因为它能学习和适应网络变化
@@ -118,6 +145,10 @@ void RoutingTable::calculate()
       calculateHypRoutingTable(false);
     }
 
+    // The result is published, release the intermediate structures at once
+    spfArenaBytes.set(static_cast<int64_t>(m_calculationArena.getUsedBytes()));
+    m_calculationArena.reset();
+
     m_isRouteCalculationScheduled = false;
     m_isRoutingTableCalculating = false;
   }
@@ -162,6 +193,8 @@ RoutingTable::calculateLoadAwareRoutingTable()
   }
 
   m_loadAwareCalculator->calculatePath(map, *this, m_confParam, m_lsdb);
+  calculateTopologyRoutingPaths(map, *this, m_confParam, m_lsdb);
+  addSummaryRoutes();
 
   NLSR_LOG_DEBUG("Calling Update NPT With new Route");
   afterRoutingChange(m_rTable);
@@ -220,6 +253,8 @@ RoutingTable::calculateMLAdaptiveRoutingTable()
 
   // ✅ 关键设计：直接调用持久化对象方法，避免临时对象陷阱
   m_mlAdaptiveCalculator->calculatePath(map, *this, m_confParam, m_lsdb);
+  calculateTopologyRoutingPaths(map, *this, m_confParam, m_lsdb);
+  addSummaryRoutes();
 
   NLSR_LOG_DEBUG("Calling Update NPT With new Route");
   afterRoutingChange(m_rTable);
@@ -248,6 +283,7 @@ RoutingTable::calculateLsRoutingTable()
   NLSR_LOG_DEBUG(map);
 
   calculateLinkStateRoutingPath(map, *this, m_confParam, m_lsdb);
+  addSummaryRoutes();
 
   NLSR_LOG_DEBUG("Calling Update NPT With new Route");
   afterRoutingChange(m_rTable);
@@ -278,6 +314,42 @@ RoutingTable::calculateHypRoutingTable(bool isDryRun)
   }
 }
 
+void
+RoutingTable::addSummaryRoutes()
+{
+  if (m_confParam.getAreas().empty()) {
+    return;
+  }
+
+  // The names in a summary are reached through the area border router that originated it
+  auto lsaRange = m_lsdb.getLsdbIterator<NameLsa>();
+  for (auto lsaIt = lsaRange.first; lsaIt != lsaRange.second; ++lsaIt) {
+    const auto& origin = (*lsaIt)->getOriginRouter();
+    if (!area::getSummarizedArea(origin)) {
+      continue;
+    }
+    auto borderRouterEntry = findRoutingTableEntry(area::getAdvertisingRouter(origin));
+    if (borderRouterEntry == nullptr) {
+      continue;
+    }
+    auto nexthops = borderRouterEntry->getNexthopList();
+    for (NextHop nh : nexthops.getNextHops()) {
+      addNextHop(origin, nh);
+    }
+
+    for (const auto& topology : m_confParam.getTopologies()) {
+      borderRouterEntry = findRoutingTableEntry(area::getAdvertisingRouter(origin), topology.name);
+      if (borderRouterEntry == nullptr) {
+        continue;
+      }
+      nexthops = borderRouterEntry->getNexthopList();
+      for (NextHop nh : nexthops.getNextHops()) {
+        addNextHop(origin, nh, topology.name);
+      }
+    }
+  }
+}
+
 void
 RoutingTable::scheduleRoutingTableCalculation()
 {
@@ -288,6 +360,34 @@ RoutingTable::scheduleRoutingTableCalculation()
   }
 }
 
+static void
+accountRoutingTableEntries(metrics::MemoryReport& report, const std::string& subsystem,
+                           const std::list<RoutingTableEntry>& table)
+{
+  using metrics::MemoryReport;
+
+  size_t bytes = 0;
+  for (const auto& rte : table) {
+    bytes += sizeof(RoutingTableEntry) + MemoryReport::LIST_NODE_OVERHEAD +
+             MemoryReport::estimateName(rte.getDestination()) +
+             MemoryReport::estimateNexthops(rte.getNexthopList());
+  }
+  report.add(subsystem, table.size(), bytes);
+}
+
+void
+RoutingTable::accountMemory(metrics::MemoryReport& report) const
+{
+  accountRoutingTableEntries(report, "routing-table", m_rTable);
+  accountRoutingTableEntries(report, "routing-table.dry-run", m_dryTable);
+  for (const auto& [topology, table] : m_topologyTables) {
+    accountRoutingTableEntries(report, "routing-table.topology." + topology, table);
+  }
+  if (m_mlAdaptiveCalculator != nullptr) {
+    m_mlAdaptiveCalculator->accountMemory(report);
+  }
+}
+
 static bool
 routingTableEntryCompare(RoutingTableEntry& rte, ndn::Name& destRouter)
 {
@@ -295,18 +395,21 @@ routingTableEntryCompare(RoutingTableEntry& rte, ndn::Name& destRouter)
 }
 
 void
-RoutingTable::addNextHop(const ndn::Name& destRouter, NextHop& nh)
+RoutingTable::addNextHop(const ndn::Name& destRouter, NextHop& nh, const std::string& topology)
 {
-  NLSR_LOG_DEBUG("Adding " << nh << " for destination: " << destRouter);
+  NLSR_LOG_DEBUG("Adding " << nh << " for destination: " << destRouter <<
+                 (topology.empty() ? "" : " in topology " + topology));
 
-  RoutingTableEntry* rteChk = findRoutingTableEntry(destRouter);
-  if (rteChk == nullptr) {
+  auto& table = topology.empty() ? m_rTable : m_topologyTables[topology];
+  auto it = std::find_if(table.begin(), table.end(),
+                         std::bind(&routingTableEntryCompare, _1, destRouter));
+  if (it == table.end()) {
     RoutingTableEntry rte(destRouter);
     rte.getNexthopList().addNextHop(nh);
-    m_rTable.push_back(rte);
+    table.push_back(rte);
   }
   else {
-    rteChk->getNexthopList().addNextHop(nh);
+    it->getNexthopList().addNextHop(nh);
   }
   m_wire.reset();
 }
@@ -314,14 +417,36 @@ RoutingTable::addNextHop(const ndn::Name& destRouter, NextHop& nh)
 RoutingTableEntry*
 RoutingTable::findRoutingTableEntry(const ndn::Name& destRouter)
 {
-  auto it = std::find_if(m_rTable.begin(), m_rTable.end(),
+  return findRoutingTableEntry(destRouter, "");
+}
+
+RoutingTableEntry*
+RoutingTable::findRoutingTableEntry(const ndn::Name& destRouter, const std::string& topology)
+{
+  std::list<RoutingTableEntry>* table = &m_rTable;
+  if (!topology.empty()) {
+    auto tableIt = m_topologyTables.find(topology);
+    if (tableIt == m_topologyTables.end()) {
+      return nullptr;
+    }
+    table = &tableIt->second;
+  }
+
+  auto it = std::find_if(table->begin(), table->end(),
                          std::bind(&routingTableEntryCompare, _1, destRouter));
-  if (it != m_rTable.end()) {
+  if (it != table->end()) {
     return &(*it);
   }
   return nullptr;
 }
 
+std::string
+RoutingTable::getTopologyOf(const ndn::Name& name) const
+{
+  const Topology* topology = findTopology(m_confParam.getTopologies(), name);
+  return topology == nullptr ? "" : topology->name;
+}
+
 void
 RoutingTable::addNextHopToDryTable(const ndn::Name& destRouter, NextHop& nh)
 {
@@ -344,6 +469,7 @@ void
 RoutingTable::clearRoutingTable()
 {
   m_rTable.clear();
+  m_topologyTables.clear();
   m_wire.reset();
 }
 
@@ -14,8 +14,10 @@
 #include "route/fib.hpp"
 #include "test-access-control.hpp"
 #include "route/name-prefix-table.hpp"
+#include "utility/arena.hpp"
 
 #include <ndn-cxx/util/scheduler.hpp>
+#include <map>
 #include <memory>
 
 namespace nlsr {
@@ -83,8 +85,12 @@ public:
   void
   calculate();
 
+  /*! \brief Adds \p nh towards \p destRouter to the routing table of \p topology.
+   *
+   * An empty \p topology denotes the default topology.
+   */
   void
-  addNextHop(const ndn::Name& destRouter, NextHop& nh);
+  addNextHop(const ndn::Name& destRouter, NextHop& nh, const std::string& topology = "");
 
   void
   addNextHopToDryTable(const ndn::Name& destRouter, NextHop& nh);
@@ -94,9 +100,48 @@ public:
   RoutingTableEntry*
   findRoutingTableEntry(const ndn::Name& destRouter);
 
+  RoutingTableEntry*
+  findRoutingTableEntry(const ndn::Name& destRouter, const std::string& topology);
+
+  /*! \brief Returns the routing tables of the configured topologies that have routes.
+   */
+  const std::map<std::string, std::list<RoutingTableEntry>>&
+  getTopologyTables() const
+  {
+    return m_topologyTables;
+  }
+
+  /*! \brief Returns the topology whose routes are used for \p name, or an empty string
+   *         for the default topology.
+   */
+  std::string
+  getTopologyOf(const ndn::Name& name) const;
+
   void
   scheduleRoutingTableCalculation();
 
+  void
+  setRoutingCalcInterval(ndn::time::seconds interval)
+  {
+    m_routingCalcInterval = interval;
+  }
+
+  /*! \brief Adds the estimated memory usage of the routing tables and ML histories to \p report.
+   */
+  void
+  accountMemory(metrics::MemoryReport& report) const;
+
+  /*! \brief Returns the arena backing the intermediate structures of the running calculation.
+   *
+   * The arena is reset once the result of each calculation has been published, so nothing
+   * allocated from it may outlive calculate().
+   */
+  util::Arena&
+  getCalculationArena()
+  {
+    return m_calculationArena;
+  }
+
 private:
   void
   calculateLsRoutingTable();
@@ -104,6 +149,11 @@ private:
   void
   calculateHypRoutingTable(bool isDryRun);
 
+  /*! \brief Routes the origin of each summary LSA like its area border router.
+   */
+  void
+  addSummaryRoutes();
+
   void
   clearRoutingTable();
 
@@ -144,8 +194,11 @@ private:
   std::unique_ptr<LoadAwareRoutingCalculator> m_loadAwareCalculator;
   std::unique_ptr<MLAdaptiveCalculator> m_mlAdaptiveCalculator;  // 注意类名
 
+  util::Arena m_calculationArena;
+
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   // 测试访问控制成员保持不变
+  std::map<std::string, std::list<RoutingTableEntry>> m_topologyTables;
 };
 
 } // namespace nlsr
@@ -0,0 +1,193 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "topology-change.hpp"
+#include "tlv-nlsr.hpp"
+
+#include <ndn-cxx/encoding/block-helpers.hpp>
+
+namespace nlsr {
+
+TopologyChange
+TopologyChange::makeLinkDown(const ndn::Name& router, const ndn::Name& otherRouter)
+{
+  TopologyChange change;
+  change.m_kind = Kind::LINK_DOWN;
+  change.m_router = router;
+  change.m_otherRouter = otherRouter;
+  return change;
+}
+
+TopologyChange
+TopologyChange::makeLinkCost(const ndn::Name& router, const ndn::Name& otherRouter, double cost)
+{
+  TopologyChange change;
+  change.m_kind = Kind::LINK_COST;
+  change.m_router = router;
+  change.m_otherRouter = otherRouter;
+  change.m_cost = cost;
+  return change;
+}
+
+TopologyChange
+TopologyChange::makeRouterDown(const ndn::Name& router)
+{
+  TopologyChange change;
+  change.m_kind = Kind::ROUTER_DOWN;
+  change.m_router = router;
+  return change;
+}
+
+template<ndn::encoding::Tag TAG>
+size_t
+TopologyChange::wireEncode(ndn::EncodingImpl<TAG>& block) const
+{
+  size_t totalLength = 0;
+
+  if (m_kind == Kind::LINK_COST) {
+    totalLength += ndn::encoding::prependDoubleBlock(block, nlsr::tlv::CostDouble, m_cost);
+  }
+  if (m_kind != Kind::ROUTER_DOWN) {
+    totalLength += m_otherRouter.wireEncode(block);
+  }
+  totalLength += m_router.wireEncode(block);
+  totalLength += ndn::encoding::prependNonNegativeIntegerBlock(block, nlsr::tlv::TopologyChangeKind,
+                                                               static_cast<uint64_t>(m_kind));
+
+  totalLength += block.prependVarNumber(totalLength);
+  totalLength += block.prependVarNumber(nlsr::tlv::TopologyChange);
+
+  return totalLength;
+}
+
+NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(TopologyChange);
+
+ndn::Block
+TopologyChange::wireEncode() const
+{
+  ndn::EncodingEstimator estimator;
+  size_t estimatedSize = wireEncode(estimator);
+
+  ndn::EncodingBuffer buffer(estimatedSize, 0);
+  wireEncode(buffer);
+
+  return buffer.block();
+}
+
+void
+TopologyChange::wireDecode(const ndn::Block& wire)
+{
+  if (wire.type() != nlsr::tlv::TopologyChange) {
+    NDN_THROW(Error("TopologyChange", wire.type()));
+  }
+
+  wire.parse();
+  auto val = wire.elements_begin();
+
+  if (val != wire.elements_end() && val->type() == nlsr::tlv::TopologyChangeKind) {
+    auto kind = ndn::encoding::readNonNegativeInteger(*val);
+    if (kind > static_cast<uint64_t>(Kind::ROUTER_DOWN)) {
+      NDN_THROW(Error("Unknown TopologyChangeKind " + std::to_string(kind)));
+    }
+    m_kind = static_cast<Kind>(kind);
+    ++val;
+  }
+  else {
+    NDN_THROW(Error("Missing required TopologyChangeKind field"));
+  }
+
+  if (val != wire.elements_end() && val->type() == ndn::tlv::Name) {
+    m_router.wireDecode(*val);
+    ++val;
+  }
+  else {
+    NDN_THROW(Error("Missing required Name field"));
+  }
+
+  m_otherRouter.clear();
+  if (m_kind != Kind::ROUTER_DOWN) {
+    if (val != wire.elements_end() && val->type() == ndn::tlv::Name) {
+      m_otherRouter.wireDecode(*val);
+      ++val;
+    }
+    else {
+      NDN_THROW(Error("Missing required Name field for the other end of the link"));
+    }
+  }
+
+  m_cost = 0;
+  if (m_kind == Kind::LINK_COST) {
+    if (val != wire.elements_end() && val->type() == nlsr::tlv::CostDouble) {
+      m_cost = ndn::encoding::readDouble(*val);
+      ++val;
+    }
+    else {
+      NDN_THROW(Error("Missing required CostDouble field"));
+    }
+    if (!(m_cost >= 0)) {
+      NDN_THROW(Error("Invalid link cost"));
+    }
+  }
+}
+
+ndn::Block
+TopologyChange::encodeList(const std::vector<TopologyChange>& changes)
+{
+  ndn::Block list(nlsr::tlv::TopologyChangeList);
+  for (const auto& change : changes) {
+    list.push_back(change.wireEncode());
+  }
+  list.encode();
+  return list;
+}
+
+std::vector<TopologyChange>
+TopologyChange::decodeList(const ndn::Block& list)
+{
+  if (list.type() != nlsr::tlv::TopologyChangeList) {
+    NDN_THROW(Error("TopologyChangeList", list.type()));
+  }
+  list.parse();
+
+  std::vector<TopologyChange> changes;
+  changes.reserve(list.elements_size());
+  for (const auto& element : list.elements()) {
+    changes.emplace_back(element);
+  }
+  return changes;
+}
+
+std::ostream&
+operator<<(std::ostream& os, const TopologyChange& change)
+{
+  switch (change.getKind()) {
+    case TopologyChange::Kind::LINK_DOWN:
+      return os << "link-down " << change.getRouter() << " " << change.getOtherRouter();
+    case TopologyChange::Kind::LINK_COST:
+      return os << "link-cost " << change.getRouter() << " " << change.getOtherRouter() << " "
+                << change.getCost();
+    case TopologyChange::Kind::ROUTER_DOWN:
+      return os << "router-down " << change.getRouter();
+  }
+  return os;
+}
+
+} // namespace nlsr
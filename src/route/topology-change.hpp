@@ -0,0 +1,152 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_ROUTE_TOPOLOGY_CHANGE_HPP
+#define NLSR_ROUTE_TOPOLOGY_CHANGE_HPP
+
+#include <ndn-cxx/encoding/block.hpp>
+#include <ndn-cxx/encoding/encoding-buffer.hpp>
+#include <ndn-cxx/name.hpp>
+
+#include <boost/operators.hpp>
+
+#include <ostream>
+#include <vector>
+
+namespace nlsr {
+
+/*! \brief A hypothetical change of the topology, for what-if analysis.
+ *
+ *   TopologyChange := TOPOLOGY-CHANGE-TYPE TLV-LENGTH
+ *                       TopologyChangeKind
+ *                       Name            ; router
+ *                       Name?           ; other end of the link
+ *                       CostDouble?     ; new cost of the link
+ */
+class TopologyChange : private boost::equality_comparable<TopologyChange>
+{
+public:
+  class Error : public ndn::tlv::Error
+  {
+  public:
+    using ndn::tlv::Error::Error;
+  };
+
+  enum class Kind {
+    /// the link between two routers goes down
+    LINK_DOWN = 0,
+    /// the link between two routers gets a new cost
+    LINK_COST = 1,
+    /// a router and all its links go down
+    ROUTER_DOWN = 2,
+  };
+
+  TopologyChange() = default;
+
+  explicit
+  TopologyChange(const ndn::Block& block)
+  {
+    wireDecode(block);
+  }
+
+  static TopologyChange
+  makeLinkDown(const ndn::Name& router, const ndn::Name& otherRouter);
+
+  static TopologyChange
+  makeLinkCost(const ndn::Name& router, const ndn::Name& otherRouter, double cost);
+
+  static TopologyChange
+  makeRouterDown(const ndn::Name& router);
+
+  Kind
+  getKind() const
+  {
+    return m_kind;
+  }
+
+  const ndn::Name&
+  getRouter() const
+  {
+    return m_router;
+  }
+
+  /*! \brief Returns the other end of the link, or an empty name for ROUTER_DOWN.
+   */
+  const ndn::Name&
+  getOtherRouter() const
+  {
+    return m_otherRouter;
+  }
+
+  /*! \brief Returns the new cost of the link, only meaningful for LINK_COST.
+   */
+  double
+  getCost() const
+  {
+    return m_cost;
+  }
+
+  template<ndn::encoding::Tag TAG>
+  size_t
+  wireEncode(ndn::EncodingImpl<TAG>& block) const;
+
+  ndn::Block
+  wireEncode() const;
+
+  void
+  wireDecode(const ndn::Block& wire);
+
+  /*! \brief Encodes \p changes into a TopologyChangeList block.
+   */
+  static ndn::Block
+  encodeList(const std::vector<TopologyChange>& changes);
+
+  /*! \brief Decodes a TopologyChangeList block.
+   *  \throw Error the block is not a valid TopologyChangeList
+   */
+  static std::vector<TopologyChange>
+  decodeList(const ndn::Block& list);
+
+private:
+  friend bool
+  operator==(const TopologyChange& lhs, const TopologyChange& rhs)
+  {
+    return lhs.m_kind == rhs.m_kind && lhs.m_router == rhs.m_router &&
+           lhs.m_otherRouter == rhs.m_otherRouter && lhs.m_cost == rhs.m_cost;
+  }
+
+private:
+  Kind m_kind = Kind::ROUTER_DOWN;
+  ndn::Name m_router;
+  ndn::Name m_otherRouter;
+  double m_cost = 0;
+};
+
+NDN_CXX_DECLARE_WIRE_ENCODE_INSTANTIATIONS(TopologyChange);
+
+/*! \brief Prints \p change in the syntax of `nlsrc whatif`, e.g. "link-down /a /b".
+ */
+std::ostream&
+operator<<(std::ostream& os, const TopologyChange& change);
+
+} // namespace nlsr
+
+#endif // NLSR_ROUTE_TOPOLOGY_CHANGE_HPP
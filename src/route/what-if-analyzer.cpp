@@ -0,0 +1,278 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "what-if-analyzer.hpp"
+#include "routing-calculator.hpp"
+
+#include "area.hpp"
+#include "logger.hpp"
+#include "metrics/metrics-registry.hpp"
+
+#include <algorithm>
+
+namespace nlsr {
+
+INIT_LOGGER(route.WhatIfAnalyzer);
+
+namespace {
+
+auto& whatIfDuration = metrics::Registry::get().addHistogram("nlsr_whatif_duration_seconds",
+  "Duration of what-if analyses");
+
+using RouteMap = std::map<ndn::Name, NexthopList>;
+
+std::optional<double>
+getCost(const NexthopList& nexthops)
+{
+  if (nexthops.empty()) {
+    return std::nullopt;
+  }
+  return nexthops.begin()->getRouteCost();
+}
+
+/**
+ * @brief Count the NFD commands needed to replace the next hops installed for @p before
+ *        by those installed for @p after .
+ *
+ * Like Fib::update, only the @p maxFaces cheapest next hops are installed, or all of them
+ * if @p maxFaces is 0.
+ */
+std::pair<size_t, size_t>
+countFibChurn(const NexthopList& before, const NexthopList& after, size_t maxFaces)
+{
+  auto select = [maxFaces] (const NexthopList& nexthops) {
+    size_t n = maxFaces == 0 ? nexthops.size() : std::min(nexthops.size(), maxFaces);
+    return std::make_pair(nexthops.begin(), nexthops.begin() + n);
+  };
+  auto [beforeFirst, beforeLast] = select(before);
+  auto [afterFirst, afterLast] = select(after);
+
+  size_t nRegistrations = 0;
+  for (auto hop = afterFirst; hop != afterLast; ++hop) {
+    auto old = std::find_if(beforeFirst, beforeLast,
+                            [&] (const NextHop& other) { return other.hasSameFace(*hop); });
+    if (old == beforeLast ||
+        old->getRouteCostAsAdjustedInteger() != hop->getRouteCostAsAdjustedInteger()) {
+      ++nRegistrations;
+    }
+  }
+
+  size_t nUnregistrations = 0;
+  for (auto hop = beforeFirst; hop != beforeLast; ++hop) {
+    if (std::none_of(afterFirst, afterLast,
+                     [&] (const NextHop& other) { return other.hasSameFace(*hop); })) {
+      ++nUnregistrations;
+    }
+  }
+  return {nRegistrations, nUnregistrations};
+}
+
+/**
+ * @brief Record in @p report the destinations whose cost or installed next hops differ.
+ */
+void
+diffRoutes(const RouteMap& before, const RouteMap& after, size_t maxFaces,
+           std::vector<WhatIfReport::RouteChange>& changes, WhatIfReport& report)
+{
+  static const NexthopList NO_ROUTE;
+  auto beforeIt = before.begin();
+  auto afterIt = after.begin();
+  while (beforeIt != before.end() || afterIt != after.end()) {
+    const ndn::Name* name = nullptr;
+    const NexthopList* oldHops = &NO_ROUTE;
+    const NexthopList* newHops = &NO_ROUTE;
+    if (afterIt == after.end() || (beforeIt != before.end() && beforeIt->first < afterIt->first)) {
+      name = &beforeIt->first;
+      oldHops = &(beforeIt++)->second;
+    }
+    else if (beforeIt == before.end() || afterIt->first < beforeIt->first) {
+      name = &afterIt->first;
+      newHops = &(afterIt++)->second;
+    }
+    else {
+      name = &afterIt->first;
+      oldHops = &(beforeIt++)->second;
+      newHops = &(afterIt++)->second;
+    }
+
+    auto [nRegistrations, nUnregistrations] = countFibChurn(*oldHops, *newHops, maxFaces);
+    auto oldCost = getCost(*oldHops);
+    auto newCost = getCost(*newHops);
+    if (oldCost != newCost || nRegistrations > 0 || nUnregistrations > 0) {
+      changes.push_back({*name, oldCost, newCost});
+      report.nFibRegistrations += nRegistrations;
+      report.nFibUnregistrations += nUnregistrations;
+    }
+  }
+}
+
+void
+printRouteChanges(std::ostream& os, const std::string& title,
+                  const std::vector<WhatIfReport::RouteChange>& changes)
+{
+  size_t nUnreachable = 0;
+  size_t nCostlier = 0;
+  size_t nCheaper = 0;
+  size_t nRerouted = 0;
+  for (const auto& change : changes) {
+    if (!change.newCost) {
+      ++nUnreachable;
+    }
+    else if (!change.oldCost || *change.newCost < *change.oldCost) {
+      ++nCheaper;
+    }
+    else if (*change.newCost > *change.oldCost) {
+      ++nCostlier;
+    }
+    else {
+      ++nRerouted;
+    }
+  }
+
+  os << title << ": " << nUnreachable << " unreachable, " << nCostlier << " costlier, "
+     << nCheaper << " cheaper, " << nRerouted << " rerouted\n";
+  auto printCost = [&os] (const std::optional<double>& cost) {
+    if (cost) {
+      os << *cost;
+    }
+    else {
+      os << "unreachable";
+    }
+  };
+  for (const auto& change : changes) {
+    os << "  " << change.name << ": ";
+    printCost(change.oldCost);
+    os << " -> ";
+    printCost(change.newCost);
+    os << (change.oldCost == change.newCost ? " (rerouted)\n" : "\n");
+  }
+}
+
+} // namespace
+
+std::ostream&
+operator<<(std::ostream& os, const WhatIfReport& report)
+{
+  if (!report.ignoredChanges.empty()) {
+    os << "Ignored changes (unknown router or link):\n";
+    for (const auto& change : report.ignoredChanges) {
+      os << "  " << change << "\n";
+    }
+  }
+  printRouteChanges(os, "Routers", report.routers);
+  printRouteChanges(os, "Name prefixes", report.prefixes);
+  os << "FIB: " << report.nFibRegistrations << " registrations, "
+     << report.nFibUnregistrations << " unregistrations\n";
+  return os;
+}
+
+WhatIfAnalyzer::WhatIfAnalyzer(Lsdb& lsdb, const ConfParameter& confParam)
+  : m_lsdb(lsdb)
+  , m_confParam(confParam)
+  , m_afterLsdbModified(lsdb.onLsdbModified.connect([this] (auto&&...) { m_baseline.reset(); }))
+{
+}
+
+WhatIfReport
+WhatIfAnalyzer::analyze(const std::vector<TopologyChange>& changes)
+{
+  metrics::ScopedTimer timer(whatIfDuration);
+  WhatIfReport report;
+
+  std::vector<TopologyChange> applicable;
+  for (const auto& change : changes) {
+    if (isApplicable(change)) {
+      applicable.push_back(change);
+    }
+    else {
+      NLSR_LOG_DEBUG("Ignoring what-if change: " << change);
+      report.ignoredChanges.push_back(change);
+    }
+  }
+
+  if (!m_baseline) {
+    m_baseline = computeRoutes({});
+  }
+  auto routes = computeRoutes(applicable);
+
+  size_t maxFaces = m_confParam.getMaxFacesPerPrefix();
+  diffRoutes(m_baseline->routers, routes.routers, maxFaces, report.routers, report);
+  diffRoutes(m_baseline->prefixes, routes.prefixes, maxFaces, report.prefixes, report);
+  return report;
+}
+
+WhatIfAnalyzer::Routes
+WhatIfAnalyzer::computeRoutes(const std::vector<TopologyChange>& changes) const
+{
+  Routes routes;
+  routes.routers = calculateLinkStatePaths(m_lsdb, m_confParam, changes);
+
+  // Like the Name Prefix Table, merge the routes towards every origin of a name,
+  // with the cost of the name at that origin added
+  const auto& ownRouter = m_confParam.getRouterPrefix();
+  auto lsaRange = m_lsdb.getLsdbIterator<NameLsa>();
+  for (auto lsaIt = lsaRange.first; lsaIt != lsaRange.second; ++lsaIt) {
+    auto router = area::getAdvertisingRouter((*lsaIt)->getOriginRouter());
+    if (router == ownRouter) {
+      continue;
+    }
+    auto routerIt = routes.routers.find(router);
+    const auto& nameLsa = static_cast<const NameLsa&>(**lsaIt);
+    for (const auto& prefix : nameLsa.getNpl().getPrefixInfo()) {
+      if (prefix.getName() == ownRouter) {
+        continue;
+      }
+      // Unreachable names are listed with no next hops
+      auto& nexthops = routes.prefixes[prefix.getName()];
+      if (routerIt == routes.routers.end()) {
+        continue;
+      }
+      for (NextHop nh : routerIt->second) {
+        nh.setRouteCost(nh.getRouteCost() + prefix.getCost());
+        nh.setHyperbolic(false);
+        nexthops.addNextHop(nh);
+      }
+    }
+  }
+  return routes;
+}
+
+bool
+WhatIfAnalyzer::isApplicable(const TopologyChange& change) const
+{
+  auto lsa = m_lsdb.findLsa<AdjLsa>(change.getRouter());
+  if (lsa == nullptr) {
+    return false;
+  }
+
+  if (change.getKind() == TopologyChange::Kind::ROUTER_DOWN) {
+    // Taking down this router leaves nothing to route
+    return change.getRouter() != m_confParam.getRouterPrefix();
+  }
+
+  // Links are only used when both ends announce them
+  auto otherLsa = m_lsdb.findLsa<AdjLsa>(change.getOtherRouter());
+  return otherLsa != nullptr &&
+         lsa->getAdl().isNeighbor(change.getOtherRouter()) &&
+         otherLsa->getAdl().isNeighbor(change.getRouter());
+}
+
+} // namespace nlsr
@@ -0,0 +1,112 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_ROUTE_WHAT_IF_ANALYZER_HPP
+#define NLSR_ROUTE_WHAT_IF_ANALYZER_HPP
+
+#include "lsdb.hpp"
+#include "route/nexthop-list.hpp"
+#include "route/topology-change.hpp"
+#include "test-access-control.hpp"
+
+#include <boost/noncopyable.hpp>
+
+#include <map>
+#include <optional>
+#include <ostream>
+#include <vector>
+
+namespace nlsr {
+
+/*! \brief The effect of hypothetical topology changes on the routes of this router.
+ */
+struct WhatIfReport
+{
+  /*! \brief A destination whose cost or next hops change; no cost means unreachable.
+   */
+  struct RouteChange
+  {
+    ndn::Name name;
+    std::optional<double> oldCost;
+    std::optional<double> newCost;
+  };
+
+  /// changes that were ignored, because they refer to unknown routers or links
+  std::vector<TopologyChange> ignoredChanges;
+  /// routers whose cost or next hops change
+  std::vector<RouteChange> routers;
+  /// name prefixes whose cost or installed next hops change
+  std::vector<RouteChange> prefixes;
+  /// next hops that would be registered with NFD, including those whose cost changes
+  size_t nFibRegistrations = 0;
+  /// next hops that would be unregistered from NFD
+  size_t nFibUnregistrations = 0;
+};
+
+std::ostream&
+operator<<(std::ostream& os, const WhatIfReport& report);
+
+/*! \brief Computes the effect of hypothetical topology changes, e.g. before maintenance.
+ *
+ * Link-state SPF is run over the current Adjacency LSAs with the changes applied to the
+ * adjacency matrix of that calculation only, so the LSDB and the routing table are left
+ * untouched. The routes of the unchanged topology are computed the same way, so that both
+ * sides of the comparison come from the same algorithm; they are cached until the LSDB is
+ * modified, so that analyzing many changes in a row costs one SPF each.
+ *
+ * Only the default topology is analyzed, and the cost of reaching a name prefix combines
+ * the routes towards each of its origins like the Name Prefix Table does.
+ */
+class WhatIfAnalyzer : boost::noncopyable
+{
+public:
+  WhatIfAnalyzer(Lsdb& lsdb, const ConfParameter& confParam);
+
+  WhatIfReport
+  analyze(const std::vector<TopologyChange>& changes);
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /*! \brief Next hops towards each router and each name prefix.
+   */
+  struct Routes
+  {
+    std::map<ndn::Name, NexthopList> routers;
+    std::map<ndn::Name, NexthopList> prefixes;
+  };
+
+  Routes
+  computeRoutes(const std::vector<TopologyChange>& changes) const;
+
+  bool
+  isApplicable(const TopologyChange& change) const;
+
+  /// routes of the current topology, reset when the LSDB is modified
+  std::optional<Routes> m_baseline;
+
+private:
+  Lsdb& m_lsdb;
+  const ConfParameter& m_confParam;
+  ndn::signal::ScopedConnection m_afterLsdbModified;
+};
+
+} // namespace nlsr
+
+#endif // NLSR_ROUTE_WHAT_IF_ANALYZER_HPP
@@ -22,8 +22,12 @@
 #include "sequencing-manager.hpp"
 #include "logger.hpp"
 
-#include <string>
+#include <filesystem>
 #include <fstream>
+#include <sstream>
+#include <string>
+
+#include <fcntl.h>
 #include <pwd.h>
 #include <cstdlib>
 #include <unistd.h>
@@ -32,6 +36,32 @@ namespace nlsr {
 
 INIT_LOGGER(SequencingManager);
 
+/*! \brief Replace \p path with \p content, syncing the file and its directory.
+ */
+static void
+writeFileDurably(const std::string& path, const std::string& content)
+{
+  std::string tempPath = path + ".tmp";
+  int fd = ::open(tempPath.data(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    NDN_THROW_ERRNO(std::runtime_error("Cannot open " + tempPath));
+  }
+  bool isOk = ::write(fd, content.data(), content.size()) == static_cast<ssize_t>(content.size()) &&
+              ::fsync(fd) == 0;
+  ::close(fd);
+  if (!isOk) {
+    NDN_THROW_ERRNO(std::runtime_error("Cannot write " + tempPath));
+  }
+  std::filesystem::rename(tempPath, path);
+
+  auto dirPath = std::filesystem::path(path).parent_path();
+  int dirFd = ::open(dirPath.empty() ? "." : dirPath.c_str(), O_RDONLY | O_DIRECTORY);
+  if (dirFd >= 0) {
+    ::fsync(dirFd);
+    ::close(dirFd);
+  }
+}
+
 SequencingManager::SequencingManager(const std::string& filePath, int hypState)
   : m_hyperbolicState(hypState)
 {
@@ -40,16 +70,54 @@ SequencingManager::SequencingManager(const std::string& filePath, int hypState)
 }
 
 void
-SequencingManager::writeSeqNoToFile() const
+SequencingManager::writeSeqNoToFile()
 {
   writeLog();
-  std::string tempPath = m_seqFileNameWithPath + ".tmp";
-  std::ofstream outputFile(tempPath.c_str());
-  outputFile << "NameLsaSeq " << m_nameLsaSeq << "\n"
-             << "AdjLsaSeq "  << m_adjLsaSeq  << "\n"
-             << "CorLsaSeq "  << m_corLsaSeq;
-  outputFile.close();
-  std::filesystem::rename(tempPath, m_seqFileNameWithPath);
+  // Coordinate LSAs are not originated with link-state routing, nor adjacency LSAs with
+  // hyperbolic routing: their sequence numbers are recorded as they are
+  bool isAdjLsaUsed = m_hyperbolicState != HYPERBOLIC_STATE_ON;
+  bool isCorLsaUsed = m_hyperbolicState != HYPERBOLIC_STATE_OFF;
+  auto needsBlock = [] (uint64_t seqNo, uint64_t reserved) {
+    return seqNo + SEQ_NO_BLOCK_SIZE / 2 > reserved;
+  };
+  if (!needsBlock(m_nameLsaSeq, m_reservedNameLsaSeq) &&
+      !(isAdjLsaUsed && needsBlock(m_adjLsaSeq, m_reservedAdjLsaSeq)) &&
+      !(isCorLsaUsed && needsBlock(m_corLsaSeq, m_reservedCorLsaSeq))) {
+    waitForDurableReservation();
+    return;
+  }
+
+  m_reservedNameLsaSeq = m_nameLsaSeq + SEQ_NO_BLOCK_SIZE;
+  m_reservedAdjLsaSeq = m_adjLsaSeq + (isAdjLsaUsed ? SEQ_NO_BLOCK_SIZE : 0);
+  m_reservedCorLsaSeq = m_corLsaSeq + (isCorLsaUsed ? SEQ_NO_BLOCK_SIZE : 0);
+  NLSR_LOG_DEBUG("Reserving sequence numbers up to name=" << m_reservedNameLsaSeq <<
+                 " adj=" << m_reservedAdjLsaSeq << " cor=" << m_reservedCorLsaSeq);
+
+  std::ostringstream os;
+  os << "NameLsaSeq " << m_reservedNameLsaSeq << "\n"
+     << "AdjLsaSeq "  << m_reservedAdjLsaSeq  << "\n"
+     << "CorLsaSeq "  << m_reservedCorLsaSeq;
+  m_ioWorker.post([path = m_seqFileNameWithPath, content = os.str()] {
+    writeFileDurably(path, content);
+  });
+
+  waitForDurableReservation();
+}
+
+void
+SequencingManager::waitForDurableReservation()
+{
+  if (m_nameLsaSeq <= m_durableNameLsaSeq &&
+      m_adjLsaSeq <= m_durableAdjLsaSeq &&
+      m_corLsaSeq <= m_durableCorLsaSeq) {
+    return;
+  }
+
+  // Normally a no-op: the reservation covering these numbers was posted half a block ago
+  m_ioWorker.flush();
+  m_durableNameLsaSeq = m_reservedNameLsaSeq;
+  m_durableAdjLsaSeq = m_reservedAdjLsaSeq;
+  m_durableCorLsaSeq = m_reservedCorLsaSeq;
 }
 
 void
@@ -67,8 +135,16 @@ SequencingManager::initiateSeqNoFromFile()
 
     inputFile.close();
 
-    // Increment by 10 in case last run of NLSR was not able to write to file
-    // before crashing
+    // The file holds reserved upper bounds, already on disk
+    m_reservedNameLsaSeq = m_nameLsaSeq;
+    m_reservedAdjLsaSeq = m_adjLsaSeq;
+    m_reservedCorLsaSeq = m_corLsaSeq;
+    m_durableNameLsaSeq = m_nameLsaSeq;
+    m_durableAdjLsaSeq = m_adjLsaSeq;
+    m_durableCorLsaSeq = m_corLsaSeq;
+
+    // Increment by 10 in case the file was written by a version of NLSR that did
+    // not reserve sequence numbers, and was not able to write it before crashing
     m_nameLsaSeq += 10;
 
     // Increment the adjacency LSA seq. no. if link-state or dry HR is enabled
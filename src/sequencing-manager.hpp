@@ -25,6 +25,7 @@
 #include "conf-parameter.hpp"
 #include "lsa/lsa.hpp"
 #include "test-access-control.hpp"
+#include "utility/io-worker.hpp"
 
 #include <ndn-cxx/face.hpp>
 
@@ -33,9 +34,19 @@
 
 namespace nlsr {
 
+/*! \brief Hands out the sequence numbers of the LSAs originated by this router.
+ *
+ * Sequence numbers are reserved by blocks: the file records an upper bound for
+ * each LSA type, which is only rewritten when the numbers handed out get close to
+ * it. After a restart, numbering resumes from the recorded bounds, which are
+ * never lower than any number used before.
+ */
 class SequencingManager
 {
 public:
+  /// Sequence numbers reserved by each write of the file
+  static constexpr uint64_t SEQ_NO_BLOCK_SIZE = 1000;
+
   SequencingManager(const std::string& filePath, int hypState);
 
   void
@@ -125,13 +136,29 @@ public:
     m_corLsaSeq++;
   }
 
+  /*! \brief Make sure the current sequence numbers are covered by a durable reservation.
+   *
+   * Must be called after the sequence numbers change and before they are published.
+   * A new block is reserved once half of the current one is used; the file is then
+   * written and synced in the background. This only blocks if the sequence numbers
+   * went past the bounds known to be on disk while that write is still pending,
+   * e.g. right after a restart or when the disk is slower than half a block.
+   */
   void
-  writeSeqNoToFile() const;
+  writeSeqNoToFile();
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   void
   initiateSeqNoFromFile();
 
+  /*! \brief Blocks until the last reservation is on disk.
+   */
+  void
+  flush()
+  {
+    m_ioWorker.flush();
+  }
+
 private:
   /*! \brief Set the sequence file directory
 
@@ -142,6 +169,11 @@ private:
   void
   setSeqFileDirectory(const std::string& filePath);
 
+  /*! \brief Blocks until the current sequence numbers are within bounds on disk.
+   */
+  void
+  waitForDurableReservation();
+
   void
   writeLog() const;
 
@@ -152,7 +184,19 @@ private:
   std::string m_seqFileNameWithPath;
 
 PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  // Upper bounds recorded by the last write of the file
+  uint64_t m_reservedNameLsaSeq = 0;
+  uint64_t m_reservedAdjLsaSeq = 0;
+  uint64_t m_reservedCorLsaSeq = 0;
+
+  // Upper bounds of the last write known to have completed
+  uint64_t m_durableNameLsaSeq = 0;
+  uint64_t m_durableAdjLsaSeq = 0;
+  uint64_t m_durableCorLsaSeq = 0;
+
   int m_hyperbolicState;
+
+  util::IoWorker m_ioWorker;
 };
 
 } // namespace nlsr
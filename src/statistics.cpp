@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2020,  The University of Memphis,
+ * Copyright (c) 2014-2025,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -25,34 +25,68 @@
 
 namespace nlsr {
 
-size_t
-Statistics::get(PacketType type) const
+void
+SlidingWindowRate::record(size_t nBytes, ndn::time::steady_clock::time_point now)
 {
-  auto it = m_packetCounter.find(type);
-  if (it != m_packetCounter.end()) {
-    return it->second;
+  int64_t epoch = getEpoch(now);
+  auto& slot = m_slots[static_cast<size_t>(epoch) % SLOT_COUNT];
+  if (slot.epoch != epoch) {
+    slot = Slot{epoch, 0, 0};
   }
-  else {
-    return 0;
+  ++slot.nPackets;
+  slot.nBytes += nBytes;
+}
+
+SlidingWindowRate::Slot
+SlidingWindowRate::getTotal(ndn::time::steady_clock::time_point now) const
+{
+  int64_t oldest = getEpoch(now) - static_cast<int64_t>(SLOT_COUNT) + 1;
+  Slot total;
+  for (const auto& slot : m_slots) {
+    if (slot.epoch >= oldest) {
+      total.nPackets += slot.nPackets;
+      total.nBytes += slot.nBytes;
+    }
   }
+  return total;
+}
+
+double
+SlidingWindowRate::getPacketRate(ndn::time::steady_clock::time_point now) const
+{
+  return static_cast<double>(getTotal(now).nPackets) / WINDOW.count();
+}
+
+double
+SlidingWindowRate::getByteRate(ndn::time::steady_clock::time_point now) const
+{
+  return static_cast<double>(getTotal(now).nBytes) / WINDOW.count();
+}
+
+void
+NeighborTraffic::recordSent(size_t nBytes)
+{
+  ++nSentPackets;
+  nSentBytes += nBytes;
+  sentRate.record(nBytes, ndn::time::steady_clock::now());
 }
 
 void
-Statistics::increment(PacketType type)
+NeighborTraffic::recordReceived(size_t nBytes)
 {
-  m_packetCounter[type]++;
+  ++nReceivedPackets;
+  nReceivedBytes += nBytes;
+  receivedRate.record(nBytes, ndn::time::steady_clock::now());
 }
 
 void
 Statistics::resetAll()
 {
-  for (auto& it : m_packetCounter) {
-    it.second = 0;
-  }
+  m_packetCounter.fill(0);
 }
 
-std::ostream&
-operator<<(std::ostream& os, const Statistics& stats)
+static void
+printCounters(std::ostream& os, const Statistics& stats)
 {
   using PacketType = Statistics::PacketType;
 
@@ -89,10 +123,50 @@ operator<<(std::ostream& os, const Statistics& stats)
      << "\n"
      << "    Received Adjacency LSA Data: "       << stats.get(PacketType::RCV_ADJ_LSA_DATA) << "\n"
      << "    Received Coordinate LSA Data: "      << stats.get(PacketType::RCV_COORD_LSA_DATA) << "\n"
-     << "    Received Name LSA Data: "            << stats.get(PacketType::RCV_NAME_LSA_DATA) << "\n"
-     << "++++++++++++++++++++++++++++++++++++++++\n";
+     << "    Received Name LSA Data: "            << stats.get(PacketType::RCV_NAME_LSA_DATA) << "\n";
+}
+
+std::ostream&
+operator<<(std::ostream& os, const Statistics& stats)
+{
+  printCounters(os, stats);
+  return os << "++++++++++++++++++++++++++++++++++++++++\n";
+}
+
+void
+printStatistics(std::ostream& os, const Statistics& stats, const AdjacencyList& adjacencies)
+{
+  printCounters(os, stats);
+
+  bool hasTraffic = std::any_of(adjacencies.begin(), adjacencies.end(),
+                                [] (const Adjacent& adj) { return !adj.getTraffic().isEmpty(); });
+  if (hasTraffic) {
+    auto now = ndn::time::steady_clock::now();
+    auto flags = os.flags();
+    auto precision = os.precision(2);
+    os << std::fixed
+       << "\n"
+       << "NEIGHBORS (rates averaged over the last "
+       << SlidingWindowRate::WINDOW.count() << " seconds)\n";
+    for (const auto& adj : adjacencies) {
+      const auto& traffic = adj.getTraffic();
+      if (traffic.isEmpty()) {
+        continue;
+      }
+      os << "  " << adj.getName() << "\n"
+         << "    Sent: " << traffic.nSentPackets << " packets, " << traffic.nSentBytes << " bytes"
+         << " (" << traffic.sentRate.getPacketRate(now) << " pkt/s, "
+         << traffic.sentRate.getByteRate(now) << " B/s)\n"
+         << "    Received: " << traffic.nReceivedPackets << " packets, "
+         << traffic.nReceivedBytes << " bytes"
+         << " (" << traffic.receivedRate.getPacketRate(now) << " pkt/s, "
+         << traffic.receivedRate.getByteRate(now) << " B/s)\n";
+    }
+    os.flags(flags);
+    os.precision(precision);
+  }
 
-  return os;
+  os << "++++++++++++++++++++++++++++++++++++++++\n";
 }
 
 } // namespace nlsr
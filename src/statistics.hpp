@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2020,  The University of Memphis,
+ * Copyright (c) 2014-2025,  The University of Memphis,
  *                           Regents of the University of California,
  *                           Arizona Board of Regents.
  *
@@ -22,11 +22,95 @@
 #ifndef NLSR_STATISTICS_HPP
 #define NLSR_STATISTICS_HPP
 
-#include <map>
+#include <ndn-cxx/name.hpp>
+#include <ndn-cxx/util/time.hpp>
+
+#include <array>
 #include <ostream>
 
 namespace nlsr {
 
+/*! \brief Packet and byte rates of a traffic stream over a sliding window.
+ *
+ * The window is split into SLOT_COUNT slots of SLOT_DURATION each. A slot is
+ * reused once its period has fallen out of the window, so recording is O(1) and
+ * the memory footprint is fixed.
+ */
+class SlidingWindowRate
+{
+public:
+  static constexpr size_t SLOT_COUNT = 6;
+  static constexpr ndn::time::seconds SLOT_DURATION{10};
+  static constexpr ndn::time::seconds WINDOW{SLOT_DURATION.count() * SLOT_COUNT};
+
+  void
+  record(size_t nBytes, ndn::time::steady_clock::time_point now);
+
+  /*! \brief Returns the average number of packets per second over the window ending at \p now.
+   */
+  double
+  getPacketRate(ndn::time::steady_clock::time_point now) const;
+
+  /*! \brief Returns the average number of bytes per second over the window ending at \p now.
+   */
+  double
+  getByteRate(ndn::time::steady_clock::time_point now) const;
+
+private:
+  struct Slot
+  {
+    int64_t epoch = -1;
+    uint64_t nPackets = 0;
+    uint64_t nBytes = 0;
+  };
+
+  static int64_t
+  getEpoch(ndn::time::steady_clock::time_point now)
+  {
+    return now.time_since_epoch() / SLOT_DURATION;
+  }
+
+  /*! \brief Sums the slots that are still inside the window ending at \p now.
+   */
+  Slot
+  getTotal(ndn::time::steady_clock::time_point now) const;
+
+private:
+  std::array<Slot, SLOT_COUNT> m_slots;
+};
+
+/*! \brief Packets and bytes exchanged with one neighbor, in each direction.
+ *
+ * Each Adjacent owns its traffic, so accounting a packet does not look the neighbor up again.
+ */
+struct NeighborTraffic
+{
+  /*! \brief Accounts a packet of \p nBytes sent to the neighbor.
+   */
+  void
+  recordSent(size_t nBytes);
+
+  /*! \brief Accounts a packet of \p nBytes received from the neighbor.
+   */
+  void
+  recordReceived(size_t nBytes);
+
+  bool
+  isEmpty() const
+  {
+    return nSentPackets == 0 && nReceivedPackets == 0;
+  }
+
+  uint64_t nSentPackets = 0;
+  uint64_t nSentBytes = 0;
+  uint64_t nReceivedPackets = 0;
+  uint64_t nReceivedBytes = 0;
+  SlidingWindowRate sentRate;
+  SlidingWindowRate receivedRate;
+};
+
+class AdjacencyList;
+
 class Statistics
 {
 public:
@@ -53,28 +137,41 @@ public:
     RCV_NAME_LSA_DATA
   };
 
+  static constexpr size_t PACKET_TYPE_COUNT = static_cast<size_t>(PacketType::RCV_NAME_LSA_DATA) + 1;
+
   size_t
-  get(PacketType) const;
+  get(PacketType type) const
+  {
+    return m_packetCounter[static_cast<size_t>(type)];
+  }
 
   void
-  increment(PacketType);
+  increment(PacketType type)
+  {
+    ++m_packetCounter[static_cast<size_t>(type)];
+  }
 
   void
   resetAll();
 
-  const std::map<PacketType,int>&
+  const std::array<uint64_t, PACKET_TYPE_COUNT>&
   getCounter() const
   {
     return m_packetCounter;
   }
 
 private:
-  std::map<PacketType, int> m_packetCounter;
+  std::array<uint64_t, PACKET_TYPE_COUNT> m_packetCounter{};
 };
 
 std::ostream&
 operator<<(std::ostream&, const Statistics& stats);
 
+/*! \brief Prints \p stats followed by the traffic exchanged with each of \p adjacencies.
+ */
+void
+printStatistics(std::ostream& os, const Statistics& stats, const AdjacencyList& adjacencies);
+
 } // namespace nlsr
 
 #endif // NLSR_STATISTICS_HPP
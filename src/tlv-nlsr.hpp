@@ -46,7 +46,22 @@ enum {
   NextHop                     = 143,
   RoutingTable                = 144,
   RoutingTableEntry           = 145,
-  PrefixInfo                  = 146
+  PrefixInfo                  = 146,
+  Metrics                     = 147,
+  Statistics                  = 148,
+  Memory                      = 149,
+  PrefixList                  = 150,
+  TopologyCost                = 151,
+  TopologyName                = 152,
+  LsaEncoding                 = 153,
+  CompactPrefixInfo           = 154,
+  CompactAdjacency            = 155,
+  SharedComponents            = 156,
+  NoTransit                   = 157,
+  TopologyChange              = 158,
+  TopologyChangeKind          = 159,
+  TopologyChangeList          = 160,
+  WhatIf                      = 161
 };
 
 } // namespace nlsr::tlv
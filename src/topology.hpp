@@ -0,0 +1,101 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_TOPOLOGY_HPP
+#define NLSR_TOPOLOGY_HPP
+
+#include "adjacent.hpp"
+
+#include <vector>
+
+namespace nlsr {
+
+/*! \brief How the links of a routing topology are weighted.
+ */
+enum class TopologyMetric {
+  /// the topology-cost of each neighbor, or its link-cost if it has none
+  LINK_COST,
+  /// every link costs 1
+  HOP_COUNT,
+};
+
+/*! \brief A routing topology, i.e., an alternative set of link costs with its own routing table.
+ *
+ * Every topology is computed over the links of the default topology, which uses the
+ * link-cost of each neighbor, and only differs in their costs. Names are routed in the
+ * topology of their longest matching prefix, or in the default topology.
+ */
+struct Topology
+{
+  std::string name;
+  TopologyMetric metric = TopologyMetric::LINK_COST;
+  std::vector<ndn::Name> prefixes;
+};
+
+inline bool
+operator==(const Topology& lhs, const Topology& rhs)
+{
+  return lhs.name == rhs.name && lhs.metric == rhs.metric && lhs.prefixes == rhs.prefixes;
+}
+
+inline bool
+operator!=(const Topology& lhs, const Topology& rhs)
+{
+  return !(lhs == rhs);
+}
+
+/*! \brief Returns the cost of the link to \p adjacent in \p topology.
+ *
+ * A link that is down in the default topology stays down.
+ */
+inline double
+getTopologyLinkCost(const Adjacent& adjacent, const Topology& topology)
+{
+  if (adjacent.getLinkCost() < 0) {
+    return adjacent.getLinkCost();
+  }
+  if (topology.metric == TopologyMetric::HOP_COUNT) {
+    return 1;
+  }
+  return adjacent.getTopologyCost(topology.name);
+}
+
+/*! \brief Returns the topology that \p name is routed in, or nullptr for the default topology.
+ */
+inline const Topology*
+findTopology(const std::vector<Topology>& topologies, const ndn::Name& name)
+{
+  const Topology* found = nullptr;
+  size_t longestMatch = 0;
+  for (const auto& topology : topologies) {
+    for (const auto& prefix : topology.prefixes) {
+      if (prefix.isPrefixOf(name) && (found == nullptr || prefix.size() > longestMatch)) {
+        found = &topology;
+        longestMatch = prefix.size();
+      }
+    }
+  }
+  return found;
+}
+
+} // namespace nlsr
+
+#endif // NLSR_TOPOLOGY_HPP
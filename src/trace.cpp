@@ -1,7 +1,8 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2014-2021,  The University of Memphis,
- *                           Regents of the University of California
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
  *
  * This file is part of NLSR (Named-data Link State Routing).
  * See AUTHORS.md for complete list of NLSR authors and contributors.
@@ -18,31 +19,17 @@
  * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include "stats-collector.hpp"
-#include "logger.hpp"
+#include "trace.hpp"
 
-namespace nlsr {
+#ifdef WITH_TRACEPOINTS
 
-StatsCollector::StatsCollector(Lsdb& lsdb, HelloProtocol& hp)
-  : m_lsdb(lsdb)
-  , m_hp(hp)
-{
-  m_lsaIncrementConn = m_lsdb.lsaIncrementSignal.connect(std::bind(&StatsCollector::statsIncrement,
-                                                                   this, _1));
-  m_helloIncrementConn = m_hp.hpIncrementSignal.connect(std::bind(&StatsCollector::statsIncrement,
-                                                                  this, _1));
-}
+// Tracers locate the semaphores through the .probes section and increment them
+// while attached; see the SystemTap SDT documentation.
+#define NLSR_DEFINE_PROBE(probe) \
+  extern "C" { \
+    unsigned short NLSR_PROBE_SEMAPHORE(probe) __attribute__((section(".probes"))) = 0; \
+  }
 
-StatsCollector::~StatsCollector()
-{
-  m_lsaIncrementConn.disconnect();
-  m_helloIncrementConn.disconnect();
-}
+NLSR_FOR_EACH_PROBE(NLSR_DEFINE_PROBE)
 
-void
-StatsCollector::statsIncrement(Statistics::PacketType pType)
-{
-  m_stats.increment(pType);
-}
-
-} // namespace nlsr
+#endif // WITH_TRACEPOINTS
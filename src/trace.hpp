@@ -0,0 +1,121 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_TRACE_HPP
+#define NLSR_TRACE_HPP
+
+#include "config.hpp"
+
+/*! \file trace.hpp
+ *
+ * Static tracepoints (USDT probes, SystemTap SDT compatible) placed on hot paths.
+ *
+ * When NLSR is configured with `--with-tracepoints`, every NLSR_TRACE() site becomes a
+ * single nop plus a test of the probe's semaphore; the arguments are evaluated only while
+ * a tracer (bpftrace, perf, SystemTap) is attached to that probe. Without the option the
+ * macros expand to nothing.
+ *
+ * Probes belong to the provider "nlsr". Name arguments are passed as NUL-terminated URIs,
+ * link costs as integers in thousandths, durations in microseconds.
+ *
+ * | Probe                | Arguments                                          |
+ * |----------------------|----------------------------------------------------|
+ * | spf__begin           | router count                                       |
+ * | spf__end             | router count, routing table entries                |
+ * | lsa__install         | origin router, LSA type, sequence number, is new   |
+ * | fetch__start         | LSA interest name, sequence number                 |
+ * | fetch__end           | LSA interest name, error code (0 = ok), duration   |
+ * | segment__served      | Data name, size in bytes                           |
+ * | fib__register__sent  | prefix, face URI, NFD route cost                   |
+ * | fib__register__ack   | prefix, face ID, status code (200 = ok)            |
+ * | hello__sent          | neighbor                                           |
+ * | hello__received      | neighbor, round-trip time                          |
+ * | hello__timeout       | neighbor, consecutive timeouts                     |
+ * | cost__update         | neighbor, old cost, new cost                       |
+ */
+
+#define NLSR_FOR_EACH_PROBE(X) \
+  X(spf__begin)                \
+  X(spf__end)                  \
+  X(lsa__install)              \
+  X(fetch__start)              \
+  X(fetch__end)                \
+  X(segment__served)           \
+  X(fib__register__sent)       \
+  X(fib__register__ack)        \
+  X(hello__sent)               \
+  X(hello__received)           \
+  X(hello__timeout)            \
+  X(cost__update)
+
+#ifdef WITH_TRACEPOINTS
+
+#define _SDT_HAS_SEMAPHORES 1
+#include <sys/sdt.h>
+
+#define NLSR_PROBE_SEMAPHORE(probe) nlsr_##probe##_semaphore
+
+#define NLSR_DECLARE_PROBE(probe) \
+  extern "C" unsigned short NLSR_PROBE_SEMAPHORE(probe);
+
+NLSR_FOR_EACH_PROBE(NLSR_DECLARE_PROBE)
+
+/*! \brief Evaluates to true while a tracer is attached to \p probe.
+ */
+#define NLSR_TRACE_ENABLED(probe) __builtin_expect(NLSR_PROBE_SEMAPHORE(probe) != 0, 0)
+
+/*! \brief Fires \p probe with the given arguments (at most 12 integers or pointers).
+ *
+ * Temporaries created by the arguments live until the probe has fired, so
+ * `name.toUri().c_str()` is a valid argument.
+ */
+#define NLSR_TRACE(probe, ...)                  \
+  do {                                          \
+    if (NLSR_TRACE_ENABLED(probe)) {            \
+      STAP_PROBEV(nlsr, probe, __VA_ARGS__);    \
+    }                                           \
+  } while (false)
+
+#else // WITH_TRACEPOINTS
+
+namespace nlsr::trace {
+
+template<typename... Args>
+inline void
+discard(const Args&...)
+{
+}
+
+} // namespace nlsr::trace
+
+// The arguments are still compiled (in dead code) so that variables used only by
+// tracepoints do not trigger unused warnings
+#define NLSR_TRACE_ENABLED(probe) false
+#define NLSR_TRACE(probe, ...)                  \
+  do {                                          \
+    if (false) {                                \
+      ::nlsr::trace::discard(__VA_ARGS__);      \
+    }                                           \
+  } while (false)
+
+#endif // WITH_TRACEPOINTS
+
+#endif // NLSR_TRACE_HPP
@@ -21,6 +21,8 @@
 
 #include "command-processor.hpp"
 #include "logger.hpp"
+#include "metrics/event-loop-monitor.hpp"
+#include "tlv-nlsr.hpp"
 
 #include <ndn-cxx/mgmt/nfd/control-response.hpp>
 
@@ -39,10 +41,29 @@ CommandProcessor::CommandProcessor(ndn::mgmt::Dispatcher& dispatcher,
 
 CommandProcessor::~CommandProcessor() = default;
 
+static bool
+hasFlag(const ndn::nfd::ControlParameters& parameters, uint64_t flag)
+{
+  return parameters.hasFlags() && (parameters.getFlags() & flag) != 0;
+}
+
+void
+CommandProcessor::scheduleNameLsaBuild(const ndn::nfd::ControlParameters& parameters,
+                                       ndn::nfd::ControlResponse response,
+                                       const ndn::mgmt::CommandContinuation& done)
+{
+  if (!hasFlag(parameters, WAIT_FOR_PUBLICATION_FLAG)) {
+    m_lsdb.scheduleNameLsaBuild();
+    return done(response);
+  }
+  m_lsdb.scheduleNameLsaBuild([done, response = std::move(response)] { done(response); });
+}
+
 void
 CommandProcessor::advertiseAndInsertPrefix(const ndn::mgmt::ControlParametersBase& parameters,
                                            const ndn::mgmt::CommandContinuation& done)
 {
+  metrics::HandlerScope scope(metrics::HandlerTag::DISPATCHER, "advertiseAndInsertPrefix");
   const auto& castParams = static_cast<const ndn::nfd::ControlParameters&>(parameters);
   // This is a bit of a hack, waiting on the work in #5348 to complete for full refactoring
   ndn::nfd::ControlParameters responseParams(castParams.wireEncode());
@@ -53,22 +74,23 @@ CommandProcessor::advertiseAndInsertPrefix(const ndn::mgmt::ControlParametersBas
   double castParamCost = (castParams.hasCost() ? castParams.getCost() : 0);
   if (m_namePrefixList.insert(castParams.getName(), "", castParamCost)) {
     NLSR_LOG_INFO("Advertising name: " << castParams.getName());
-    m_lsdb.buildAndInstallOwnNameLsa();
-    if (castParams.hasFlags() && castParams.getFlags() == PREFIX_FLAG) {
+    if (hasFlag(castParams, PREFIX_FLAG)) {
       NLSR_LOG_INFO("Saving name to the configuration file ");
       auto [afterAdvertiseReturn, afterAdvertiseMessage] = afterAdvertise(castParams.getName());
       if (afterAdvertiseReturn) {
-        return done(ndn::nfd::ControlResponse(205, afterAdvertiseMessage).setBody(responseParams.wireEncode()));
+        return scheduleNameLsaBuild(castParams, ndn::nfd::ControlResponse(205, afterAdvertiseMessage)
+                                                .setBody(responseParams.wireEncode()), done);
       }
       else {
-        return done(ndn::nfd::ControlResponse(500, afterAdvertiseMessage)
-                    .setBody(responseParams.wireEncode()));
+        return scheduleNameLsaBuild(castParams, ndn::nfd::ControlResponse(500, afterAdvertiseMessage)
+                                                .setBody(responseParams.wireEncode()), done);
       }
     }
-    return done(ndn::nfd::ControlResponse(200, "OK").setBody(responseParams.wireEncode()));
+    return scheduleNameLsaBuild(castParams, ndn::nfd::ControlResponse(200, "OK")
+                                            .setBody(responseParams.wireEncode()), done);
   }
   else {
-    if (castParams.hasFlags() && castParams.getFlags() == PREFIX_FLAG) {
+    if (hasFlag(castParams, PREFIX_FLAG)) {
       // Save an already advertised prefix
       NLSR_LOG_INFO("Saving an already advertised name: " << castParams.getName());
       auto [afterAdvertiseReturn, afterAdvertiseMessage] = afterAdvertise(castParams.getName());
@@ -89,6 +111,7 @@ void
 CommandProcessor::withdrawAndRemovePrefix(const ndn::mgmt::ControlParametersBase& parameters,
                                           const ndn::mgmt::CommandContinuation& done)
 {
+  metrics::HandlerScope scope(metrics::HandlerTag::DISPATCHER, "withdrawAndRemovePrefix");
   const auto& castParams = static_cast<const ndn::nfd::ControlParameters&>(parameters);
   // This is a bit of a hack, waiting on the work in #5348 to complete for full refactoring
   ndn::nfd::ControlParameters responseParams(castParams.wireEncode());
@@ -98,21 +121,22 @@ CommandProcessor::withdrawAndRemovePrefix(const ndn::mgmt::ControlParametersBase
   // Only build a Name LSA if the added name is new
   if (m_namePrefixList.erase(castParams.getName())) {
     NLSR_LOG_INFO("Withdrawing/Removing name: " << castParams.getName());
-    m_lsdb.buildAndInstallOwnNameLsa();
-    if (castParams.hasFlags() && castParams.getFlags() == PREFIX_FLAG) {
+    if (hasFlag(castParams, PREFIX_FLAG)) {
       auto [afterWithdrawReturn, afterWithdrawMessage] = afterWithdraw(castParams.getName());
       if (afterWithdrawReturn) {
-        return done(ndn::nfd::ControlResponse(205, afterWithdrawMessage).setBody(responseParams.wireEncode()));
+        return scheduleNameLsaBuild(castParams, ndn::nfd::ControlResponse(205, afterWithdrawMessage)
+                                                .setBody(responseParams.wireEncode()), done);
       }
       else {
-        return done(ndn::nfd::ControlResponse(500, afterWithdrawMessage)
-                    .setBody(responseParams.wireEncode()));
+        return scheduleNameLsaBuild(castParams, ndn::nfd::ControlResponse(500, afterWithdrawMessage)
+                                                .setBody(responseParams.wireEncode()), done);
       }
     }
-    return done(ndn::nfd::ControlResponse(200, "OK").setBody(responseParams.wireEncode()));
+    return scheduleNameLsaBuild(castParams, ndn::nfd::ControlResponse(200, "OK")
+                                            .setBody(responseParams.wireEncode()), done);
   }
   else {
-    if (castParams.hasFlags() && castParams.getFlags() == PREFIX_FLAG) {
+    if (hasFlag(castParams, PREFIX_FLAG)) {
       // Delete an already withdrawn prefix
       NLSR_LOG_INFO("Deleting an already withdrawn name: " << castParams.getName());
       auto [afterWithdrawReturn, afterWithdrawMessage] = afterWithdraw(castParams.getName());
@@ -129,4 +153,138 @@ CommandProcessor::withdrawAndRemovePrefix(const ndn::mgmt::ControlParametersBase
   }
 }
 
+// Offset of the PrefixList component from the top prefix: module, verb, ControlParameters
+constexpr size_t PREFIX_LIST_OFFSET = 3;
+
+std::vector<PrefixInfo>
+CommandProcessor::decodePrefixList(const ndn::Name& topPrefix, const ndn::Interest& interest)
+{
+  const auto& name = interest.getName();
+  if (name.size() <= topPrefix.size() + PREFIX_LIST_OFFSET) {
+    NDN_THROW(ndn::tlv::Error("Missing prefix list"));
+  }
+
+  ndn::Block list = name[topPrefix.size() + PREFIX_LIST_OFFSET].blockFromValue();
+  if (list.type() != tlv::PrefixList) {
+    NDN_THROW(ndn::tlv::Error("PrefixList", list.type()));
+  }
+  list.parse();
+
+  std::vector<PrefixInfo> prefixes;
+  prefixes.reserve(list.elements_size());
+  for (const auto& element : list.elements()) {
+    prefixes.emplace_back(element);
+  }
+  if (prefixes.empty()) {
+    NDN_THROW(ndn::tlv::Error("Empty prefix list"));
+  }
+  return prefixes;
+}
+
+ndn::Block
+CommandProcessor::encodePrefixList(const std::vector<PrefixInfo>& prefixes)
+{
+  ndn::Block list(tlv::PrefixList);
+  for (const auto& prefix : prefixes) {
+    list.push_back(prefix.wireEncode());
+  }
+  list.encode();
+  return list;
+}
+
+void
+CommandProcessor::advertiseAndInsertPrefixes(const ndn::Name& topPrefix,
+                                             const ndn::Interest& interest,
+                                             const ndn::mgmt::ControlParametersBase& parameters,
+                                             const ndn::mgmt::CommandContinuation& done)
+{
+  metrics::HandlerScope scope(metrics::HandlerTag::DISPATCHER, "advertiseAndInsertPrefixes");
+  const auto& castParams = static_cast<const ndn::nfd::ControlParameters&>(parameters);
+
+  std::vector<PrefixInfo> prefixes;
+  try {
+    prefixes = decodePrefixList(topPrefix, interest);
+  }
+  catch (const ndn::tlv::Error& e) {
+    NLSR_LOG_DEBUG("Rejecting bulk advertise: " << e.what());
+    return done(ndn::nfd::ControlResponse(400, e.what()));
+  }
+
+  size_t nChanged = 0;
+  for (const auto& prefix : prefixes) {
+    if (m_namePrefixList.insert(prefix.getName(), "", prefix.getCost())) {
+      NLSR_LOG_INFO("Advertising name: " << prefix.getName());
+      ++nChanged;
+    }
+  }
+  auto response = finishBulkCommand(prefixes, nChanged, true, castParams);
+  if (nChanged == 0) {
+    return done(response);
+  }
+  scheduleNameLsaBuild(castParams, std::move(response), done);
+}
+
+void
+CommandProcessor::withdrawAndRemovePrefixes(const ndn::Name& topPrefix,
+                                            const ndn::Interest& interest,
+                                            const ndn::mgmt::ControlParametersBase& parameters,
+                                            const ndn::mgmt::CommandContinuation& done)
+{
+  metrics::HandlerScope scope(metrics::HandlerTag::DISPATCHER, "withdrawAndRemovePrefixes");
+  const auto& castParams = static_cast<const ndn::nfd::ControlParameters&>(parameters);
+
+  std::vector<PrefixInfo> prefixes;
+  try {
+    prefixes = decodePrefixList(topPrefix, interest);
+  }
+  catch (const ndn::tlv::Error& e) {
+    NLSR_LOG_DEBUG("Rejecting bulk withdraw: " << e.what());
+    return done(ndn::nfd::ControlResponse(400, e.what()));
+  }
+
+  size_t nChanged = 0;
+  for (const auto& prefix : prefixes) {
+    if (m_namePrefixList.erase(prefix.getName())) {
+      NLSR_LOG_INFO("Withdrawing/Removing name: " << prefix.getName());
+      ++nChanged;
+    }
+  }
+  auto response = finishBulkCommand(prefixes, nChanged, false, castParams);
+  if (nChanged == 0) {
+    return done(response);
+  }
+  scheduleNameLsaBuild(castParams, std::move(response), done);
+}
+
+ndn::nfd::ControlResponse
+CommandProcessor::finishBulkCommand(const std::vector<PrefixInfo>& prefixes, size_t nChanged,
+                                    bool isAdvertise, const ndn::nfd::ControlParameters& parameters)
+{
+  std::string summary = std::to_string(nChanged) + " of " + std::to_string(prefixes.size()) +
+                        (isAdvertise ? " prefixes advertised" : " prefixes withdrawn");
+
+  if (!hasFlag(parameters, PREFIX_FLAG)) {
+    return ndn::nfd::ControlResponse(nChanged > 0 ? 200 : 204, summary)
+           .setBody(parameters.wireEncode());
+  }
+
+  size_t nFailed = 0;
+  std::string lastError;
+  for (const auto& prefix : prefixes) {
+    auto [isOk, message] = isAdvertise ? afterAdvertise(prefix.getName())
+                                       : afterWithdraw(prefix.getName());
+    if (!isOk) {
+      ++nFailed;
+      lastError = message;
+    }
+  }
+  if (nFailed > 0) {
+    return ndn::nfd::ControlResponse(500, summary + ", " + std::to_string(nFailed) +
+                                     " not updated in the configuration file: " + lastError)
+           .setBody(parameters.wireEncode());
+  }
+  return ndn::nfd::ControlResponse(205, summary + " and updated in the configuration file")
+         .setBody(parameters.wireEncode());
+}
+
 } // namespace nlsr::update
@@ -30,10 +30,15 @@
 
 #include <boost/noncopyable.hpp>
 #include <optional>
+#include <vector>
 
 namespace nlsr::update {
 
-enum { PREFIX_FLAG = 1 };
+enum {
+  PREFIX_FLAG = 1,
+  /// Reply only after the Name LSA carrying the change has been published
+  WAIT_FOR_PUBLICATION_FLAG = 2,
+};
 
 class CommandProcessor : boost::noncopyable
 {
@@ -65,6 +70,45 @@ public:
   withdrawAndRemovePrefix(const ndn::mgmt::ControlParametersBase& parameters,
                           const ndn::mgmt::CommandContinuation& done);
 
+  /*! \brief Add every prefix listed in the bulk command \p interest
+   *         to the advertised name prefix list.
+   *
+   * The list is decoded in full before anything is applied, so a malformed
+   * request leaves the list untouched. A Name LSA build is scheduled if at
+   * least one prefix was new.
+   */
+  void
+  advertiseAndInsertPrefixes(const ndn::Name& topPrefix,
+                             const ndn::Interest& interest,
+                             const ndn::mgmt::ControlParametersBase& parameters,
+                             const ndn::mgmt::CommandContinuation& done);
+
+  /*! \brief Remove every prefix listed in the bulk command \p interest
+   *         from the advertised name prefix list.
+   *
+   * \sa advertiseAndInsertPrefixes
+   */
+  void
+  withdrawAndRemovePrefixes(const ndn::Name& topPrefix,
+                            const ndn::Interest& interest,
+                            const ndn::mgmt::ControlParametersBase& parameters,
+                            const ndn::mgmt::CommandContinuation& done);
+
+  /*! \brief Decode the PrefixList carried by a bulk command Interest.
+   *
+   * The list is the name component following the ControlParameters, i.e.
+   * `/<topPrefix>/<module>/<verb>/<control-parameters>/<prefix-list>`.
+   *
+   * \throw ndn::tlv::Error the component is missing or malformed
+   */
+  static std::vector<PrefixInfo>
+  decodePrefixList(const ndn::Name& topPrefix, const ndn::Interest& interest);
+
+  /*! \brief Encode \p prefixes as a PrefixList block.
+   */
+  static ndn::Block
+  encodePrefixList(const std::vector<PrefixInfo>& prefixes);
+
   /*! \brief Processing after advertise command delegated to subclass.
    *         This is always treated as successful if not implemented.
    *  \return tuple {bool indicating success/failure, message string}.
@@ -91,6 +135,21 @@ protected:
   Lsdb& m_lsdb;
 
 private:
+  /*! \brief Schedule a Name LSA build and send \p response, either right away
+   *         or once the LSA is published if WAIT_FOR_PUBLICATION_FLAG is set.
+   */
+  void
+  scheduleNameLsaBuild(const ndn::nfd::ControlParameters& parameters,
+                       ndn::nfd::ControlResponse response,
+                       const ndn::mgmt::CommandContinuation& done);
+
+  /*! \brief Run the save/delete hooks if requested and build the response of a bulk command.
+   */
+  ndn::nfd::ControlResponse
+  finishBulkCommand(const std::vector<PrefixInfo>& prefixes, size_t nChanged,
+                    bool isAdvertise, const ndn::nfd::ControlParameters& parameters);
+
+protected:
   const uint64_t m_defaultResponseFaceId = 1;
 };
 
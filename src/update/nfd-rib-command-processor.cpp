@@ -20,25 +20,84 @@
  */
 
 #include "nfd-rib-command-processor.hpp"
+#include "logger.hpp"
+#include "metrics/event-loop-monitor.hpp"
 
 #include <ndn-cxx/mgmt/nfd/control-command.hpp>
+#include <ndn-cxx/mgmt/nfd/control-response.hpp>
 
 namespace nlsr::update {
 
+INIT_LOGGER(update.NfdRibCommandProcessor);
+
 NfdRibCommandProcessor::NfdRibCommandProcessor(ndn::mgmt::Dispatcher& dispatcher,
                                                NamePrefixList& namePrefixList,
-                                               Lsdb& lsdb)
+                                               Lsdb& lsdb,
+                                               boost::asio::io_context& io)
   : CommandProcessor(dispatcher, namePrefixList, lsdb)
+  , m_policy(io, std::bind(&NfdRibCommandProcessor::applyChange, this, _1, _2, _3))
 {
   m_dispatcher.addControlCommand<ndn::nfd::RibRegisterCommand>(
     ndn::mgmt::makeAcceptAllAuthorization(),
     // the first and second arguments are ignored since the handler does not need them
-    std::bind(&NfdRibCommandProcessor::advertiseAndInsertPrefix, this, _3, _4));
+    std::bind(&NfdRibCommandProcessor::onRegister, this, _3, _4));
 
   m_dispatcher.addControlCommand<ndn::nfd::RibUnregisterCommand>(
     ndn::mgmt::makeAcceptAllAuthorization(),
     // the first and second arguments are ignored since the handler does not need them
-    std::bind(&NfdRibCommandProcessor::withdrawAndRemovePrefix, this, _3, _4));
+    std::bind(&NfdRibCommandProcessor::onUnregister, this, _3, _4));
+}
+
+void
+NfdRibCommandProcessor::onRegister(const ndn::mgmt::ControlParametersBase& parameters,
+                                   const ndn::mgmt::CommandContinuation& done)
+{
+  metrics::HandlerScope scope(metrics::HandlerTag::DISPATCHER, "onRibRegister");
+  const auto& castParams = static_cast<const ndn::nfd::ControlParameters&>(parameters);
+  double cost = castParams.hasCost() ? castParams.getCost() : 0;
+  done(makeResponse(m_policy.registerPrefix(castParams.getName(), cost), castParams));
+}
+
+void
+NfdRibCommandProcessor::onUnregister(const ndn::mgmt::ControlParametersBase& parameters,
+                                     const ndn::mgmt::CommandContinuation& done)
+{
+  metrics::HandlerScope scope(metrics::HandlerTag::DISPATCHER, "onRibUnregister");
+  const auto& castParams = static_cast<const ndn::nfd::ControlParameters&>(parameters);
+  done(makeResponse(m_policy.unregisterPrefix(castParams.getName()), castParams));
+}
+
+void
+NfdRibCommandProcessor::applyChange(const ndn::Name& prefix, bool isAdvertise, double cost)
+{
+  bool isChanged = isAdvertise ? m_namePrefixList.insert(prefix, "", cost)
+                               : m_namePrefixList.erase(prefix);
+  if (isChanged) {
+    NLSR_LOG_INFO((isAdvertise ? "Advertising name: " : "Withdrawing/Removing name: ") << prefix);
+    m_lsdb.scheduleNameLsaBuild();
+  }
+}
+
+ndn::nfd::ControlResponse
+NfdRibCommandProcessor::makeResponse(ReadvertisePolicy::Result result,
+                                     const ndn::nfd::ControlParameters& parameters) const
+{
+  ndn::nfd::ControlParameters responseParams(parameters.wireEncode());
+  if (!parameters.hasFaceId() || parameters.getFaceId() == 0) {
+    responseParams.setFaceId(m_defaultResponseFaceId);
+  }
+
+  switch (result) {
+  case ReadvertisePolicy::Result::APPLIED:
+    return ndn::nfd::ControlResponse(200, "OK").setBody(responseParams.wireEncode());
+  case ReadvertisePolicy::Result::DEFERRED:
+    return ndn::nfd::ControlResponse(202, "Deferred by the readvertise policy")
+           .setBody(responseParams.wireEncode());
+  case ReadvertisePolicy::Result::UNCHANGED:
+    break;
+  }
+  return ndn::nfd::ControlResponse(204, "Advertised prefixes are unchanged")
+         .setBody(responseParams.wireEncode());
 }
 
 } // namespace nlsr::update
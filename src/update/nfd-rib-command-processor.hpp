@@ -23,15 +23,47 @@
 #define NLSR_UPDATE_NFD_RIB_COMMAND_PROCESSOR_HPP
 
 #include "command-processor.hpp"
+#include "readvertise-policy.hpp"
 
 namespace nlsr::update {
 
+/*! \brief Handles the RIB commands sent by the readvertise module of NFD.
+ *
+ * Every registration and unregistration goes through a ReadvertisePolicy, so that
+ * flapping local applications do not translate into network-wide Name LSA churn.
+ */
 class NfdRibCommandProcessor : public CommandProcessor
 {
 public:
   NfdRibCommandProcessor(ndn::mgmt::Dispatcher& dispatcher,
                          NamePrefixList& namePrefixList,
-                         Lsdb& lsdb);
+                         Lsdb& lsdb,
+                         boost::asio::io_context& io);
+
+  ReadvertisePolicy&
+  getPolicy()
+  {
+    return m_policy;
+  }
+
+private:
+  void
+  onRegister(const ndn::mgmt::ControlParametersBase& parameters,
+             const ndn::mgmt::CommandContinuation& done);
+
+  void
+  onUnregister(const ndn::mgmt::ControlParametersBase& parameters,
+               const ndn::mgmt::CommandContinuation& done);
+
+  void
+  applyChange(const ndn::Name& prefix, bool isAdvertise, double cost);
+
+  ndn::nfd::ControlResponse
+  makeResponse(ReadvertisePolicy::Result result,
+               const ndn::nfd::ControlParameters& parameters) const;
+
+private:
+  ReadvertisePolicy m_policy;
 };
 
 } // namespace nlsr::update
@@ -0,0 +1,354 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "prefix-journal.hpp"
+#include "logger.hpp"
+
+#include <boost/algorithm/string.hpp>
+
+#include <filesystem>
+#include <sstream>
+
+namespace nlsr::update {
+
+INIT_LOGGER(update.PrefixJournal);
+
+static std::vector<std::string>
+readLines(const std::string& fileName)
+{
+  std::ifstream input(fileName);
+  if (!input.is_open()) {
+    NDN_THROW(std::runtime_error("Failed to open " + fileName));
+  }
+  std::vector<std::string> lines;
+  std::string line;
+  while (std::getline(input, line)) {
+    lines.push_back(std::move(line));
+  }
+  return lines;
+}
+
+static void
+writeLinesAtomically(const std::string& fileName, const std::vector<std::string>& lines)
+{
+  std::string tmpName = fileName + ".tmp";
+  {
+    std::ofstream output(tmpName, std::ios::trunc);
+    for (const auto& line : lines) {
+      output << line << '\n';
+    }
+    if (!output.flush()) {
+      NDN_THROW(std::runtime_error("Failed to write " + tmpName));
+    }
+  }
+  std::filesystem::rename(tmpName, fileName);
+}
+
+/*! \brief Strips the comment and surrounding whitespace of a line in INFO format.
+ */
+static std::string
+getContent(const std::string& line)
+{
+  auto content = line.substr(0, line.find(';'));
+  boost::trim(content);
+  return content;
+}
+
+/*! \brief Returns the name of a "prefix <name>" line, or nullopt for any other line.
+ */
+static std::optional<ndn::Name>
+parsePrefixLine(const std::string& content)
+{
+  std::istringstream is(content);
+  std::string key, uri;
+  if (!(is >> key >> uri) || key != "prefix") {
+    return std::nullopt;
+  }
+  try {
+    return ndn::Name(uri);
+  }
+  catch (const std::exception&) {
+    return std::nullopt;
+  }
+}
+
+namespace {
+
+/*! \brief Tracks whether consecutive lines are inside the top-level `advertising` section.
+ */
+class AdvertisingSectionTracker
+{
+public:
+  /*! \return whether \p content is a line inside the section, excluding braces
+   */
+  bool
+  feed(const std::string& content)
+  {
+    if (m_state == State::INSIDE) {
+      if (boost::starts_with(content, "}")) {
+        m_state = State::DONE;
+        return false;
+      }
+      return true;
+    }
+    if (m_state == State::BEFORE && boost::starts_with(content, "advertising")) {
+      m_state = State::HEADER;
+    }
+    if (m_state == State::HEADER && boost::ends_with(content, "{")) {
+      m_state = State::INSIDE;
+      m_hasJustOpened = true;
+      return false;
+    }
+    m_hasJustOpened = false;
+    return false;
+  }
+
+  /*! \brief Returns whether the last line fed opened the section.
+   */
+  bool
+  hasJustOpened()
+  {
+    bool hasOpened = m_hasJustOpened;
+    m_hasJustOpened = false;
+    return hasOpened;
+  }
+
+  bool
+  wasFound() const
+  {
+    return m_state != State::BEFORE;
+  }
+
+private:
+  enum class State {
+    BEFORE,
+    HEADER,
+    INSIDE,
+    DONE,
+  };
+  State m_state = State::BEFORE;
+  bool m_hasJustOpened = false;
+};
+
+} // namespace
+
+PrefixJournal::PrefixJournal(const std::string& confFileName)
+  : m_confFileName(confFileName)
+{
+}
+
+PrefixJournal::~PrefixJournal()
+{
+  if (m_nPendingRecords > 0) {
+    compact();
+  }
+}
+
+std::set<ndn::Name>
+PrefixJournal::parseAdvertising(const std::vector<std::string>& lines)
+{
+  std::set<ndn::Name> prefixes;
+  AdvertisingSectionTracker tracker;
+  for (const auto& line : lines) {
+    auto content = getContent(line);
+    if (tracker.feed(content)) {
+      if (auto prefix = parsePrefixLine(content); prefix) {
+        prefixes.insert(*prefix);
+      }
+    }
+  }
+  return prefixes;
+}
+
+std::vector<std::string>
+PrefixJournal::rewriteAdvertising(const std::vector<std::string>& lines,
+                                  const std::set<ndn::Name>& saved)
+{
+  auto missing = saved;
+  for (const auto& prefix : parseAdvertising(lines)) {
+    missing.erase(prefix);
+  }
+
+  std::vector<std::string> output;
+  output.reserve(lines.size() + missing.size());
+  std::set<ndn::Name> emitted;
+  AdvertisingSectionTracker tracker;
+  for (const auto& line : lines) {
+    auto content = getContent(line);
+    if (!tracker.feed(content)) {
+      output.push_back(line);
+      if (tracker.hasJustOpened()) {
+        for (const auto& prefix : missing) {
+          output.push_back("  prefix " + prefix.toUri());
+        }
+      }
+      continue;
+    }
+    auto prefix = parsePrefixLine(content);
+    if (!prefix) {
+      output.push_back(line);
+    }
+    else if (saved.count(*prefix) > 0 && emitted.insert(*prefix).second) {
+      output.push_back(line);
+    }
+  }
+
+  if (!tracker.wasFound() && !missing.empty()) {
+    output.emplace_back("advertising");
+    output.emplace_back("{");
+    for (const auto& prefix : missing) {
+      output.push_back("  prefix " + prefix.toUri());
+    }
+    output.emplace_back("}");
+  }
+  return output;
+}
+
+std::map<ndn::Name, bool>
+PrefixJournal::load()
+{
+  if (m_isLoaded) {
+    return {};
+  }
+
+  m_configured = parseAdvertising(readLines(m_confFileName));
+  m_saved = m_configured;
+
+  std::ifstream journal(getJournalFileName());
+  std::string line;
+  while (std::getline(journal, line)) {
+    if (line.size() < 3 || (line[0] != '+' && line[0] != '-') || line[1] != ' ') {
+      NLSR_LOG_WARN("Ignoring malformed journal record: " << line);
+      continue;
+    }
+    try {
+      ndn::Name prefix(line.substr(2));
+      if (line[0] == '+') {
+        m_saved.insert(prefix);
+      }
+      else {
+        m_saved.erase(prefix);
+      }
+      ++m_nPendingRecords;
+    }
+    catch (const std::exception& e) {
+      NLSR_LOG_WARN("Ignoring malformed journal record: " << line);
+    }
+  }
+  m_isLoaded = true;
+
+  std::map<ndn::Name, bool> changes;
+  for (const auto& prefix : m_saved) {
+    if (m_configured.count(prefix) == 0) {
+      changes.emplace(prefix, true);
+    }
+  }
+  for (const auto& prefix : m_configured) {
+    if (m_saved.count(prefix) == 0) {
+      changes.emplace(prefix, false);
+    }
+  }
+  NLSR_LOG_DEBUG("Replayed " << m_nPendingRecords << " journal records, " <<
+                 changes.size() << " prefixes differ from " << m_confFileName);
+  return changes;
+}
+
+bool
+PrefixJournal::contains(const ndn::Name& prefix)
+{
+  load();
+  return m_saved.count(prefix) > 0;
+}
+
+bool
+PrefixJournal::add(const ndn::Name& prefix)
+{
+  load();
+  if (!m_saved.insert(prefix).second) {
+    return false;
+  }
+  append('+', prefix);
+  return true;
+}
+
+bool
+PrefixJournal::remove(const ndn::Name& prefix)
+{
+  load();
+  if (m_saved.erase(prefix) == 0) {
+    return false;
+  }
+  append('-', prefix);
+  return true;
+}
+
+void
+PrefixJournal::append(char op, const ndn::Name& prefix)
+{
+  m_worker.post([this, fileName = getJournalFileName(),
+                 record = std::string{op, ' '} + prefix.toUri()] {
+    if (!m_journal.is_open()) {
+      m_journal.open(fileName, std::ios::app);
+    }
+    m_journal << record << '\n';
+    if (!m_journal.flush()) {
+      NLSR_LOG_ERROR("Failed to append to " << fileName);
+    }
+  });
+
+  // Compacting once the pending records outnumber the net ones keeps the total cost linear
+  ++m_nPendingRecords;
+  if (m_nPendingRecords >= std::max(COMPACTION_THRESHOLD, m_nNetRecords)) {
+    compact();
+  }
+}
+
+void
+PrefixJournal::compact()
+{
+  if (!m_isLoaded) {
+    return;
+  }
+
+  std::vector<std::string> records;
+  for (const auto& prefix : m_saved) {
+    if (m_configured.count(prefix) == 0) {
+      records.push_back("+ " + prefix.toUri());
+    }
+  }
+  for (const auto& prefix : m_configured) {
+    if (m_saved.count(prefix) == 0) {
+      records.push_back("- " + prefix.toUri());
+    }
+  }
+  m_nNetRecords = records.size();
+  m_nPendingRecords = 0;
+
+  m_worker.post([this, confFileName = m_confFileName, journalFileName = getJournalFileName(),
+                 saved = m_saved, records = std::move(records)] {
+    NLSR_LOG_DEBUG("Compacting " << journalFileName << " into " << confFileName);
+    writeLinesAtomically(confFileName, rewriteAdvertising(readLines(confFileName), saved));
+    m_journal.close();
+    writeLinesAtomically(journalFileName, records);
+  });
+}
+
+} // namespace nlsr::update
@@ -0,0 +1,145 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_UPDATE_PREFIX_JOURNAL_HPP
+#define NLSR_UPDATE_PREFIX_JOURNAL_HPP
+
+#include "common.hpp"
+#include "test-access-control.hpp"
+#include "utility/io-worker.hpp"
+
+#include <fstream>
+#include <map>
+#include <optional>
+#include <set>
+#include <vector>
+
+namespace nlsr::update {
+
+/*! \brief Persists prefixes saved or deleted at runtime into the dynamic configuration file.
+ *
+ * Every change is appended as one line ("+ /prefix" or "- /prefix") to a journal
+ * stored next to the configuration file, at `<configuration file>.journal`. The
+ * journal is folded into the `advertising` section of the configuration file
+ * once it holds COMPACTION_THRESHOLD records, when an operator sends the
+ * prefix-update/compact command (`nlsrc compact`), and on destruction.
+ *
+ * Records are relative to the prefixes found in the configuration file when the
+ * journal is loaded. Since NLSR recreates the dynamic configuration file at
+ * startup, the journal is kept across compactions in its net form, so that
+ * replaying it at the next start restores every saved change.
+ *
+ * All writes happen on a background thread; apart from the initial load, the
+ * public interface only updates in-memory state.
+ */
+class PrefixJournal : boost::noncopyable
+{
+public:
+  static constexpr size_t COMPACTION_THRESHOLD = 4096;
+
+  /*! \param confFileName Name of the dynamic configuration file. It is read on first use,
+   *                      so it may be set after construction.
+   */
+  explicit
+  PrefixJournal(const std::string& confFileName);
+
+  ~PrefixJournal();
+
+  /*! \brief Loads the configuration file and replays the journal, if not done yet.
+   *
+   * \return the prefixes whose saved state differs from the configuration file,
+   *         mapped to true if saved and false if deleted
+   * \throw std::runtime_error the configuration file cannot be read
+   */
+  std::map<ndn::Name, bool>
+  load();
+
+  bool
+  contains(const ndn::Name& prefix);
+
+  /*! \brief Records \p prefix as saved.
+   * \retval false the prefix was already saved
+   */
+  bool
+  add(const ndn::Name& prefix);
+
+  /*! \brief Records \p prefix as deleted.
+   * \retval false the prefix was not saved
+   */
+  bool
+  remove(const ndn::Name& prefix);
+
+  /*! \brief Schedules a rewrite of the configuration file and the journal.
+   */
+  void
+  compact();
+
+  /*! \brief Blocks until all queued writes have reached the filesystem.
+   */
+  void
+  flush()
+  {
+    m_worker.flush();
+  }
+
+  std::string
+  getJournalFileName() const
+  {
+    return m_confFileName + ".journal";
+  }
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /*! \brief Returns the prefixes listed in the `advertising` section of \p lines.
+   */
+  static std::set<ndn::Name>
+  parseAdvertising(const std::vector<std::string>& lines);
+
+  /*! \brief Rewrites the `advertising` section of \p lines to list exactly \p saved.
+   *
+   * Existing lines for saved prefixes are kept in place, together with comments
+   * and blank lines; other prefix lines are dropped and new prefixes are
+   * inserted at the start of the section.
+   */
+  static std::vector<std::string>
+  rewriteAdvertising(const std::vector<std::string>& lines, const std::set<ndn::Name>& saved);
+
+private:
+  void
+  append(char op, const ndn::Name& prefix);
+
+private:
+  const std::string& m_confFileName;
+  bool m_isLoaded = false;
+  std::set<ndn::Name> m_configured;
+  std::set<ndn::Name> m_saved;
+  size_t m_nPendingRecords = 0;
+  size_t m_nNetRecords = 0;
+
+  // accessed on the worker thread only
+  std::ofstream m_journal;
+
+  // declared last, so that it drains before the members above are destroyed
+  util::IoWorker m_worker;
+};
+
+} // namespace nlsr::update
+
+#endif // NLSR_UPDATE_PREFIX_JOURNAL_HPP
@@ -41,4 +41,21 @@ const WithdrawPrefixCommand::ResponseFormat WithdrawPrefixCommand::s_responseFor
     .required(ndn::nfd::CONTROL_PARAMETER_NAME)
     .optional(ndn::nfd::CONTROL_PARAMETER_FLAGS);
 
+const AdvertisePrefixBulkCommand::RequestFormat AdvertisePrefixBulkCommand::s_requestFormat =
+    RequestFormat()
+    .optional(ndn::nfd::CONTROL_PARAMETER_FLAGS);
+const AdvertisePrefixBulkCommand::ResponseFormat AdvertisePrefixBulkCommand::s_responseFormat =
+    ResponseFormat()
+    .optional(ndn::nfd::CONTROL_PARAMETER_FLAGS);
+
+const WithdrawPrefixBulkCommand::RequestFormat WithdrawPrefixBulkCommand::s_requestFormat =
+    RequestFormat()
+    .optional(ndn::nfd::CONTROL_PARAMETER_FLAGS);
+const WithdrawPrefixBulkCommand::ResponseFormat WithdrawPrefixBulkCommand::s_responseFormat =
+    ResponseFormat()
+    .optional(ndn::nfd::CONTROL_PARAMETER_FLAGS);
+
+const CompactJournalCommand::RequestFormat CompactJournalCommand::s_requestFormat;
+const CompactJournalCommand::ResponseFormat CompactJournalCommand::s_responseFormat;
+
 } // namespace nlsr::update
@@ -48,6 +48,40 @@ class WithdrawPrefixCommand : public ndn::nfd::ControlCommand<WithdrawPrefixComm
   NDN_CXX_CONTROL_COMMAND("prefix-update", "withdraw");
 };
 
+/*! \brief Advertises a list of prefixes with a single Name LSA origination.
+ *
+ * The prefixes are carried in the name component that follows the ControlParameters,
+ * as a PrefixList of PrefixInfo elements, so they are covered by the command
+ * Interest signature:
+ *
+ *   /<prefix>/prefix-update/advertise-bulk/<control-parameters>/<prefix-list>
+ *   /<timestamp>/<random-value>/<signed-interests-components>
+ *
+ * The ControlParameters only carry the optional save flag.
+ */
+class AdvertisePrefixBulkCommand : public ndn::nfd::ControlCommand<AdvertisePrefixBulkCommand>
+{
+  NDN_CXX_CONTROL_COMMAND("prefix-update", "advertise-bulk");
+};
+
+/*! \brief Withdraws a list of prefixes with a single Name LSA origination.
+ *
+ * \sa AdvertisePrefixBulkCommand
+ */
+class WithdrawPrefixBulkCommand : public ndn::nfd::ControlCommand<WithdrawPrefixBulkCommand>
+{
+  NDN_CXX_CONTROL_COMMAND("prefix-update", "withdraw-bulk");
+};
+
+/*! \brief Folds the journal of saved and deleted prefixes into the configuration file.
+ *
+ * \sa PrefixJournal
+ */
+class CompactJournalCommand : public ndn::nfd::ControlCommand<CompactJournalCommand>
+{
+  NDN_CXX_CONTROL_COMMAND("prefix-update", "compact");
+};
+
 } // namespace nlsr::update
 
 #endif // NLSR_UPDATE_PREFIX_UPDATE_COMMANDS_HPP
@@ -23,8 +23,7 @@
 #include "logger.hpp"
 #include "prefix-update-commands.hpp"
 
-#include <boost/algorithm/string.hpp>
-#include <fstream>
+#include <ndn-cxx/mgmt/nfd/control-response.hpp>
 
 namespace nlsr::update {
 
@@ -55,6 +54,7 @@ PrefixUpdateProcessor::PrefixUpdateProcessor(ndn::mgmt::Dispatcher& dispatcher,
   : CommandProcessor(dispatcher, namePrefixList, lsdb)
   , m_validator(validator)
   , m_confFileNameDynamic(configFileName)
+  , m_journal(m_confFileNameDynamic)
 {
   m_dispatcher.addControlCommand<AdvertisePrefixCommand>(
     makeAuthorization(),
@@ -65,6 +65,18 @@ PrefixUpdateProcessor::PrefixUpdateProcessor(ndn::mgmt::Dispatcher& dispatcher,
     makeAuthorization(),
     // the first and second arguments are ignored since the handler does not need them
     std::bind(&PrefixUpdateProcessor::withdrawAndRemovePrefix, this, _3, _4));
+
+  m_dispatcher.addControlCommand<AdvertisePrefixBulkCommand>(
+    makeAuthorization(),
+    std::bind(&PrefixUpdateProcessor::advertiseAndInsertPrefixes, this, _1, _2, _3, _4));
+
+  m_dispatcher.addControlCommand<WithdrawPrefixBulkCommand>(
+    makeAuthorization(),
+    std::bind(&PrefixUpdateProcessor::withdrawAndRemovePrefixes, this, _1, _2, _3, _4));
+
+  m_dispatcher.addControlCommand<CompactJournalCommand>(
+    makeAuthorization(),
+    std::bind(&PrefixUpdateProcessor::compactJournal, this, _4));
 }
 
 ndn::mgmt::Authorization
@@ -96,75 +108,71 @@ PrefixUpdateProcessor::loadValidator(boost::property_tree::ptree section,
   m_validator.load(section, filename);
 }
 
-bool
-PrefixUpdateProcessor::checkForPrefixInFile(const std::string prefix)
+void
+PrefixUpdateProcessor::replayJournal()
 {
-  std::string line;
-  std::fstream fp(m_confFileNameDynamic);
-  if (!fp.good() || !fp.is_open()) {
-    NLSR_LOG_ERROR("Failed to open configuration file for parsing");
-    return true;
+  if (m_confFileNameDynamic.empty()) {
+    return;
   }
-  while (!fp.eof()) {
-    getline(fp, line);
-    if (line == prefix) {
-      return true;
+
+  std::map<ndn::Name, bool> changes;
+  try {
+    changes = m_journal.load();
+  }
+  catch (const std::exception& e) {
+    NLSR_LOG_ERROR("Cannot replay the prefix journal: " << e.what());
+    return;
+  }
+
+  bool hasChanged = false;
+  for (const auto& [prefix, isSaved] : changes) {
+    if (isSaved) {
+      NLSR_LOG_INFO("Advertising saved name: " << prefix);
+      hasChanged |= m_namePrefixList.insert(prefix);
     }
+    else {
+      NLSR_LOG_INFO("Withdrawing deleted name: " << prefix);
+      hasChanged |= m_namePrefixList.erase(prefix);
+    }
+  }
+  if (hasChanged) {
+    m_lsdb.scheduleNameLsaBuild();
   }
-  return false;
 }
 
-std::tuple<bool, std::string>
-PrefixUpdateProcessor::addOrDeletePrefix(const ndn::Name& prefix, bool addPrefix)
+void
+PrefixUpdateProcessor::compactJournal(const ndn::mgmt::CommandContinuation& done)
 {
-  std::string value = " prefix " + prefix.toUri();
-  std::string fileString;
-  std::string line;
-  std::string trimedLine;
-  std::fstream input(m_confFileNameDynamic, input.in);
-  if (!input.good() || !input.is_open()) {
-    NLSR_LOG_ERROR("Failed to open configuration file for parsing");
-    return {false, "Failed to open configuration file for parsing"};
+  if (m_confFileNameDynamic.empty()) {
+    return done(ndn::nfd::ControlResponse(405, "No configuration file to compact into"));
   }
 
-  if (addPrefix) {
-    //check if prefix already exist in the nlsr configuration file
-    if (checkForPrefixInFile(value)) {
-      NLSR_LOG_ERROR("Prefix already exists in the configuration file");
-      return {false, "Prefix already exists in the configuration file"};
-    }
-    while (!input.eof()) {
-      getline(input, line);
-      if (!line.empty()) {
-        fileString.append(line + "\n");
-        if (line == "advertising") {
-          getline(input, line);
-          fileString.append(line + "\n" + value + "\n");
-        }
+  NLSR_LOG_INFO("Compacting the prefix journal into " << m_confFileNameDynamic);
+  m_journal.compact();
+  done(ndn::nfd::ControlResponse(200, "OK"));
+}
+
+std::tuple<bool, std::string>
+PrefixUpdateProcessor::addOrDeletePrefix(const ndn::Name& prefix, bool addPrefix)
+{
+  try {
+    if (addPrefix) {
+      if (!m_journal.add(prefix)) {
+        NLSR_LOG_ERROR("Prefix already exists in the configuration file");
+        return {false, "Prefix already exists in the configuration file"};
       }
     }
-  }
-  else {
-    if (!checkForPrefixInFile(value)) {
-      NLSR_LOG_ERROR("Prefix doesn't exists in the configuration file");
-      return {false, "Prefix doesn't exists in the configuration file"};
-    }
-    boost::trim(value);
-    while (!input.eof()) {
-      getline(input, line);
-      if (!line.empty()) {
-        std::string trimLine = line;
-        boost::trim(trimLine);
-        if (trimLine != value) {
-          fileString.append(line + "\n");
-        }
+    else {
+      if (!m_journal.remove(prefix)) {
+        NLSR_LOG_ERROR("Prefix doesn't exists in the configuration file");
+        return {false, "Prefix doesn't exists in the configuration file"};
       }
     }
   }
-  input.close();
-  std::ofstream output(m_confFileNameDynamic);
-  output << fileString;
-  output.close();
+  catch (const std::exception& e) {
+    NLSR_LOG_ERROR("Failed to open configuration file for parsing: " << e.what());
+    return {false, "Failed to open configuration file for parsing"};
+  }
   return {true, "OK"};
 }
 
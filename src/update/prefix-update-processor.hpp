@@ -23,6 +23,7 @@
 #define NLSR_UPDATE_PREFIX_UPDATE_PROCESSOR_HPP
 
 #include "command-processor.hpp"
+#include "prefix-journal.hpp"
 
 #include <ndn-cxx/security/key-chain.hpp>
 
@@ -54,8 +55,19 @@ public:
   void
   loadValidator(ConfigSection section, const std::string& filename);
 
+  /*! \brief Re-apply the prefixes saved or deleted before the last restart.
+   *
+   * Prefixes recorded in the journal of the dynamic configuration file are
+   * advertised or withdrawn, and a Name LSA build is scheduled if anything changed.
+   */
+  void
+  replayJournal();
+
   /*! \brief Add or delete an advertise or withdrawn prefix to the nlsr
    * configuration file
+   *
+   * The change is recorded in memory and appended to the journal in the
+   * background; the configuration file itself is rewritten on compaction.
    */
   std::tuple<bool, std::string>
   addOrDeletePrefix(const ndn::Name& prefix, bool addPrefix);
@@ -72,17 +84,26 @@ public:
   std::tuple<bool, std::string>
   afterWithdraw(const ndn::Name& prefix) override;
 
-  /*! \brief Check if a prefix exists in the nlsr configuration file */
-  bool
-  checkForPrefixInFile(const std::string prefix);
-
   ndn::security::ValidatorConfig&
   getValidator()
   {
     return m_validator;
   }
 
+  PrefixJournal&
+  getJournal()
+  {
+    return m_journal;
+  }
+
 private:
+  /*! \brief Schedules the compaction of the journal into the dynamic configuration file.
+   *
+   * The response is sent once the rewrite is queued, not when it completes.
+   */
+  void
+  compactJournal(const ndn::mgmt::CommandContinuation& done);
+
   /*! \brief an authorization function for prefix-update module and verb(advertise/withdraw)
    *  accept if the verb is advertise/withdraw
    *  reject if the verb is not advertise/withdraw
@@ -95,6 +116,7 @@ private:
 private:
   ndn::security::ValidatorConfig& m_validator;
   const std::string& m_confFileNameDynamic;
+  PrefixJournal m_journal;
 };
 
 } // namespace nlsr::update
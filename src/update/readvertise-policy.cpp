@@ -0,0 +1,231 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "readvertise-policy.hpp"
+#include "logger.hpp"
+#include "metrics/metrics-registry.hpp"
+
+#include <cmath>
+
+namespace nlsr::update {
+
+INIT_LOGGER(update.ReadvertisePolicy);
+
+auto& suppressedChanges = metrics::Registry::get().addCounter("nlsr_readvertise_suppressed_total",
+  "Readvertised prefix changes cancelled by a hold-down timer or undone while queued");
+auto& aggregatedChanges = metrics::Registry::get().addCounter("nlsr_readvertise_aggregated_total",
+  "Readvertised prefix changes absorbed by an already advertised covering prefix");
+auto& rateLimitedChanges = metrics::Registry::get().addCounter("nlsr_readvertise_rate_limited_total",
+  "Readvertised prefix changes queued by the rate limit");
+
+ReadvertisePolicy::ReadvertisePolicy(boost::asio::io_context& io, ApplyCallback apply)
+  : m_scheduler(io)
+  , m_apply(std::move(apply))
+  , m_lastRefill(ndn::time::steady_clock::now())
+{
+}
+
+void
+ReadvertisePolicy::addAggregate(const ndn::Name& prefix)
+{
+  NLSR_LOG_INFO("Aggregating readvertised prefixes under " << prefix);
+  m_aggregates.push_back(prefix);
+}
+
+const ndn::Name*
+ReadvertisePolicy::findAggregate(const ndn::Name& prefix) const
+{
+  for (const auto& aggregate : m_aggregates) {
+    if (aggregate.isPrefixOf(prefix)) {
+      return &aggregate;
+    }
+  }
+  return nullptr;
+}
+
+ReadvertisePolicy::Result
+ReadvertisePolicy::registerPrefix(const ndn::Name& prefix, double cost)
+{
+  const auto* aggregate = findAggregate(prefix);
+  if (aggregate == nullptr) {
+    auto& entry = m_entries[prefix];
+    if (!entry.isWanted) {
+      entry.cost = cost;
+    }
+    return setWanted(prefix, entry, true);
+  }
+
+  if (!m_children.insert(prefix).second) {
+    return Result::UNCHANGED;
+  }
+  auto& entry = m_entries[*aggregate];
+  if (entry.nChildren++ > 0) {
+    NLSR_LOG_DEBUG(prefix << " is covered by " << *aggregate);
+    aggregatedChanges.increment();
+    return Result::UNCHANGED;
+  }
+  entry.cost = cost;
+  return setWanted(*aggregate, entry, true);
+}
+
+ReadvertisePolicy::Result
+ReadvertisePolicy::unregisterPrefix(const ndn::Name& prefix)
+{
+  const auto* aggregate = findAggregate(prefix);
+  if (aggregate == nullptr) {
+    auto it = m_entries.find(prefix);
+    if (it == m_entries.end()) {
+      // Not registered through the policy, e.g. advertised before a restart of NFD:
+      // withdraw it as usual
+      it = m_entries.emplace(prefix, Entry{}).first;
+      it->second.isWanted = it->second.isAdvertised = true;
+    }
+    return setWanted(prefix, it->second, false);
+  }
+
+  if (m_children.erase(prefix) == 0) {
+    return Result::UNCHANGED;
+  }
+  auto& entry = m_entries.at(*aggregate);
+  if (--entry.nChildren > 0) {
+    NLSR_LOG_DEBUG(prefix << " is still covered by " << *aggregate);
+    aggregatedChanges.increment();
+    return Result::UNCHANGED;
+  }
+  return setWanted(*aggregate, entry, false);
+}
+
+ReadvertisePolicy::Result
+ReadvertisePolicy::setWanted(const ndn::Name& name, Entry& entry, bool isWanted)
+{
+  entry.isWanted = isWanted;
+
+  if (entry.isHeldDown) {
+    entry.holdDownEvent.cancel();
+    entry.isHeldDown = false;
+    if (isWanted) {
+      NLSR_LOG_DEBUG("Cancelled held-down withdrawal of " << name);
+      suppressedChanges.increment();
+      return Result::UNCHANGED;
+    }
+  }
+
+  if (entry.isWanted == entry.isAdvertised) {
+    if (entry.isQueued) {
+      // dropped when it reaches the head of the queue
+      NLSR_LOG_DEBUG("Cancelled queued change of " << name);
+      suppressedChanges.increment();
+    }
+    else {
+      eraseIfIdle(m_entries.find(name));
+    }
+    return Result::UNCHANGED;
+  }
+
+  if (!isWanted && m_holdDown > 0_s) {
+    NLSR_LOG_DEBUG("Holding down withdrawal of " << name << " for " << m_holdDown);
+    entry.isHeldDown = true;
+    entry.holdDownEvent = m_scheduler.schedule(m_holdDown, [this, name] {
+      auto it = m_entries.find(name);
+      it->second.isHeldDown = false;
+      enqueue(it->first, it->second);
+    });
+    return Result::DEFERRED;
+  }
+
+  return enqueue(name, entry);
+}
+
+ReadvertisePolicy::Result
+ReadvertisePolicy::enqueue(const ndn::Name& name, Entry& entry)
+{
+  if (!entry.isQueued) {
+    entry.isQueued = true;
+    m_queue.push_back(name);
+  }
+
+  // processQueue may erase the entry, and name may be its key
+  ndn::Name queuedName = name;
+  processQueue();
+
+  auto it = m_entries.find(queuedName);
+  if (it != m_entries.end() && it->second.isQueued) {
+    NLSR_LOG_DEBUG("Rate limit reached, queued change of " << queuedName);
+    rateLimitedChanges.increment();
+    return Result::DEFERRED;
+  }
+  return Result::APPLIED;
+}
+
+void
+ReadvertisePolicy::processQueue()
+{
+  refillTokens();
+
+  while (!m_queue.empty()) {
+    auto it = m_entries.find(m_queue.front());
+    auto& entry = it->second;
+    if (entry.isWanted != entry.isAdvertised) {
+      if (m_maxChangesPerSecond > 0) {
+        if (m_tokens < 1) {
+          break;
+        }
+        m_tokens -= 1;
+      }
+      NLSR_LOG_DEBUG((entry.isWanted ? "Advertising " : "Withdrawing ") << it->first);
+      entry.isAdvertised = entry.isWanted;
+      m_apply(it->first, entry.isWanted, entry.cost);
+    }
+    entry.isQueued = false;
+    m_queue.pop_front();
+    eraseIfIdle(it);
+  }
+
+  if (!m_queue.empty()) {
+    auto wait = std::ceil((1 - m_tokens) * 1000 / m_maxChangesPerSecond);
+    m_queueEvent = m_scheduler.schedule(ndn::time::milliseconds(std::max<int64_t>(wait, 1)),
+                                        [this] { processQueue(); });
+  }
+}
+
+void
+ReadvertisePolicy::refillTokens()
+{
+  auto now = ndn::time::steady_clock::now();
+  if (m_maxChangesPerSecond > 0) {
+    auto elapsed = ndn::time::duration_cast<ndn::time::milliseconds>(now - m_lastRefill);
+    m_tokens = std::min<double>(m_maxChangesPerSecond,
+                                m_tokens + elapsed.count() * m_maxChangesPerSecond / 1000.0);
+  }
+  m_lastRefill = now;
+}
+
+void
+ReadvertisePolicy::eraseIfIdle(std::map<ndn::Name, Entry>::iterator it)
+{
+  const auto& entry = it->second;
+  if (!entry.isWanted && !entry.isAdvertised && !entry.isQueued && !entry.isHeldDown &&
+      entry.nChildren == 0) {
+    m_entries.erase(it);
+  }
+}
+
+} // namespace nlsr::update
@@ -0,0 +1,160 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_UPDATE_READVERTISE_POLICY_HPP
+#define NLSR_UPDATE_READVERTISE_POLICY_HPP
+
+#include "common.hpp"
+#include "test-access-control.hpp"
+
+#include <ndn-cxx/util/scheduler.hpp>
+
+#include <boost/noncopyable.hpp>
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace nlsr::update {
+
+/*! \brief Shapes the prefix changes readvertised from the NFD RIB before they reach the Name LSA.
+ *
+ * Three mechanisms are applied, each disabled by default:
+ *  - a withdrawal is held down for a configurable time, and cancelled if the prefix is
+ *    registered again meanwhile, so a producer restarting in a loop causes no LSA churn;
+ *  - registrations under a configured covering prefix are advertised as that prefix,
+ *    which stays advertised as long as at least one child is registered;
+ *  - changes are applied through a token bucket refilled at a configurable rate,
+ *    excess changes being queued. A queued change that is undone before its turn
+ *    is dropped.
+ */
+class ReadvertisePolicy : boost::noncopyable
+{
+public:
+  /*! \brief Applies a change to the advertised prefixes.
+   */
+  using ApplyCallback = std::function<void(const ndn::Name& prefix, bool isAdvertise, double cost)>;
+
+  enum class Result {
+    /// The change was applied right away
+    APPLIED,
+    /// The change has no effect on the advertised prefixes
+    UNCHANGED,
+    /// The change was held down, rate limited, or absorbed by a covering prefix
+    DEFERRED,
+  };
+
+  ReadvertisePolicy(boost::asio::io_context& io, ApplyCallback apply);
+
+  void
+  setHoldDown(ndn::time::seconds holdDown)
+  {
+    m_holdDown = holdDown;
+  }
+
+  /*! \param rate maximum number of changes applied per second, 0 for unlimited
+   */
+  void
+  setMaxChangesPerSecond(uint32_t rate)
+  {
+    m_maxChangesPerSecond = rate;
+    m_tokens = rate;
+  }
+
+  /*! \brief Advertise registrations under \p prefix, including \p prefix itself, as \p prefix.
+   *
+   * If several covering prefixes match a registration, the first one added is used.
+   */
+  void
+  addAggregate(const ndn::Name& prefix);
+
+  Result
+  registerPrefix(const ndn::Name& prefix, double cost);
+
+  Result
+  unregisterPrefix(const ndn::Name& prefix);
+
+PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /*! \brief Returns the covering prefix of \p prefix, or nullptr if it is not aggregated.
+   */
+  const ndn::Name*
+  findAggregate(const ndn::Name& prefix) const;
+
+  size_t
+  getQueueSize() const
+  {
+    return m_queue.size();
+  }
+
+private:
+  struct Entry
+  {
+    double cost = 0;
+    bool isWanted = false;
+    bool isAdvertised = false;
+    bool isQueued = false;
+    bool isHeldDown = false;
+    /// Number of registered children, for covering prefixes
+    size_t nChildren = 0;
+    ndn::scheduler::ScopedEventId holdDownEvent;
+  };
+
+  Result
+  setWanted(const ndn::Name& name, Entry& entry, bool isWanted);
+
+  Result
+  enqueue(const ndn::Name& name, Entry& entry);
+
+  /*! \brief Apply queued changes as long as tokens are available.
+   */
+  void
+  processQueue();
+
+  void
+  refillTokens();
+
+  void
+  eraseIfIdle(std::map<ndn::Name, Entry>::iterator it);
+
+private:
+  ndn::Scheduler m_scheduler;
+  ApplyCallback m_apply;
+
+  ndn::time::seconds m_holdDown = 0_s;
+  uint32_t m_maxChangesPerSecond = 0;
+  std::vector<ndn::Name> m_aggregates;
+
+  /// Keyed by the advertised name, i.e. after aggregation
+  std::map<ndn::Name, Entry> m_entries;
+  /// Registrations absorbed by a covering prefix
+  std::set<ndn::Name> m_children;
+
+  std::deque<ndn::Name> m_queue;
+  double m_tokens = 0;
+  ndn::time::steady_clock::time_point m_lastRefill;
+  ndn::scheduler::ScopedEventId m_queueEvent;
+};
+
+} // namespace nlsr::update
+
+#endif // NLSR_UPDATE_READVERTISE_POLICY_HPP
@@ -0,0 +1,114 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "arena.hpp"
+
+#include <algorithm>
+
+namespace nlsr::util {
+
+Arena::Arena(size_t initialBlockSize)
+  : m_nextBlockSize(std::max<size_t>(initialBlockSize, 1))
+{
+}
+
+void*
+Arena::allocate(size_t size, size_t alignment)
+{
+  size = std::max<size_t>(size, 1);
+  void* cursor = m_cursor;
+  size_t space = static_cast<size_t>(m_end - m_cursor);
+  while (m_cursor == nullptr || std::align(alignment, size, cursor, space) == nullptr) {
+    // Blocks kept by release() are reused before new ones are added
+    if (!useNextBlock()) {
+      // Blocks grow geometrically, so a computation needs few of them
+      addBlock(std::max(m_nextBlockSize, size + alignment));
+      m_nextBlockSize *= 2;
+    }
+    cursor = m_cursor;
+    space = static_cast<size_t>(m_end - m_cursor);
+  }
+
+  m_cursor = static_cast<std::byte*>(cursor) + size;
+  m_usedBytes += size;
+  return cursor;
+}
+
+void
+Arena::reset()
+{
+  if (m_blocks.size() > 1) {
+    // Merge the blocks, so the next computation of the same size fits in the first one
+    size_t capacity = getCapacity();
+    m_blocks.clear();
+    addBlock(capacity);
+  }
+  else if (!m_blocks.empty()) {
+    m_current = 0;
+    m_cursor = m_blocks.front().data.get();
+    m_end = m_cursor + m_blocks.front().size;
+  }
+  m_usedBytes = 0;
+}
+
+void
+Arena::release(const Mark& mark)
+{
+  m_current = mark.block;
+  m_cursor = mark.cursor;
+  m_end = m_cursor == nullptr ? nullptr : m_blocks[m_current].data.get() + m_blocks[m_current].size;
+  m_usedBytes = mark.usedBytes;
+}
+
+size_t
+Arena::getCapacity() const
+{
+  size_t capacity = 0;
+  for (const auto& block : m_blocks) {
+    capacity += block.size;
+  }
+  return capacity;
+}
+
+void
+Arena::addBlock(size_t size)
+{
+  // Not value-initialized: the memory is always written before being read
+  m_blocks.push_back(Block{std::unique_ptr<std::byte[]>(new std::byte[size]), size});
+  m_current = m_blocks.size() - 1;
+  m_cursor = m_blocks.back().data.get();
+  m_end = m_cursor + size;
+}
+
+bool
+Arena::useNextBlock()
+{
+  size_t next = m_cursor == nullptr ? 0 : m_current + 1;
+  if (next >= m_blocks.size()) {
+    return false;
+  }
+  m_current = next;
+  m_cursor = m_blocks[next].data.get();
+  m_end = m_cursor + m_blocks[next].size;
+  return true;
+}
+
+} // namespace nlsr::util
@@ -0,0 +1,224 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_UTILITY_ARENA_HPP
+#define NLSR_UTILITY_ARENA_HPP
+
+#include "common.hpp"
+
+#include <boost/noncopyable.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace nlsr::util {
+
+/*! \brief A monotonic arena for the transient objects of one computation.
+ *
+ * Allocation bumps a pointer within the current block and deallocation does nothing,
+ * so that the whole working set of a computation is released at once by reset().
+ * reset() keeps the memory, merged into a single block, for the next computation:
+ * once the arena has grown to the size of the working set, computations no longer
+ * call the global allocator for the objects placed in it.
+ */
+class Arena : boost::noncopyable
+{
+public:
+  explicit
+  Arena(size_t initialBlockSize = 64 * 1024);
+
+  void*
+  allocate(size_t size, size_t alignment);
+
+  /*! \brief Releases every object allocated so far.
+   *
+   * Objects must not be used afterwards; they are not destroyed, so only objects whose
+   * storage is all in the arena, or that are destroyed before, may be placed in it.
+   */
+  void
+  reset();
+
+  /*! \brief A position in the arena, see mark() and release().
+   */
+  struct Mark
+  {
+    size_t block;
+    std::byte* cursor;
+    size_t usedBytes;
+  };
+
+  /*! \brief Returns the current position, to which release() can later return.
+   */
+  Mark
+  mark() const
+  {
+    return {m_current, m_cursor, m_usedBytes};
+  }
+
+  /*! \brief Releases every object allocated since \p mark was taken.
+   *
+   * The memory is kept for later allocations, so a computation repeated in a loop
+   * reuses the same storage instead of growing the arena on each iteration.
+   * The same restrictions as for reset() apply to the released objects.
+   */
+  void
+  release(const Mark& mark);
+
+  /*! \brief Returns the number of bytes handed out since the last reset.
+   */
+  size_t
+  getUsedBytes() const
+  {
+    return m_usedBytes;
+  }
+
+  /*! \brief Returns the total size of the blocks held by the arena.
+   */
+  size_t
+  getCapacity() const;
+
+private:
+  void
+  addBlock(size_t size);
+
+  /*! \brief Moves the cursor to the start of the block after the current one.
+   * \return false if there is no such block
+   */
+  bool
+  useNextBlock();
+
+private:
+  struct Block
+  {
+    std::unique_ptr<std::byte[]> data;
+    size_t size;
+  };
+
+  std::vector<Block> m_blocks;
+  /// Index of the block that m_cursor points into
+  size_t m_current = 0;
+  size_t m_nextBlockSize;
+  std::byte* m_cursor = nullptr;
+  std::byte* m_end = nullptr;
+  size_t m_usedBytes = 0;
+};
+
+/*! \brief A standard allocator that takes its memory from an Arena.
+ *
+ * It converts implicitly from an Arena, so that containers can be constructed directly
+ * from the arena that holds them.
+ */
+template<typename T>
+class ArenaAllocator
+{
+public:
+  using value_type = T;
+
+  ArenaAllocator(Arena& arena) noexcept
+    : m_arena(&arena)
+  {
+  }
+
+  template<typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+    : m_arena(other.getArena())
+  {
+  }
+
+  T*
+  allocate(size_t n)
+  {
+    if (n > static_cast<size_t>(-1) / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void
+  deallocate(T*, size_t) noexcept
+  {
+  }
+
+  Arena*
+  getArena() const noexcept
+  {
+    return m_arena;
+  }
+
+private: // non-member operators
+  // NOTE: the following "hidden friend" operators are available via
+  //       argument-dependent lookup only and must be defined inline.
+
+  template<typename U>
+  friend bool
+  operator==(const ArenaAllocator& lhs, const ArenaAllocator<U>& rhs) noexcept
+  {
+    return lhs.m_arena == rhs.getArena();
+  }
+
+  template<typename U>
+  friend bool
+  operator!=(const ArenaAllocator& lhs, const ArenaAllocator<U>& rhs) noexcept
+  {
+    return lhs.m_arena != rhs.getArena();
+  }
+
+private:
+  Arena* m_arena;
+};
+
+/*! \brief Releases the objects allocated in an Arena during its lifetime.
+ *
+ * Declare it before the objects placed in the arena, so that they are destroyed first.
+ */
+class ArenaScope : boost::noncopyable
+{
+public:
+  explicit
+  ArenaScope(Arena& arena)
+    : m_arena(arena)
+    , m_mark(arena.mark())
+  {
+  }
+
+  ~ArenaScope()
+  {
+    m_arena.release(m_mark);
+  }
+
+private:
+  Arena& m_arena;
+  Arena::Mark m_mark;
+};
+
+template<typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+template<typename K, typename V, typename Compare = std::less<K>>
+using ArenaMap = std::map<K, V, Compare, ArenaAllocator<std::pair<const K, V>>>;
+
+} // namespace nlsr::util
+
+#endif // NLSR_UTILITY_ARENA_HPP
@@ -0,0 +1,93 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "io-worker.hpp"
+#include "logger.hpp"
+
+namespace nlsr::util {
+
+INIT_LOGGER(util.IoWorker);
+
+IoWorker::IoWorker()
+  : m_thread([this] { run(); })
+{
+}
+
+IoWorker::~IoWorker()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_shouldStop = true;
+  }
+  m_hasWork.notify_one();
+  m_thread.join();
+}
+
+void
+IoWorker::post(Task task)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tasks.push_back(std::move(task));
+  }
+  m_hasWork.notify_one();
+}
+
+void
+IoWorker::flush()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_isIdle.wait(lock, [this] { return m_tasks.empty() && !m_isBusy; });
+}
+
+void
+IoWorker::run()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    m_hasWork.wait(lock, [this] { return !m_tasks.empty() || m_shouldStop; });
+    if (m_tasks.empty()) {
+      return;
+    }
+
+    auto tasks = std::move(m_tasks);
+    m_tasks.clear();
+    m_isBusy = true;
+    lock.unlock();
+
+    for (const auto& task : tasks) {
+      try {
+        task();
+      }
+      catch (const std::exception& e) {
+        NLSR_LOG_ERROR("I/O task failed: " << e.what());
+      }
+    }
+
+    lock.lock();
+    m_isBusy = false;
+    if (m_tasks.empty()) {
+      m_isIdle.notify_all();
+    }
+  }
+}
+
+} // namespace nlsr::util
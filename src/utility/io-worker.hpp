@@ -0,0 +1,74 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NLSR_UTILITY_IO_WORKER_HPP
+#define NLSR_UTILITY_IO_WORKER_HPP
+
+#include "common.hpp"
+
+#include <boost/noncopyable.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace nlsr::util {
+
+/*! \brief Runs blocking file I/O on a dedicated thread, in submission order.
+ *
+ * Tasks must not touch state owned by the event loop; they should capture
+ * everything they need by value. Pending tasks are completed on destruction.
+ */
+class IoWorker : boost::noncopyable
+{
+public:
+  using Task = std::function<void()>;
+
+  IoWorker();
+
+  ~IoWorker();
+
+  void
+  post(Task task);
+
+  /*! \brief Blocks until every task posted so far has completed.
+   */
+  void
+  flush();
+
+private:
+  void
+  run();
+
+private:
+  std::mutex m_mutex;
+  std::condition_variable m_hasWork;
+  std::condition_variable m_isIdle;
+  std::deque<Task> m_tasks;
+  bool m_isBusy = false;
+  bool m_shouldStop = false;
+  std::thread m_thread;
+};
+
+} // namespace nlsr::util
+
+#endif // NLSR_UTILITY_IO_WORKER_HPP
@@ -20,6 +20,7 @@
  */
 
 #include "communication/sync-logic-handler.hpp"
+#include "area.hpp"
 #include "nlsr.hpp"
 
 #include "tests/io-key-chain-fixture.hpp"
@@ -245,6 +246,23 @@ BOOST_AUTO_TEST_CASE(UpdatePrefix)
                     ndn::Name(opts.userPrefix).append(boost::lexical_cast<std::string>(Lsa::Type::COORDINATE)));
 }
 
+BOOST_AUTO_TEST_CASE(AreaMembership)
+{
+  opts.areas = {"0", "1"};
+  ndn::Name origin("/ndn/site/%C1.Router/other-router");
+  auto summaryOrigin = area::makeSummaryOrigin(origin, "2");
+
+  getSync().processUpdate("1", makeLsaUserPrefix(otherRouter, Lsa::Type::NAME), 1, 0);
+  getSync().processUpdate("0", makeLsaUserPrefix(ndn::Name(otherRouter)
+                                                   .append(area::SUMMARY_COMPONENT).append("2"),
+                                                 Lsa::Type::NAME), 1, 0);
+
+  BOOST_CHECK(getSync().isInArea(origin, "1"));
+  BOOST_CHECK(!getSync().isInArea(origin, "0"));
+  BOOST_CHECK(getSync().isInArea(summaryOrigin, "0"));
+  BOOST_CHECK(!getSync().isInArea(summaryOrigin, "1"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
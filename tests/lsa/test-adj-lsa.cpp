@@ -71,6 +71,18 @@ const uint8_t ADJ_LSA_DIFF_TS[] = {
   0x8C, 0x08, 0x40, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
+const uint8_t ADJ_LSA_COMPACT[] = {
+  0x83, 0x77, 0x80, 0x2D, 0x07, 0x13, 0x08, 0x03, 0x6E, 0x64, 0x6E, 0x08, 0x04, 0x73, 0x69,
+  0x74, 0x65, 0x08, 0x06, 0x72, 0x6F, 0x75, 0x74, 0x65, 0x72, 0x82, 0x01, 0x0C, 0x8B, 0x13,
+  0x32, 0x30, 0x32, 0x30, 0x2D, 0x30, 0x33, 0x2D, 0x32, 0x36, 0x20, 0x30, 0x34, 0x3A, 0x31,
+  0x33, 0x3A, 0x33, 0x34, 0x99, 0x01, 0x01, 0x9B, 0x22, 0x07, 0x16, 0x08, 0x03, 0x6E, 0x64,
+  0x6E, 0x08, 0x04, 0x73, 0x69, 0x74, 0x65, 0x08, 0x09, 0x61, 0x64, 0x6A, 0x61, 0x63, 0x65,
+  0x6E, 0x63, 0x79, 0x8C, 0x08, 0x40, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9B, 0x1F,
+  0x9C, 0x01, 0x01, 0x07, 0x10, 0x08, 0x03, 0x65, 0x64, 0x75, 0x08, 0x09, 0x61, 0x64, 0x6A,
+  0x61, 0x63, 0x65, 0x6E, 0x63, 0x79, 0x8C, 0x08, 0x40, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00
+};
+
 BOOST_AUTO_TEST_CASE(Basic)
 {
   ndn::Name routerName("/ndn/site/router");
@@ -182,6 +194,85 @@ BOOST_AUTO_TEST_CASE(InitializeFromContent)
   BOOST_CHECK_EQUAL(adjlsa1, adjlsa2);
 }
 
+BOOST_AUTO_TEST_CASE(CompactEncoding)
+{
+  Adjacent adj1("/ndn/site/adjacency", ndn::FaceUri("udp4://10.0.0.1:6363"), 10,
+                Adjacent::STATUS_ACTIVE, 0, 0);
+  Adjacent adj2("/ndn/edu/adjacency", ndn::FaceUri("udp4://10.0.0.2:6363"), 10,
+                Adjacent::STATUS_ACTIVE, 0, 0);
+  AdjacencyList adjList;
+  adjList.insert(adj1);
+  adjList.insert(adj2);
+  auto testTimePoint = ndn::time::fromUnixTimestamp(ndn::time::milliseconds(1585196014943));
+
+  AdjLsa alsa("/ndn/site/router", 12, testTimePoint, adjList);
+  size_t fullSize = alsa.wireEncode().size();
+  alsa.setEncoding(Lsa::Encoding::COMPACT);
+  auto wire = alsa.wireEncode();
+  BOOST_TEST(wire == ADJ_LSA_COMPACT, boost::test_tools::per_element());
+  BOOST_CHECK_LT(wire.size(), fullSize);
+
+  // FaceUris are not carried, everything else used by the routing calculation is
+  AdjLsa decoded(wire);
+  BOOST_CHECK_EQUAL(decoded.getEncoding(), Lsa::Encoding::COMPACT);
+  BOOST_REQUIRE_EQUAL(decoded.getAdl().size(), 2);
+  const auto& adjacent = decoded.getAdl().getAdjList().back();
+  BOOST_CHECK_EQUAL(adjacent.getName(), "/ndn/edu/adjacency");
+  BOOST_CHECK_EQUAL(adjacent.getFaceUri(), ndn::FaceUri());
+  BOOST_CHECK_EQUAL(adjacent.getLinkCost(), 10);
+  BOOST_CHECK_EQUAL(decoded.wireEncode(), wire);
+
+  // topology costs survive the compact encoding
+  adj2.setTopologyCost("latency", 25);
+  AdjacencyList topologyList;
+  topologyList.insert(adj2);
+  AdjLsa topologyLsa("/ndn/site/router", 13, testTimePoint, topologyList);
+  topologyLsa.setEncoding(Lsa::Encoding::COMPACT);
+  AdjLsa decodedTopology(topologyLsa.wireEncode());
+  BOOST_CHECK_EQUAL(decodedTopology.getAdl().getAdjList().front().getTopologyCost("latency"), 25);
+
+  // an LSA without LsaEncoding is in the full encoding
+  AdjLsa legacy{ndn::Block(ADJ_LSA1)};
+  BOOST_CHECK_EQUAL(legacy.getEncoding(), Lsa::Encoding::FULL);
+  BOOST_CHECK_EQUAL(legacy.getAdl().size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(NoTransit)
+{
+  Adjacent adj1("/ndn/site/adjacency", ndn::FaceUri("udp4://10.0.0.1:6363"), 10,
+                Adjacent::STATUS_ACTIVE, 0, 0);
+  AdjacencyList adjList;
+  adjList.insert(adj1);
+  auto testTimePoint = ndn::time::fromUnixTimestamp(ndn::time::milliseconds(1585196014943));
+
+  AdjLsa alsa("/ndn/site/router", 12, testTimePoint, adjList);
+  BOOST_CHECK(!alsa.isNoTransit());
+  size_t transitSize = alsa.wireEncode().size();
+
+  alsa.setNoTransit(true);
+  auto wire = alsa.wireEncode();
+  BOOST_CHECK_EQUAL(wire.size(), transitSize + 2);
+  wire.parse();
+  BOOST_REQUIRE_EQUAL(wire.elements_size(), 3);
+  BOOST_CHECK_EQUAL(wire.elements()[1].type(), nlsr::tlv::NoTransit);
+
+  AdjLsa decoded(wire);
+  BOOST_CHECK(decoded.isNoTransit());
+  BOOST_CHECK_EQUAL(decoded.getAdl().size(), 1);
+
+  // both encodings carry the flag
+  alsa.setEncoding(Lsa::Encoding::COMPACT);
+  BOOST_CHECK(AdjLsa(alsa.wireEncode()).isNoTransit());
+
+  // a change of the flag alone is an update
+  auto transit = std::make_shared<AdjLsa>("/ndn/site/router", 13, testTimePoint, adjList);
+  BOOST_CHECK(std::get<0>(decoded.update(transit)));
+  BOOST_CHECK(!decoded.isNoTransit());
+
+  AdjLsa legacy{ndn::Block(ADJ_LSA1)};
+  BOOST_CHECK(!legacy.isNoTransit());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
@@ -117,6 +117,23 @@ const uint8_t NAME_LSA_DIFF_COST[] = {
   0x8C, 0x08, 0x40, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // cost (10)
 };
 
+const uint8_t NAME_LSA_COMPACT[] = {
+  0x89, 0x57, //name lsa
+  0x80, 0x23, // lsa
+  0x07, 0x09, 0x08, 0x07, 0x72, 0x6F, 0x75, 0x74, 0x65, 0x72, 0x31, // router name (router1)
+  0x82, 0x01, 0x0C, // sequence number (12)
+  0x8B, 0x13, 0x32, 0x30, 0x32, 0x30, 0x2D, 0x30, 0x33, 0x2D, 0x32, 0x36, 0x20, 0x30, 0x34,
+  0x3A, 0x31, 0x33, 0x3A, 0x33, 0x34, // expiration time
+  0x99, 0x01, 0x01, // lsa encoding (compact)
+  0x9A, 0x15, // compact prefix info, cost (0) omitted
+  0x07, 0x13, 0x08, 0x03, 0x6E, 0x64, 0x6E, 0x08, 0x05, 0x76, 0x69, 0x64, 0x65, 0x6F,
+  0x08, 0x05, 0x6E, 0x61, 0x6D, 0x65, 0x31, // name (/ndn/video/name1)
+  0x9A, 0x16, // compact prefix info
+  0x9C, 0x01, 0x02, // shared components (2)
+  0x07, 0x07, 0x08, 0x05, 0x6E, 0x61, 0x6D, 0x65, 0x32, // name suffix (name2)
+  0x8C, 0x08, 0x40, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // cost (10)
+};
+
 BOOST_AUTO_TEST_CASE(Basic)
 {
   ndn::Name s1{"name1"};
@@ -167,6 +184,41 @@ BOOST_AUTO_TEST_CASE(InitializeFromContent)
   BOOST_CHECK_EQUAL(nlsa1.wireEncode(), nlsa2.wireEncode());
 }
 
+BOOST_AUTO_TEST_CASE(CompactEncoding)
+{
+  NamePrefixList npl;
+  npl.insert("/ndn/video/name1", "", 0);
+  npl.insert("/ndn/video/name2", "", 10);
+  auto testTimePoint = ndn::time::fromUnixTimestamp(ndn::time::milliseconds(1585196014943));
+
+  NameLsa full("router1", 12, testTimePoint, npl);
+  BOOST_CHECK_EQUAL(full.getEncoding(), Lsa::Encoding::FULL);
+  size_t fullSize = full.wireEncode().size();
+
+  NameLsa compact(full);
+  compact.setEncoding(Lsa::Encoding::COMPACT);
+  auto wire = compact.wireEncode();
+  BOOST_TEST(wire == NAME_LSA_COMPACT, boost::test_tools::per_element());
+  BOOST_CHECK_LT(wire.size(), fullSize);
+
+  NameLsa decoded(wire);
+  BOOST_CHECK_EQUAL(decoded.getEncoding(), Lsa::Encoding::COMPACT);
+  BOOST_CHECK_EQUAL(decoded.getOriginRouter(), full.getOriginRouter());
+  BOOST_CHECK_EQUAL(decoded.getSeqNo(), 12);
+  BOOST_CHECK_EQUAL(decoded, full);
+  BOOST_CHECK_EQUAL(decoded.wireEncode(), wire);
+
+  // an LSA without LsaEncoding is in the full encoding
+  NameLsa legacy{ndn::Block(NAME_LSA1)};
+  BOOST_CHECK_EQUAL(legacy.getEncoding(), Lsa::Encoding::FULL);
+  BOOST_CHECK_EQUAL(legacy.getNpl().size(), 2);
+
+  // shared components must not exceed the previous name
+  auto malformed = ndn::Buffer(wire.begin(), wire.end());
+  malformed[2 + 2 + 0x23 + 3 + 2 + 0x15 + 4] = 0x04;
+  BOOST_CHECK_THROW(NameLsa{ndn::Block(malformed)}, Lsa::Error);
+}
+
 BOOST_AUTO_TEST_CASE(OperatorEquals)
 {
   PrefixInfo name1 = PrefixInfo(ndn::Name("/ndn/test/name1"), 0);
@@ -233,6 +285,27 @@ BOOST_AUTO_TEST_CASE(Update)
   BOOST_CHECK(it != namesToAdd.end());
 }
 
+BOOST_AUTO_TEST_CASE(UpdateCost)
+{
+  NameLsa knownNameLsa(ndn::Name("/ndn/site/%C1.Router/abr/%C1.Summary/1"), 1,
+                       ndn::time::system_clock::now() + 3600_ms,
+                       NamePrefixList{ndn::Name("/a"), ndn::Name("/b")});
+
+  NamePrefixList npl;
+  npl.insert("/a", "", 0);
+  npl.insert("/b", "", 15);
+  auto rcvdLsa = std::make_shared<NameLsa>(knownNameLsa.getOriginRouter(), 2,
+                                           ndn::time::system_clock::now() + 3600_ms, npl);
+
+  auto [updated, namesToAdd, namesToRemove] = knownNameLsa.update(rcvdLsa);
+
+  BOOST_CHECK_EQUAL(updated, true);
+  BOOST_REQUIRE_EQUAL(namesToAdd.size(), 1);
+  BOOST_CHECK_EQUAL(namesToAdd.front(), PrefixInfo(ndn::Name("/b"), 15));
+  BOOST_CHECK_EQUAL(namesToRemove.size(), 0);
+  BOOST_CHECK_EQUAL(knownNameLsa.getNpl(), npl);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
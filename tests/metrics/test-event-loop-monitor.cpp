@@ -0,0 +1,90 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "metrics/event-loop-monitor.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/io-fixture.hpp"
+
+namespace nlsr::tests {
+
+using namespace nlsr::metrics;
+
+BOOST_FIXTURE_TEST_SUITE(TestEventLoopMonitor, IoFixture)
+
+BOOST_AUTO_TEST_CASE(NestedScopes)
+{
+  auto& registry = Registry::get();
+  auto& lsdbWall = registry.addHistogram("nlsr_handler_wall_seconds", "", "tag=\"lsdb\"");
+  auto& nptWall = registry.addHistogram("nlsr_handler_wall_seconds", "", "tag=\"name-prefix-table\"");
+  auto& lsdbSlow = registry.addCounter("nlsr_slow_handlers_total", "", "tag=\"lsdb\"");
+  auto& nptSlow = registry.addCounter("nlsr_slow_handlers_total", "", "tag=\"name-prefix-table\"");
+
+  uint64_t lsdbSumBefore = lsdbWall.getSum();
+  uint64_t nptSumBefore = nptWall.getSum();
+  uint64_t lsdbSlowBefore = lsdbSlow.get();
+  uint64_t nptSlowBefore = nptSlow.get();
+
+  HandlerScope::setSlowThreshold(50_ms);
+  {
+    HandlerScope outer(HandlerTag::LSDB, "outer");
+    advanceClocks(30_ms);
+    {
+      HandlerScope inner(HandlerTag::NAME_PREFIX_TABLE, "inner");
+      advanceClocks(40_ms);
+    }
+  }
+
+  // nested time is attributed to the inner tag only
+  BOOST_CHECK_EQUAL(lsdbWall.getSum() - lsdbSumBefore, 30000);
+  BOOST_CHECK_EQUAL(nptWall.getSum() - nptSumBefore, 40000);
+
+  // the slow-handler threshold applies to the time including nested handlers
+  BOOST_CHECK_EQUAL(lsdbSlow.get() - lsdbSlowBefore, 1);
+  BOOST_CHECK_EQUAL(nptSlow.get() - nptSlowBefore, 0);
+}
+
+BOOST_AUTO_TEST_CASE(HeartbeatLag)
+{
+  auto& lag = Registry::get().addHistogram("nlsr_event_loop_lag_seconds", "");
+  EventLoopMonitor monitor(m_io, 100_ms, 50_ms);
+
+  uint64_t countBefore = lag.getCount();
+  uint64_t sumBefore = lag.getSum();
+
+  // the heartbeat is due after 100ms, but the loop only gets to run it after 300ms
+  advanceClocks(300_ms);
+  BOOST_CHECK_EQUAL(lag.getCount() - countBefore, 1);
+  BOOST_CHECK_EQUAL(lag.getSum() - sumBefore, 200000);
+
+  advanceClocks(10_ms, 100_ms);
+  BOOST_CHECK_EQUAL(lag.getCount() - countBefore, 2);
+  BOOST_CHECK_EQUAL(lag.getSum() - sumBefore, 200000);
+  BOOST_CHECK_EQUAL(monitor.getLag(), 0_ns);
+
+  // a handler running 150ms past the next heartbeat delays it by 50ms
+  m_steadyClock->advance(150_ms);
+  BOOST_CHECK_EQUAL(monitor.getLag(), 50_ms);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nlsr::tests
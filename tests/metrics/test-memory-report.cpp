@@ -0,0 +1,107 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "metrics/memory-report.hpp"
+#include "route/nexthop-list.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace nlsr::tests {
+
+using namespace nlsr::metrics;
+
+BOOST_AUTO_TEST_SUITE(TestMemoryReport)
+
+BOOST_AUTO_TEST_CASE(Accumulate)
+{
+  MemoryReport report;
+  BOOST_CHECK(report.find("lsdb") == nullptr);
+
+  report.add("lsdb", 2, 100);
+  report.add("fib", 1, 50);
+  report.add("lsdb", 3, 20);
+
+  BOOST_REQUIRE_EQUAL(report.getEntries().size(), 2);
+  const auto* lsdb = report.find("lsdb");
+  BOOST_REQUIRE(lsdb != nullptr);
+  BOOST_CHECK_EQUAL(lsdb->objects, 5);
+  BOOST_CHECK_EQUAL(lsdb->bytes, 120);
+  BOOST_CHECK_EQUAL(report.getTotalBytes(), 170);
+
+  std::ostringstream os;
+  os << report;
+  BOOST_CHECK(os.str().find("lsdb") != std::string::npos);
+  BOOST_CHECK(os.str().find("total") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(Estimates)
+{
+  ndn::Name name("/ndn/site/router");
+  BOOST_CHECK_GE(MemoryReport::estimateName(name), name.wireEncode().size());
+  BOOST_CHECK_GT(MemoryReport::estimateName(name), MemoryReport::estimateName("/ndn"));
+
+  BOOST_CHECK_EQUAL(MemoryReport::estimateString("short"), 0);
+  BOOST_CHECK_GE(MemoryReport::estimateString(std::string(100, 'x')), 100);
+
+  BOOST_CHECK_EQUAL(MemoryReport::estimateFaceUri(ndn::FaceUri("udp4://10.0.0.1:6363")), 0);
+  BOOST_CHECK_GE(MemoryReport::estimateFaceUri(ndn::FaceUri("tcp4://" + std::string(40, 'h') + ".example:6363")), 40);
+
+  NexthopList nexthops;
+  BOOST_CHECK_EQUAL(MemoryReport::estimateNexthops(nexthops), 0);
+  nexthops.addNextHop(NextHop(ndn::FaceUri("udp4://10.0.0.1:6363"), 10));
+  nexthops.addNextHop(NextHop(ndn::FaceUri("udp4://10.0.0.2:6363"), 20));
+  // short lists are stored inline
+  BOOST_CHECK_EQUAL(MemoryReport::estimateNexthops(nexthops), 0);
+  for (int i = 3; i <= 6; ++i) {
+    nexthops.addNextHop(NextHop(ndn::FaceUri("udp4://10.0.0." + std::to_string(i) + ":6363"), 10 * i));
+  }
+  BOOST_CHECK_GE(MemoryReport::estimateNexthops(nexthops), 6 * sizeof(NextHop));
+}
+
+BOOST_AUTO_TEST_CASE(PublishThroughCollector)
+{
+  auto& registry = Registry::get();
+  int nCalls = 0;
+  {
+    ScopedCollector collector(registry, [&] {
+      ++nCalls;
+      MemoryReport report;
+      report.add("test-subsystem", 7, 4096);
+      report.publish(registry);
+    });
+
+    std::ostringstream os;
+    registry.writePrometheus(os);
+    BOOST_CHECK_EQUAL(nCalls, 1);
+    BOOST_CHECK(os.str().find("nlsr_memory_bytes{subsystem=\"test-subsystem\"} 4096\n")
+                != std::string::npos);
+    BOOST_CHECK(os.str().find("nlsr_memory_objects{subsystem=\"test-subsystem\"} 7\n")
+                != std::string::npos);
+  }
+
+  std::ostringstream os;
+  registry.writePrometheus(os);
+  BOOST_CHECK_EQUAL(nCalls, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nlsr::tests
@@ -0,0 +1,164 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "metrics/metrics-registry.hpp"
+#include "metrics/metrics-exporter.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/clock-fixture.hpp"
+
+#include <boost/algorithm/string/predicate.hpp>
+
+namespace nlsr::tests {
+
+using namespace nlsr::metrics;
+
+BOOST_AUTO_TEST_SUITE(TestMetricsRegistry)
+
+BOOST_AUTO_TEST_CASE(HistogramBuckets)
+{
+  for (size_t i = 0; i < Histogram::BUCKET_COUNT; ++i) {
+    BOOST_CHECK_EQUAL(Histogram::getBucketIndex(Histogram::getBucketUpperBound(i)), i);
+  }
+  for (size_t i = 0; i + 1 < Histogram::BUCKET_COUNT; ++i) {
+    BOOST_CHECK_EQUAL(Histogram::getBucketIndex(Histogram::getBucketUpperBound(i) + 1), i + 1);
+  }
+
+  BOOST_CHECK_EQUAL(Histogram::getBucketIndex(0), 0);
+  BOOST_CHECK_EQUAL(Histogram::getBucketIndex(1), 0);
+  BOOST_CHECK_EQUAL(Histogram::getBucketIndex(8), 7);
+  BOOST_CHECK_EQUAL(Histogram::getBucketIndex(9), 8);
+  BOOST_CHECK_EQUAL(Histogram::getBucketIndex(16), 15);
+  BOOST_CHECK_EQUAL(Histogram::getBucketIndex(17), 16);
+  BOOST_CHECK_EQUAL(Histogram::getBucketIndex(18), 16);
+  BOOST_CHECK_EQUAL(Histogram::getBucketIndex(UINT64_MAX), Histogram::BUCKET_COUNT - 1);
+}
+
+BOOST_AUTO_TEST_CASE(HistogramQuantiles)
+{
+  Histogram histogram;
+  BOOST_CHECK_EQUAL(histogram.getQuantile(0.5), 0);
+
+  for (uint64_t i = 1; i <= 1000; ++i) {
+    histogram.record(i);
+  }
+  BOOST_CHECK_EQUAL(histogram.getCount(), 1000);
+  BOOST_CHECK_EQUAL(histogram.getSum(), 500500);
+  BOOST_CHECK_EQUAL(histogram.getCountAtMost(256), 256);
+
+  // quantiles are reported as bucket upper bounds, within 12.5% of the true value
+  auto p50 = histogram.getQuantile(0.5);
+  BOOST_CHECK_GE(p50, 500);
+  BOOST_CHECK_LE(p50, 500 * 1.125);
+  auto p99 = histogram.getQuantile(0.99);
+  BOOST_CHECK_GE(p99, 990);
+  BOOST_CHECK_LE(p99, 990 * 1.125);
+
+  histogram.record(ndn::time::milliseconds(3));
+  BOOST_CHECK_EQUAL(histogram.getSum(), 503500);
+}
+
+BOOST_FIXTURE_TEST_CASE(Timer, ClockFixture)
+{
+  Histogram histogram;
+  {
+    ScopedTimer timer(histogram);
+    advanceClocks(10_ms);
+  }
+  BOOST_CHECK_EQUAL(histogram.getCount(), 1);
+  BOOST_CHECK_EQUAL(histogram.getSum(), 10000);
+}
+
+BOOST_AUTO_TEST_CASE(Registration)
+{
+  auto& registry = Registry::get();
+
+  auto& counter = registry.addCounter("nlsr_test_events_total", "Test events", "kind=\"a\"");
+  BOOST_CHECK_EQUAL(&registry.addCounter("nlsr_test_events_total", "Test events", "kind=\"a\""),
+                    &counter);
+  BOOST_CHECK_NE(&registry.addCounter("nlsr_test_events_total", "Test events", "kind=\"b\""),
+                 &counter);
+  BOOST_CHECK_THROW(registry.addGauge("nlsr_test_events_total", "Test events"), Registry::Error);
+}
+
+BOOST_AUTO_TEST_CASE(PrometheusFormat)
+{
+  auto& registry = Registry::get();
+  auto& counter = registry.addCounter("nlsr_test_format_total", "Counter help");
+  auto& gauge = registry.addGauge("nlsr_test_format_size", "Gauge help", "table=\"x\"");
+  auto& histogram = registry.addHistogram("nlsr_test_format_seconds", "Histogram help");
+
+  uint64_t counterBefore = counter.get();
+  counter.increment(3);
+  gauge.set(-5);
+  histogram.record(ndn::time::microseconds(20));
+  histogram.record(ndn::time::milliseconds(2));
+
+  std::ostringstream os;
+  registry.writePrometheus(os);
+  std::string text = os.str();
+
+  BOOST_CHECK(text.find("# HELP nlsr_test_format_total Counter help\n"
+                        "# TYPE nlsr_test_format_total counter\n"
+                        "nlsr_test_format_total " + std::to_string(counterBefore + 3) + "\n")
+              != std::string::npos);
+  BOOST_CHECK(text.find("# TYPE nlsr_test_format_size gauge\n"
+                        "nlsr_test_format_size{table=\"x\"} -5\n") != std::string::npos);
+  BOOST_CHECK(text.find("nlsr_test_format_seconds_bucket{le=\"1.6e-05\"} 0\n") != std::string::npos);
+  BOOST_CHECK(text.find("nlsr_test_format_seconds_bucket{le=\"3.2e-05\"} 1\n") != std::string::npos);
+  BOOST_CHECK(text.find("nlsr_test_format_seconds_bucket{le=\"0.004096\"} 2\n") != std::string::npos);
+  BOOST_CHECK(text.find("nlsr_test_format_seconds_bucket{le=\"+Inf\"} 2\n") != std::string::npos);
+  BOOST_CHECK(text.find("nlsr_test_format_seconds_sum 0.00202\n") != std::string::npos);
+  BOOST_CHECK(text.find("nlsr_test_format_seconds_count 2\n") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(PrometheusBucketBoundary)
+{
+  auto& registry = Registry::get();
+  auto& histogram = registry.addHistogram("nlsr_test_le_seconds", "Boundary help");
+
+  // le is "less than or equal", so a value on a bound belongs to that bucket
+  histogram.record(ndn::time::microseconds(16));
+  histogram.record(ndn::time::microseconds(17));
+  histogram.record(ndn::time::microseconds(32));
+  BOOST_CHECK_EQUAL(histogram.getCountAtMost(16), 1);
+  BOOST_CHECK_EQUAL(histogram.getCountAtMost(32), 3);
+
+  std::ostringstream os;
+  registry.writePrometheus(os);
+  std::string text = os.str();
+
+  BOOST_CHECK(text.find("nlsr_test_le_seconds_bucket{le=\"1.6e-05\"} 1\n") != std::string::npos);
+  BOOST_CHECK(text.find("nlsr_test_le_seconds_bucket{le=\"3.2e-05\"} 3\n") != std::string::npos);
+  BOOST_CHECK(text.find("nlsr_test_le_seconds_bucket{le=\"6.4e-05\"} 3\n") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(HttpResponse)
+{
+  auto response = MetricsExporter::makeHttpResponse("abc\n");
+  BOOST_CHECK(boost::starts_with(response, "HTTP/1.0 200 OK\r\n"));
+  BOOST_CHECK(response.find("Content-Length: 4\r\n") != std::string::npos);
+  BOOST_CHECK(boost::ends_with(response, "\r\n\r\nabc\n"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nlsr::tests
@@ -0,0 +1,61 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "metrics/startup-timeline.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/clock-fixture.hpp"
+
+namespace nlsr::tests {
+
+using namespace nlsr::metrics;
+
+BOOST_FIXTURE_TEST_SUITE(TestStartupTimeline, ClockFixture)
+
+BOOST_AUTO_TEST_CASE(Milestones)
+{
+  using Milestone = StartupTimeline::Milestone;
+  auto& timeline = StartupTimeline::get();
+  auto& histogram = Registry::get().addHistogram("nlsr_startup_seconds", "",
+                                                 "milestone=\"first_route\"");
+  uint64_t countBefore = histogram.getCount();
+
+  timeline.start();
+  BOOST_CHECK(!timeline.getElapsed(Milestone::FIRST_ROUTE));
+
+  advanceClocks(1500_ms);
+  timeline.mark(Milestone::FIRST_ROUTE);
+  BOOST_CHECK_EQUAL(timeline.getElapsed(Milestone::FIRST_ROUTE).value(), 1500_ms);
+  BOOST_CHECK_EQUAL(histogram.getCount(), countBefore + 1);
+
+  // only the first occurrence after start() is recorded
+  advanceClocks(1_s);
+  timeline.mark(Milestone::FIRST_ROUTE);
+  BOOST_CHECK_EQUAL(timeline.getElapsed(Milestone::FIRST_ROUTE).value(), 1500_ms);
+  BOOST_CHECK_EQUAL(histogram.getCount(), countBefore + 1);
+
+  timeline.start();
+  BOOST_CHECK(!timeline.getElapsed(Milestone::FIRST_ROUTE));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nlsr::tests
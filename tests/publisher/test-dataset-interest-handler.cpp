@@ -20,10 +20,13 @@
  */
 
 #include "publisher/dataset-interest-handler.hpp"
+#include "route/topology-change.hpp"
 #include "tlv-nlsr.hpp"
 
 #include "tests/publisher/publisher-fixture.hpp"
 
+#include <ndn-cxx/mgmt/nfd/control-response.hpp>
+
 namespace nlsr::tests {
 
 BOOST_FIXTURE_TEST_SUITE(TestDatasetInterestHandler, PublisherFixture)
@@ -115,6 +118,26 @@ BOOST_AUTO_TEST_CASE(RouterName)
   processDatasetInterest([] (const auto& block) { return block.type() == nlsr::tlv::RoutingTable; });
 }
 
+BOOST_AUTO_TEST_CASE(WhatIfLocalhostOnly)
+{
+  auto changes = TopologyChange::encodeList({TopologyChange::makeRouterDown("/RouterA")});
+
+  face.receive(ndn::Interest(ndn::Name(Nlsr::LOCALHOST_PREFIX).append("whatif")
+                             .append(ndn::tlv::GenericNameComponent, changes))
+               .setCanBePrefix(true));
+  processDatasetInterest([] (const auto& block) { return block.type() == nlsr::tlv::WhatIf; });
+
+  // the routable prefix of the router does not serve what-if analyses
+  ndn::Name routerName(conf.getRouterPrefix());
+  routerName.append("nlsr").append("whatif").append(ndn::tlv::GenericNameComponent, changes);
+  face.receive(ndn::Interest(routerName).setCanBePrefix(true));
+  advanceClocks(30_ms);
+
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+  ndn::nfd::ControlResponse response(face.sentData[0].getContent().blockFromValue());
+  BOOST_CHECK_EQUAL(response.getCode(), 403);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
@@ -0,0 +1,153 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "route/area-summarizer.hpp"
+
+#include "adjacent.hpp"
+#include "admission-controller.hpp"
+#include "area.hpp"
+
+#include "tests/io-key-chain-fixture.hpp"
+#include "tests/test-common.hpp"
+
+namespace nlsr::tests {
+
+constexpr time::system_clock::time_point MAX_TIME = time::system_clock::time_point::max();
+static const ndn::Name THIS_ROUTER = "/ndn/site/%C1.Router/this-router";
+static const ndn::Name ROUTER_A = "/ndn/site/%C1.Router/a";
+static const ndn::Name ROUTER_B = "/ndn/site/%C1.Router/b";
+
+/**
+ * @brief Area border router attached to the backbone area 0 and to area 1.
+ *
+ *   a --10-- this-router --5-- b
+ *  (area 1)                 (area 0)
+ *
+ * Router b is itself the border router of area 2.
+ */
+class AreaSummarizerFixture : public IoKeyChainFixture
+{
+public:
+  AreaSummarizerFixture()
+  {
+    conf.addArea("0");
+    conf.addArea("1");
+    lsdb = std::make_unique<Lsdb>(face, m_keyChain, conf, stats, admission);
+    summarizer = std::make_unique<AreaSummarizer>(m_scheduler, *lsdb, conf, afterRoutingChange);
+  }
+
+  /**
+   * @brief Simulate a sync update of \p origin received in the group of \p area.
+   */
+  void
+  receiveFromArea(const std::string& area, const ndn::Name& origin)
+  {
+    ndn::Name updateName("/localhop/ndn/nlsr/LSA");
+    updateName.append(origin.getSubName(1));
+    lsdb->getSync().processUpdate(area, makeLsaUserPrefix(updateName, Lsa::Type::NAME), 1, 0);
+  }
+
+  void
+  installAdjLsa(const ndn::Name& origin, const std::vector<std::pair<ndn::Name, double>>& links)
+  {
+    AdjacencyList adjList;
+    for (const auto& [neighbor, cost] : links) {
+      adjList.insert(Adjacent(neighbor, ndn::FaceUri("udp4://10.0.0.1:6363"), cost,
+                              Adjacent::STATUS_ACTIVE, 0, 0));
+    }
+    lsdb->installLsa(std::make_shared<AdjLsa>(origin, 1, MAX_TIME, adjList));
+  }
+
+  void
+  installNameLsa(const ndn::Name& origin, const ndn::Name& name, double cost)
+  {
+    NamePrefixList npl;
+    npl.insert(name, "", cost);
+    lsdb->installLsa(std::make_shared<NameLsa>(origin, 1, MAX_TIME, npl));
+  }
+
+private:
+  ndn::Scheduler m_scheduler{m_io};
+
+public:
+  ndn::DummyClientFace face{m_io, m_keyChain};
+  ConfParameter conf{face, m_keyChain};
+  DummyConfFileProcessor confProcessor{conf};
+  Statistics stats;
+  AdmissionController admission{m_io, conf};
+  AfterRoutingChange afterRoutingChange;
+  std::unique_ptr<Lsdb> lsdb;
+  std::unique_ptr<AreaSummarizer> summarizer;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestAreaSummarizer, AreaSummarizerFixture)
+
+BOOST_AUTO_TEST_CASE(Summarize)
+{
+  receiveFromArea("1", ROUTER_A);
+  receiveFromArea("0", ROUTER_B);
+  receiveFromArea("0", area::makeSummaryOrigin(ROUTER_B, "1"));
+  receiveFromArea("0", area::makeSummaryOrigin(ROUTER_B, "2"));
+
+  installAdjLsa(THIS_ROUTER, {{ROUTER_A, 10}, {ROUTER_B, 5}});
+  installAdjLsa(ROUTER_A, {{THIS_ROUTER, 10}});
+  installAdjLsa(ROUTER_B, {{THIS_ROUTER, 5}});
+
+  installNameLsa(ROUTER_A, "/a/data", 2);
+  installNameLsa(ROUTER_B, "/b/data", 0);
+  installNameLsa(area::makeSummaryOrigin(ROUTER_B, "2"), "/area2/data", 7);
+  // area 1 is summarized from its own routers, not from another border router
+  installNameLsa(area::makeSummaryOrigin(ROUTER_B, "1"), "/stale/data", 1);
+
+  auto area1 = summarizer->summarize("1");
+  BOOST_CHECK_EQUAL(area1.size(), 2);
+  BOOST_CHECK_EQUAL(area1.getPrefixInfoForName(ROUTER_A).getCost(), 10);
+  BOOST_CHECK_EQUAL(area1.getPrefixInfoForName("/a/data").getCost(), 12);
+
+  auto area0 = summarizer->summarize("0");
+  BOOST_CHECK_EQUAL(area0.size(), 3);
+  BOOST_CHECK_EQUAL(area0.getPrefixInfoForName(ROUTER_B).getCost(), 5);
+  BOOST_CHECK_EQUAL(area0.getPrefixInfoForName("/b/data").getCost(), 5);
+  BOOST_CHECK_EQUAL(area0.getPrefixInfoForName("/area2/data").getCost(), 12);
+}
+
+BOOST_AUTO_TEST_CASE(LowestCost)
+{
+  static const ndn::Name ROUTER_C = "/ndn/site/%C1.Router/c";
+  receiveFromArea("1", ROUTER_A);
+  receiveFromArea("1", ROUTER_C);
+
+  installAdjLsa(THIS_ROUTER, {{ROUTER_A, 10}, {ROUTER_C, 3}});
+  installAdjLsa(ROUTER_A, {{THIS_ROUTER, 10}});
+  installAdjLsa(ROUTER_C, {{THIS_ROUTER, 3}});
+
+  installNameLsa(ROUTER_A, "/anycast", 1);
+  installNameLsa(ROUTER_C, "/anycast", 20);
+
+  auto area1 = summarizer->summarize("1");
+  BOOST_CHECK_EQUAL(area1.getPrefixInfoForName("/anycast").getCost(), 11);
+  // routers of other areas are not summarized
+  BOOST_CHECK(summarizer->summarize("0").getPrefixInfo().empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nlsr::tests
@@ -68,6 +68,68 @@ BOOST_AUTO_TEST_CASE(RemoveRoutingTableEntry)
   BOOST_CHECK_EQUAL(count, 0);
 }
 
+BOOST_AUTO_TEST_CASE(BestOrigins)
+{
+  const ndn::FaceUri face1("udp4://10.0.0.1:6363");
+  const ndn::FaceUri face2("udp4://10.0.0.2:6363");
+  const ndn::FaceUri face3("udp4://10.0.0.3:6363");
+  const ndn::FaceUri face4("udp4://10.0.0.4:6363");
+  auto makeOrigin = [] (const ndn::Name& router, std::initializer_list<NextHop> nexthops) {
+    auto rtpe = std::make_shared<RoutingTablePoolEntry>(router, 0);
+    NexthopList list;
+    for (const auto& nh : nexthops) {
+      list.addNextHop(nh);
+    }
+    rtpe->setNexthopList(list);
+    return rtpe;
+  };
+  auto rtpe1 = makeOrigin("/ndn/rtr1", {NextHop(face1, 10), NextHop(face2, 20)});
+  auto rtpe2 = makeOrigin("/ndn/rtr2", {NextHop(face3, 5)});
+  auto rtpe3 = makeOrigin("/ndn/rtr3", {NextHop(face4, 1)});
+  auto rtpe4 = makeOrigin("/ndn/rtr4", {});
+
+  NamePrefixTableEntry npte("/ndn/anycast");
+  npte.addRoutingTableEntry(rtpe1, 0);
+  npte.addRoutingTableEntry(rtpe2, 30);
+  npte.addRoutingTableEntry(rtpe3, 2);
+  npte.addRoutingTableEntry(rtpe4, 0);
+
+  // The cost of the name prefix at each origin is added to the next hops through it
+  npte.generateNhlfromRteList();
+  BOOST_REQUIRE_EQUAL(npte.getNexthopList().size(), 4);
+  auto it = npte.getNexthopList().begin();
+  BOOST_CHECK_EQUAL(it->getConnectingFaceUri(), face4);
+  BOOST_CHECK_EQUAL(it->getRouteCost(), 3);
+  BOOST_CHECK_EQUAL(std::prev(npte.getNexthopList().end())->getConnectingFaceUri(), face3);
+  BOOST_CHECK_EQUAL(std::prev(npte.getNexthopList().end())->getRouteCost(), 35);
+
+  npte.generateNhlfromRteList(2);
+  BOOST_REQUIRE_EQUAL(npte.getNexthopList().size(), 2);
+  it = npte.getNexthopList().begin();
+  BOOST_CHECK_EQUAL(it->getConnectingFaceUri(), face4);
+  BOOST_CHECK_EQUAL((++it)->getConnectingFaceUri(), face1);
+
+  // Adding an origin again ranks it by its current next hops and cost
+  rtpe2->setNexthopList({});
+  rtpe2->getNexthopList().addNextHop(NextHop(face3, 4));
+  npte.addRoutingTableEntry(rtpe2, 0);
+  BOOST_CHECK_EQUAL(npte.m_rteList.size(), 4);
+  BOOST_CHECK_EQUAL(rtpe2->getUseCount(), 1);
+  npte.generateNhlfromRteList(2);
+  BOOST_REQUIRE_EQUAL(npte.getNexthopList().size(), 2);
+  it = npte.getNexthopList().begin();
+  BOOST_CHECK_EQUAL(it->getConnectingFaceUri(), face4);
+  BOOST_CHECK_EQUAL((++it)->getConnectingFaceUri(), face3);
+  BOOST_CHECK_EQUAL(it->getRouteCost(), 4);
+
+  npte.removeRoutingTableEntry(rtpe3);
+  npte.generateNhlfromRteList(2);
+  BOOST_REQUIRE_EQUAL(npte.getNexthopList().size(), 2);
+  it = npte.getNexthopList().begin();
+  BOOST_CHECK_EQUAL(it->getConnectingFaceUri(), face3);
+  BOOST_CHECK_EQUAL((++it)->getConnectingFaceUri(), face1);
+}
+
 BOOST_AUTO_TEST_CASE(EqualsOperatorTwoObj)
 {
   NamePrefixTableEntry npte1("/ndn/memphis/rtr1");
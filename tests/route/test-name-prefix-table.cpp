@@ -23,6 +23,7 @@
 #include "name-prefix-list.hpp"
 #include "route/fib.hpp"
 #include "route/routing-table.hpp"
+#include "admission-controller.hpp"
 #include "lsdb.hpp"
 
 #include "tests/io-key-chain-fixture.hpp"
@@ -34,7 +35,8 @@ class NamePrefixTableFixture : public IoKeyChainFixture
 {
 public:
   NamePrefixTableFixture()
-    : lsdb(face, m_keyChain, conf)
+    : admission(m_io, conf)
+    , lsdb(face, m_keyChain, conf, stats, admission)
     , fib(face, m_scheduler, conf.getAdjacencyList(), conf, m_keyChain)
     , rt(m_scheduler, lsdb, conf)
     , npt(conf.getRouterPrefix(), fib, rt, rt.afterRoutingChange, lsdb.onLsdbModified)
@@ -57,6 +59,8 @@ public:
   ConfParameter conf{face, m_keyChain};
   DummyConfFileProcessor confProcessor{conf};
 
+  Statistics stats;
+  AdmissionController admission;
   Lsdb lsdb;
   Fib fib;
   RoutingTable rt;
@@ -290,6 +294,51 @@ BOOST_FIXTURE_TEST_CASE(RoutingTableUpdate, NamePrefixTableFixture)
   BOOST_CHECK_EQUAL(nextHops.size(), 3);
 }
 
+BOOST_FIXTURE_TEST_CASE(AnycastOriginCosts, NamePrefixTableFixture)
+{
+  const ndn::Name anycast("/ndn/cdn");
+  const ndn::Name router1("/ndn/router1");
+  const ndn::Name router2("/ndn/router2");
+  const ndn::FaceUri face1("udp4://10.0.0.1:6363");
+  const ndn::FaceUri face2("udp4://10.0.0.2:6363");
+  auto testTimePoint = time::system_clock::now();
+
+  NamePrefixList npl1;
+  npl1.insert(PrefixInfo(anycast, 0));
+  npt.updateFromLsdb(std::make_shared<NameLsa>(router1, 1, testTimePoint, npl1),
+                     LsdbUpdate::INSTALLED, {}, {});
+  NamePrefixList npl2;
+  npl2.insert(PrefixInfo(anycast, 100));
+  npt.updateFromLsdb(std::make_shared<NameLsa>(router2, 1, testTimePoint, npl2),
+                     LsdbUpdate::INSTALLED, {}, {});
+
+  NextHop hop1(face1, 10);
+  NextHop hop2(face2, 5);
+  rt.addNextHop(router1, hop1);
+  rt.addNextHop(router2, hop2);
+  npt.updateWithNewRoute(rt.m_rTable);
+
+  auto entry = std::find_if(npt.begin(), npt.end(),
+                            [&] (const auto& entry) { return entry->getNamePrefix() == anycast; });
+  BOOST_REQUIRE(entry != npt.end());
+
+  // Each origin contributes its next hops with its own cost of the name prefix
+  const auto& nexthops = (*entry)->getNexthopList();
+  BOOST_REQUIRE_EQUAL(nexthops.size(), 2);
+  BOOST_CHECK_EQUAL(nexthops.begin()->getConnectingFaceUri(), face1);
+  BOOST_CHECK_EQUAL(nexthops.begin()->getRouteCost(), 10);
+  BOOST_CHECK_EQUAL(std::next(nexthops.begin())->getConnectingFaceUri(), face2);
+  BOOST_CHECK_EQUAL(std::next(nexthops.begin())->getRouteCost(), 105);
+
+  // Only the cheapest next hops are kept, so router1's second next hop is left out
+  conf.setMaxFacesPerPrefix(1);
+  NextHop hop3(face2, 50);
+  rt.addNextHop(router1, hop3);
+  npt.updateWithNewRoute(rt.m_rTable);
+  BOOST_REQUIRE_EQUAL((*entry)->getNexthopList().size(), 1);
+  BOOST_CHECK_EQUAL((*entry)->getNexthopList().begin()->getConnectingFaceUri(), face1);
+}
+
 BOOST_FIXTURE_TEST_CASE(UpdateFromLsdb, NamePrefixTableFixture)
 {
   auto testTimePoint = time::system_clock::now();
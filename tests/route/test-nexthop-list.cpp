@@ -25,6 +25,8 @@
 
 #include "tests/boost-test.hpp"
 
+#include <set>
+
 namespace nlsr::tests {
 
 BOOST_AUTO_TEST_SUITE(TestNhl)
@@ -142,6 +144,28 @@ BOOST_AUTO_TEST_CASE(SortOnAddAndRemove)
   }
 }
 
+BOOST_AUTO_TEST_CASE(BeyondInlineCapacity)
+{
+  NexthopList list;
+  size_t nHops = NexthopList::INLINE_CAPACITY + 3;
+  for (size_t i = nHops; i > 0; --i) {
+    list.addNextHop(NextHop(ndn::FaceUri("udp4://10.0.0." + std::to_string(i) + ":6363"), i));
+  }
+  BOOST_REQUIRE_EQUAL(list.size(), nHops);
+
+  double lastCost = 0;
+  for (const auto& hop : list) {
+    BOOST_CHECK(hop.getRouteCost() > lastCost);
+    lastCost = hop.getRouteCost();
+  }
+
+  NexthopList copy(list);
+  BOOST_CHECK(copy == list);
+  copy.removeNextHop(NextHop(ndn::FaceUri("udp4://10.0.0.1:6363"), 1));
+  BOOST_CHECK_EQUAL(copy.size(), nHops - 1);
+  BOOST_CHECK(copy != list);
+}
+
 /* If there are two NextHops going to the same neighbor, then the list
    should always select the one with the cheaper cost. This would be
    caused by a Name being advertised by two different routers, which
@@ -145,6 +145,22 @@ BOOST_AUTO_TEST_CASE(Decode)
   BOOST_REQUIRE_EQUAL(nexthops1.getRouteCost(), 1.65);
 }
 
+BOOST_AUTO_TEST_CASE(SharedFaceUri)
+{
+  NextHop hop1(ndn::FaceUri("udp4://192.168.3.1:6363"), 10);
+  NextHop hop2(ndn::FaceUri("udp4://192.168.3.1:6363"), 20);
+  NextHop hop3(ndn::FaceUri("udp4://192.168.3.2:6363"), 10);
+
+  BOOST_CHECK(hop1.hasSameFace(hop2));
+  BOOST_CHECK_EQUAL(&hop1.getConnectingFaceUri(), &hop2.getConnectingFaceUri());
+  BOOST_CHECK(!hop1.hasSameFace(hop3));
+
+  // decoded next hops share the FaceUri too
+  NextHop decoded(hop2.wireEncode());
+  BOOST_CHECK(decoded.hasSameFace(hop1));
+  BOOST_CHECK_EQUAL(decoded, hop2);
+}
+
 BOOST_AUTO_TEST_CASE(OutputStream)
 {
   NextHop nexthops1;
@@ -31,6 +31,8 @@
 #include "tests/io-key-chain-fixture.hpp"
 #include "tests/test-common.hpp"
 
+#include <set>
+
 namespace nlsr::tests {
 
 constexpr time::system_clock::time_point MAX_TIME = time::system_clock::time_point::max();
@@ -121,6 +123,22 @@ public:
     lsdb.installLsa(std::make_shared<AdjLsa>(ROUTER_C_NAME, 1, MAX_TIME, adjList));
   }
 
+  /**
+   * @brief Insert Adjacency LSA of @p router , with a link of the given cost to each router.
+   */
+  void
+  setupRouter(const ndn::Name& router, std::initializer_list<std::pair<ndn::Name, double>> links,
+              bool isNoTransit = false)
+  {
+    AdjacencyList adjList;
+    for (const auto& [neighbor, cost] : links) {
+      adjList.insert(Adjacent(neighbor, ndn::FaceUri(), cost, Adjacent::STATUS_ACTIVE, 0, 0));
+    }
+    auto lsa = std::make_shared<AdjLsa>(router, 1, MAX_TIME, adjList);
+    lsa->setNoTransit(isNoTransit);
+    lsdb.installLsa(lsa);
+  }
+
   /**
    * @brief Run link-state routing calculator.
    */
@@ -136,18 +154,21 @@ public:
    * @brief Verify that the routing table contains an entry with specific next hops.
    * @param destination Destination router.
    * @param expectedNextHops Expected next hops; order does not matter.
+   * @param topology Routing topology; empty for the default topology.
    */
   void
   checkRoutingTableEntry(const ndn::Name& destination,
-                         std::initializer_list<NextHop> expectedNextHops) const
+                         std::initializer_list<NextHop> expectedNextHops,
+                         const std::string& topology = "") const
   {
-    BOOST_TEST_CONTEXT("Checking routing table entry " << destination)
+    BOOST_TEST_CONTEXT("Checking routing table entry " << destination << " in topology '"
+                       << topology << "'")
     {
       using NextHopSet = std::set<NextHop, NextHopUriSortedComparator>;
 
       NextHopSet expectedNextHopSet(expectedNextHops);
 
-      const RoutingTableEntry* entry = routingTable.findRoutingTableEntry(destination);
+      const RoutingTableEntry* entry = routingTable.findRoutingTableEntry(destination, topology);
       BOOST_REQUIRE(entry != nullptr);
 
       const NexthopList& actualNextHopList = entry->getNexthopList();
@@ -292,6 +313,80 @@ BOOST_AUTO_TEST_CASE(OnePath)
   });
 }
 
+BOOST_AUTO_TEST_CASE(GraphReduction)
+{
+  // D hangs off C, and the chain B-E-F-C is shorter than the direct link between B and C:
+  //
+  //   A-----B---E
+  //    \    |   |
+  //     \   |   F
+  //      \  |  /
+  //        C
+  //        |
+  //        D
+  const ndn::Name ROUTER_D_NAME("/ndn/site/%C1.Router/d");
+  const ndn::Name ROUTER_E_NAME("/ndn/site/%C1.Router/e");
+  const ndn::Name ROUTER_F_NAME("/ndn/site/%C1.Router/f");
+
+  setupRouterA();
+  setupRouter(ROUTER_B_NAME, {{ROUTER_A_NAME, LINK_AB_COST}, {ROUTER_C_NAME, LINK_BC_COST},
+                              {ROUTER_E_NAME, 1}});
+  setupRouter(ROUTER_C_NAME, {{ROUTER_A_NAME, LINK_AC_COST}, {ROUTER_B_NAME, LINK_BC_COST},
+                              {ROUTER_F_NAME, 1}, {ROUTER_D_NAME, 3}});
+  setupRouter(ROUTER_D_NAME, {{ROUTER_C_NAME, 3}});
+  setupRouter(ROUTER_E_NAME, {{ROUTER_B_NAME, 1}, {ROUTER_F_NAME, 1}});
+  setupRouter(ROUTER_F_NAME, {{ROUTER_E_NAME, 1}, {ROUTER_C_NAME, 1}});
+  calculatePath();
+
+  checkRoutingTableEntry(ROUTER_B_NAME, {
+    {ROUTER_B_FACE, LINK_AB_COST},
+    {ROUTER_C_FACE, LINK_AC_COST + 3},
+  });
+  checkRoutingTableEntry(ROUTER_C_NAME, {
+    {ROUTER_C_FACE, LINK_AC_COST},
+    {ROUTER_B_FACE, LINK_AB_COST + 3},
+  });
+  checkRoutingTableEntry(ROUTER_D_NAME, {
+    {ROUTER_C_FACE, LINK_AC_COST + 3},
+    {ROUTER_B_FACE, LINK_AB_COST + 3 + 3},
+  });
+  checkRoutingTableEntry(ROUTER_E_NAME, {
+    {ROUTER_B_FACE, LINK_AB_COST + 1},
+    {ROUTER_C_FACE, LINK_AC_COST + 2},
+  });
+  checkRoutingTableEntry(ROUTER_F_NAME, {
+    {ROUTER_B_FACE, LINK_AB_COST + 2},
+    {ROUTER_C_FACE, LINK_AC_COST + 1},
+  });
+
+  conf.setMaxFacesPerPrefix(1);
+  routingTable.m_rTable.clear();
+  calculatePath();
+  checkRoutingTableEntry(ROUTER_D_NAME, {
+    {ROUTER_B_FACE, LINK_AB_COST + 3 + 3},
+  });
+  checkRoutingTableEntry(ROUTER_F_NAME, {
+    {ROUTER_B_FACE, LINK_AB_COST + 2},
+  });
+}
+
+BOOST_AUTO_TEST_CASE(NoTransit)
+{
+  setupRouterA();
+  setupRouter(ROUTER_B_NAME, {{ROUTER_A_NAME, LINK_AB_COST}, {ROUTER_C_NAME, LINK_BC_COST}}, true);
+  setupRouterC();
+  calculatePath();
+
+  // B is reached through C, but C is not reached through B
+  checkRoutingTableEntry(ROUTER_B_NAME, {
+    {ROUTER_B_FACE, LINK_AB_COST},
+    {ROUTER_C_FACE, LINK_AC_COST + LINK_BC_COST},
+  });
+  checkRoutingTableEntry(ROUTER_C_NAME, {
+    {ROUTER_C_FACE, LINK_AC_COST},
+  });
+}
+
 BOOST_AUTO_TEST_CASE(SourceRouterAbsent)
 {
   // RouterA does not exist in the LSDB.
@@ -311,6 +406,59 @@ BOOST_AUTO_TEST_CASE(SourceRouterAbsent)
   BOOST_CHECK(routingTable.m_rTable.empty());
 }
 
+BOOST_AUTO_TEST_CASE(Topologies)
+{
+  conf.addTopology(Topology{"latency", TopologyMetric::LINK_COST, {}});
+  conf.addTopology(Topology{"hops", TopologyMetric::HOP_COUNT, {}});
+
+  // In topology "latency", the direct link between A and C is slower than the path through B
+  double latencyAC = 30.0;
+  Adjacent adjacentC(ROUTER_C_NAME, ROUTER_C_FACE, LINK_AC_COST, Adjacent::STATUS_ACTIVE, 0, 0);
+  adjacentC.setTopologyCost("latency", latencyAC);
+  conf.getAdjacencyList().insert(adjacentC);
+
+  setupRouterA(LINK_AB_COST, NAN);
+  setupRouterB();
+  setupRouterC();
+  calculatePath();
+
+  // The default topology is unaffected by topology costs
+  checkRoutingTableEntry(ROUTER_C_NAME, {
+    {ROUTER_C_FACE, LINK_AC_COST},
+    {ROUTER_B_FACE, LINK_AB_COST + LINK_BC_COST},
+  });
+
+  // Neighbors without a topology-cost keep their link-cost
+  checkRoutingTableEntry(ROUTER_B_NAME, {
+    {ROUTER_B_FACE, LINK_AB_COST},
+    {ROUTER_C_FACE, latencyAC + LINK_BC_COST},
+  }, "latency");
+  checkRoutingTableEntry(ROUTER_C_NAME, {
+    {ROUTER_B_FACE, LINK_AB_COST + LINK_BC_COST},
+    {ROUTER_C_FACE, latencyAC},
+  }, "latency");
+
+  checkRoutingTableEntry(ROUTER_C_NAME, {
+    {ROUTER_C_FACE, 1},
+    {ROUTER_B_FACE, 2},
+  }, "hops");
+
+  BOOST_CHECK(routingTable.findRoutingTableEntry(ROUTER_C_NAME, "unknown") == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(FindTopology)
+{
+  std::vector<Topology> topologies{
+    {"video", TopologyMetric::LINK_COST, {"/ndn/video"}},
+    {"live", TopologyMetric::HOP_COUNT, {"/ndn/video/live", "/ndn/chat"}},
+  };
+
+  BOOST_CHECK(findTopology(topologies, "/ndn/site") == nullptr);
+  BOOST_CHECK_EQUAL(findTopology(topologies, "/ndn/video/stored")->name, "video");
+  BOOST_CHECK_EQUAL(findTopology(topologies, "/ndn/video/live/1")->name, "live");
+  BOOST_CHECK_EQUAL(findTopology(topologies, "/ndn/chat")->name, "live");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
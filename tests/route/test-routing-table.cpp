@@ -38,7 +38,9 @@ public:
   ConfParameter conf{face, m_keyChain};
   DummyConfFileProcessor confProcessor{conf};
 
-  Lsdb lsdb{face, m_keyChain, conf};
+  Statistics stats;
+  AdmissionController admission{m_io, conf};
+  Lsdb lsdb{face, m_keyChain, conf, stats, admission};
   RoutingTable rt{m_scheduler, lsdb, conf};
 };
 
@@ -0,0 +1,96 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "route/topology-change.hpp"
+#include "tlv-nlsr.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <ndn-cxx/encoding/block-helpers.hpp>
+
+namespace nlsr::tests {
+
+BOOST_AUTO_TEST_SUITE(TestTopologyChange)
+
+BOOST_AUTO_TEST_CASE(EncodeDecode)
+{
+  std::vector<TopologyChange> changes{
+    TopologyChange::makeLinkDown("/ndn/site/a", "/ndn/site/b"),
+    TopologyChange::makeLinkCost("/ndn/site/a", "/ndn/site/c", 25),
+    TopologyChange::makeRouterDown("/ndn/site/d"),
+  };
+
+  for (const auto& change : changes) {
+    BOOST_CHECK_EQUAL(TopologyChange(change.wireEncode()), change);
+  }
+  BOOST_CHECK(changes[1].getKind() == TopologyChange::Kind::LINK_COST);
+  BOOST_CHECK_EQUAL(changes[1].getOtherRouter(), "/ndn/site/c");
+  BOOST_CHECK_EQUAL(changes[1].getCost(), 25);
+
+  auto list = TopologyChange::encodeList(changes);
+  BOOST_CHECK_EQUAL(list.type(), nlsr::tlv::TopologyChangeList);
+  BOOST_TEST(TopologyChange::decodeList(list) == changes, boost::test_tools::per_element());
+  BOOST_CHECK(TopologyChange::decodeList(TopologyChange::encodeList({})).empty());
+}
+
+BOOST_AUTO_TEST_CASE(DecodeInvalid)
+{
+  auto makeChange = [] (uint64_t kind, std::initializer_list<ndn::Block> fields) {
+    ndn::Block block(nlsr::tlv::TopologyChange);
+    block.push_back(ndn::encoding::makeNonNegativeIntegerBlock(nlsr::tlv::TopologyChangeKind, kind));
+    for (const auto& field : fields) {
+      block.push_back(field);
+    }
+    block.encode();
+    return block;
+  };
+  ndn::Block router = ndn::Name("/ndn/site/a").wireEncode();
+  ndn::Block otherRouter = ndn::Name("/ndn/site/b").wireEncode();
+
+  // unknown kind
+  BOOST_CHECK_THROW(TopologyChange(makeChange(3, {router})), TopologyChange::Error);
+  // link without its other end
+  BOOST_CHECK_THROW(TopologyChange(makeChange(0, {router})), TopologyChange::Error);
+  // cost change without a cost
+  BOOST_CHECK_THROW(TopologyChange(makeChange(1, {router, otherRouter})), TopologyChange::Error);
+  // negative cost
+  BOOST_CHECK_THROW(TopologyChange(makeChange(1, {router, otherRouter,
+                      ndn::encoding::makeDoubleBlock(nlsr::tlv::CostDouble, -1)})),
+                    TopologyChange::Error);
+  // wrong outer type
+  BOOST_CHECK_THROW(TopologyChange::decodeList(router), TopologyChange::Error);
+
+  BOOST_CHECK_EQUAL(TopologyChange(makeChange(2, {router})),
+                    TopologyChange::makeRouterDown("/ndn/site/a"));
+}
+
+BOOST_AUTO_TEST_CASE(Print)
+{
+  std::ostringstream os;
+  os << TopologyChange::makeLinkCost("/ndn/site/a", "/ndn/site/b", 25) << "\n"
+     << TopologyChange::makeRouterDown("/ndn/site/a");
+  BOOST_CHECK_EQUAL(os.str(), "link-cost /ndn/site/a /ndn/site/b 25\n"
+                              "router-down /ndn/site/a");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nlsr::tests
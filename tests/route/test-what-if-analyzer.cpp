@@ -0,0 +1,218 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "route/what-if-analyzer.hpp"
+
+#include "adjacency-list.hpp"
+#include "adjacent.hpp"
+#include "lsdb.hpp"
+#include "nlsr.hpp"
+
+#include "tests/io-key-chain-fixture.hpp"
+#include "tests/test-common.hpp"
+
+namespace nlsr::tests {
+
+constexpr time::system_clock::time_point MAX_TIME = time::system_clock::time_point::max();
+static const ndn::Name ROUTER_A_NAME = "/ndn/site/%C1.Router/this-router";
+static const ndn::Name ROUTER_B_NAME = "/ndn/site/%C1.Router/b";
+static const ndn::Name ROUTER_C_NAME = "/ndn/site/%C1.Router/c";
+static const ndn::Name PREFIX_B = "/ndn/b-data";
+static const ndn::Name PREFIX_C = "/ndn/c-data";
+static const ndn::FaceUri ROUTER_A_FACE("udp4://10.0.0.1:6363");
+static const ndn::FaceUri ROUTER_B_FACE("udp4://10.0.0.2:6363");
+static const ndn::FaceUri ROUTER_C_FACE("udp4://10.0.0.3:6363");
+constexpr double LINK_AB_COST = 5.0;
+constexpr double LINK_AC_COST = 10.0;
+constexpr double LINK_BC_COST = 17.0;
+constexpr double PREFIX_C_COST = 3.0;
+
+/**
+ * @brief Provide a triangle topology for what-if analysis, as seen from router A.
+ *
+ *   A-----B  advertises PREFIX_B
+ *    \   /
+ *     \ /
+ *      C     advertises PREFIX_C
+ */
+class WhatIfAnalyzerFixture : public IoKeyChainFixture
+{
+public:
+  WhatIfAnalyzerFixture()
+    : face(m_io, m_keyChain)
+    , conf(face, m_keyChain)
+    , confProcessor(conf)
+    , nlsr(face, m_keyChain, conf)
+    , lsdb(nlsr.m_lsdb)
+    , analyzer(nlsr.m_whatIfAnalyzer)
+  {
+    AdjacencyList& adjList = conf.getAdjacencyList();
+    adjList.insert(Adjacent(ROUTER_B_NAME, ROUTER_B_FACE, LINK_AB_COST, Adjacent::STATUS_ACTIVE, 0, 0));
+    adjList.insert(Adjacent(ROUTER_C_NAME, ROUTER_C_FACE, LINK_AC_COST, Adjacent::STATUS_ACTIVE, 0, 0));
+    lsdb.installLsa(std::make_shared<AdjLsa>(ROUTER_A_NAME, 1, MAX_TIME, adjList));
+
+    AdjacencyList adjListB;
+    adjListB.insert(Adjacent(ROUTER_A_NAME, ROUTER_A_FACE, LINK_AB_COST, Adjacent::STATUS_ACTIVE, 0, 0));
+    adjListB.insert(Adjacent(ROUTER_C_NAME, ROUTER_C_FACE, LINK_BC_COST, Adjacent::STATUS_ACTIVE, 0, 0));
+    lsdb.installLsa(std::make_shared<AdjLsa>(ROUTER_B_NAME, 1, MAX_TIME, adjListB));
+
+    AdjacencyList adjListC;
+    adjListC.insert(Adjacent(ROUTER_A_NAME, ROUTER_A_FACE, LINK_AC_COST, Adjacent::STATUS_ACTIVE, 0, 0));
+    adjListC.insert(Adjacent(ROUTER_B_NAME, ROUTER_B_FACE, LINK_BC_COST, Adjacent::STATUS_ACTIVE, 0, 0));
+    lsdb.installLsa(std::make_shared<AdjLsa>(ROUTER_C_NAME, 1, MAX_TIME, adjListC));
+
+    NamePrefixList nplB;
+    nplB.insert(PREFIX_B);
+    lsdb.installLsa(std::make_shared<NameLsa>(ROUTER_B_NAME, 1, MAX_TIME, nplB));
+
+    NamePrefixList nplC;
+    nplC.insert(PREFIX_C, "", PREFIX_C_COST);
+    lsdb.installLsa(std::make_shared<NameLsa>(ROUTER_C_NAME, 1, MAX_TIME, nplC));
+  }
+
+  static void
+  checkRouteChange(const WhatIfReport::RouteChange& change, const ndn::Name& name,
+                   std::optional<double> oldCost, std::optional<double> newCost)
+  {
+    BOOST_CHECK_EQUAL(change.name, name);
+    BOOST_CHECK(change.oldCost == oldCost);
+    BOOST_CHECK(change.newCost == newCost);
+  }
+
+public:
+  ndn::DummyClientFace face;
+  ConfParameter conf;
+  DummyConfFileProcessor confProcessor;
+  Nlsr nlsr;
+  Lsdb& lsdb;
+  WhatIfAnalyzer& analyzer;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestWhatIfAnalyzer, WhatIfAnalyzerFixture)
+
+BOOST_AUTO_TEST_CASE(Unchanged)
+{
+  auto routes = analyzer.computeRoutes({});
+  BOOST_REQUIRE_EQUAL(routes.prefixes.count(PREFIX_C), 1);
+  const auto& nexthops = routes.prefixes.at(PREFIX_C);
+  BOOST_REQUIRE_EQUAL(nexthops.size(), 2);
+  BOOST_CHECK_EQUAL(nexthops.begin()->getConnectingFaceUri(), ROUTER_C_FACE);
+  BOOST_CHECK_EQUAL(nexthops.begin()->getRouteCost(), LINK_AC_COST + PREFIX_C_COST);
+
+  auto report = analyzer.analyze({});
+  BOOST_CHECK(report.routers.empty());
+  BOOST_CHECK(report.prefixes.empty());
+  BOOST_CHECK_EQUAL(report.nFibRegistrations, 0);
+  BOOST_CHECK_EQUAL(report.nFibUnregistrations, 0);
+}
+
+BOOST_AUTO_TEST_CASE(LinkDown)
+{
+  auto report = analyzer.analyze({TopologyChange::makeLinkDown(ROUTER_A_NAME, ROUTER_B_NAME)});
+
+  // B is only reachable through C; C loses its second path through B
+  BOOST_REQUIRE_EQUAL(report.routers.size(), 2);
+  checkRouteChange(report.routers[0], ROUTER_B_NAME, LINK_AB_COST, LINK_AC_COST + LINK_BC_COST);
+  checkRouteChange(report.routers[1], ROUTER_C_NAME, LINK_AC_COST, LINK_AC_COST);
+  BOOST_REQUIRE_EQUAL(report.prefixes.size(), 2);
+  checkRouteChange(report.prefixes[0], PREFIX_B, LINK_AB_COST, LINK_AC_COST + LINK_BC_COST);
+  checkRouteChange(report.prefixes[1], PREFIX_C,
+                   LINK_AC_COST + PREFIX_C_COST, LINK_AC_COST + PREFIX_C_COST);
+  BOOST_CHECK_EQUAL(report.nFibRegistrations, 0);
+  BOOST_CHECK_EQUAL(report.nFibUnregistrations, 4);
+
+  std::ostringstream os;
+  os << report;
+  BOOST_CHECK_EQUAL(os.str(),
+    "Routers: 0 unreachable, 1 costlier, 0 cheaper, 1 rerouted\n"
+    "  /ndn/site/%C1.Router/b: 5 -> 27\n"
+    "  /ndn/site/%C1.Router/c: 10 -> 10 (rerouted)\n"
+    "Name prefixes: 0 unreachable, 1 costlier, 0 cheaper, 1 rerouted\n"
+    "  /ndn/b-data: 5 -> 27\n"
+    "  /ndn/c-data: 13 -> 13 (rerouted)\n"
+    "FIB: 0 registrations, 4 unregistrations\n");
+}
+
+BOOST_AUTO_TEST_CASE(LinkCost)
+{
+  conf.setMaxFacesPerPrefix(1);
+  auto report = analyzer.analyze({TopologyChange::makeLinkCost(ROUTER_A_NAME, ROUTER_B_NAME, 30)});
+
+  // With a single next hop, only the destinations behind the changed link are affected
+  BOOST_REQUIRE_EQUAL(report.routers.size(), 1);
+  checkRouteChange(report.routers[0], ROUTER_B_NAME, LINK_AB_COST, LINK_AC_COST + LINK_BC_COST);
+  BOOST_REQUIRE_EQUAL(report.prefixes.size(), 1);
+  checkRouteChange(report.prefixes[0], PREFIX_B, LINK_AB_COST, LINK_AC_COST + LINK_BC_COST);
+  BOOST_CHECK_EQUAL(report.nFibRegistrations, 2);
+  BOOST_CHECK_EQUAL(report.nFibUnregistrations, 2);
+}
+
+BOOST_AUTO_TEST_CASE(RouterDown)
+{
+  auto report = analyzer.analyze({TopologyChange::makeRouterDown(ROUTER_C_NAME)});
+
+  BOOST_REQUIRE_EQUAL(report.routers.size(), 2);
+  checkRouteChange(report.routers[0], ROUTER_B_NAME, LINK_AB_COST, LINK_AB_COST);
+  checkRouteChange(report.routers[1], ROUTER_C_NAME, LINK_AC_COST, std::nullopt);
+  BOOST_REQUIRE_EQUAL(report.prefixes.size(), 2);
+  checkRouteChange(report.prefixes[1], PREFIX_C, LINK_AC_COST + PREFIX_C_COST, std::nullopt);
+  BOOST_CHECK_EQUAL(report.nFibRegistrations, 0);
+  BOOST_CHECK_EQUAL(report.nFibUnregistrations, 6);
+}
+
+BOOST_AUTO_TEST_CASE(IgnoredChanges)
+{
+  auto report = analyzer.analyze({
+    TopologyChange::makeRouterDown(ROUTER_A_NAME),
+    TopologyChange::makeLinkDown(ROUTER_A_NAME, "/ndn/site/%C1.Router/unknown"),
+  });
+
+  BOOST_CHECK_EQUAL(report.ignoredChanges.size(), 2);
+  BOOST_CHECK(report.routers.empty());
+  BOOST_CHECK(report.prefixes.empty());
+}
+
+BOOST_AUTO_TEST_CASE(BaselineInvalidation)
+{
+  analyzer.analyze({});
+  BOOST_CHECK(analyzer.m_baseline.has_value());
+
+  // A new link from B to D makes D reachable in the baseline, so that removing it matters
+  const ndn::Name ROUTER_D_NAME = "/ndn/site/%C1.Router/d";
+  AdjacencyList adjListD;
+  adjListD.insert(Adjacent(ROUTER_B_NAME, ROUTER_B_FACE, 1, Adjacent::STATUS_ACTIVE, 0, 0));
+  lsdb.installLsa(std::make_shared<AdjLsa>(ROUTER_D_NAME, 1, MAX_TIME, adjListD));
+  BOOST_CHECK(!analyzer.m_baseline.has_value());
+
+  AdjacencyList adjListB;
+  adjListB.insert(Adjacent(ROUTER_A_NAME, ROUTER_A_FACE, LINK_AB_COST, Adjacent::STATUS_ACTIVE, 0, 0));
+  adjListB.insert(Adjacent(ROUTER_C_NAME, ROUTER_C_FACE, LINK_BC_COST, Adjacent::STATUS_ACTIVE, 0, 0));
+  adjListB.insert(Adjacent(ROUTER_D_NAME, ndn::FaceUri(), 1, Adjacent::STATUS_ACTIVE, 0, 0));
+  lsdb.installLsa(std::make_shared<AdjLsa>(ROUTER_B_NAME, 2, MAX_TIME, adjListB));
+
+  auto report = analyzer.analyze({TopologyChange::makeLinkDown(ROUTER_B_NAME, ROUTER_D_NAME)});
+  BOOST_REQUIRE_EQUAL(report.routers.size(), 1);
+  checkRouteChange(report.routers[0], ROUTER_D_NAME, LINK_AB_COST + 1, std::nullopt);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nlsr::tests
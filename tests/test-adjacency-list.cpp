@@ -74,6 +74,60 @@ BOOST_AUTO_TEST_CASE(FindAdjacentByFaceUri)
   BOOST_CHECK(adjIter != adjList.end());
 }
 
+BOOST_AUTO_TEST_CASE(FindAdjacentByFaceId)
+{
+  AdjacencyList adjList;
+  adjList.insert(Adjacent("/ndn/test/1", ndn::FaceUri("udp4://10.0.0.1:6363"), 10,
+                          Adjacent::STATUS_INACTIVE, 0, 0));
+  adjList.insert(Adjacent("/ndn/test/2", ndn::FaceUri("udp4://10.0.0.2:6363"), 10,
+                          Adjacent::STATUS_INACTIVE, 0, 7));
+
+  BOOST_CHECK_EQUAL(adjList.findAdjacent(7)->getName(), ndn::Name("/ndn/test/2"));
+  BOOST_CHECK(adjList.findAdjacent(8) == adjList.end());
+  BOOST_CHECK_EQUAL(adjList.findAdjacent(0)->getName(), ndn::Name("/ndn/test/1"));
+
+  auto adj = adjList.findAdjacentByFaceUri("udp4://10.0.0.1:6363");
+  BOOST_REQUIRE(adj != adjList.end());
+  adjList.setFaceId(adj, 8);
+  BOOST_CHECK_EQUAL(adjList.findAdjacent(8)->getName(), ndn::Name("/ndn/test/1"));
+  BOOST_CHECK_EQUAL(adjList.getFaceId(ndn::FaceUri("udp4://10.0.0.1:6363")), 8);
+
+  adj = adjList.findAdjacent(ndn::Name("/ndn/test/2"));
+  adjList.setFaceId(adj, 0);
+  BOOST_CHECK(adjList.findAdjacent(7) == adjList.end());
+  BOOST_CHECK_EQUAL(adjList.findAdjacent(0)->getName(), ndn::Name("/ndn/test/2"));
+
+  BOOST_CHECK(!adjList.insert(Adjacent("/ndn/test/2")));
+  BOOST_CHECK_EQUAL(adjList.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(Erase)
+{
+  AdjacencyList adjList;
+  adjList.insert(Adjacent("/ndn/test/1", ndn::FaceUri("udp4://10.0.0.1:6363"), 10,
+                          Adjacent::STATUS_INACTIVE, 0, 1));
+  adjList.insert(Adjacent("/ndn/test/2", ndn::FaceUri("udp4://10.0.0.2:6363"), 10,
+                          Adjacent::STATUS_INACTIVE, 0, 2));
+  adjList.insert(Adjacent("/ndn/test/3", ndn::FaceUri("udp4://10.0.0.3:6363"), 10,
+                          Adjacent::STATUS_INACTIVE, 0, 3));
+
+  BOOST_CHECK(adjList.erase("/ndn/test/1"));
+  BOOST_CHECK(!adjList.erase("/ndn/test/1"));
+  BOOST_CHECK_EQUAL(adjList.size(), 2);
+  BOOST_CHECK(!adjList.isNeighbor("/ndn/test/1"));
+  BOOST_CHECK(adjList.findAdjacent(1) == adjList.end());
+  BOOST_CHECK(adjList.findAdjacentByFaceUri("udp4://10.0.0.1:6363") == adjList.end());
+
+  // the adjacency moved into the freed slot is still indexed
+  BOOST_CHECK_EQUAL(adjList.findAdjacent(3)->getName(), ndn::Name("/ndn/test/3"));
+  BOOST_CHECK_EQUAL(adjList.findAdjacentByFaceUri("udp4://10.0.0.3:6363")->getName(),
+                    ndn::Name("/ndn/test/3"));
+  BOOST_CHECK_EQUAL(adjList.findAdjacent(ndn::Name("/ndn/test/2"))->getFaceId(), 2);
+
+  BOOST_CHECK(adjList.insert(Adjacent("/ndn/test/1")));
+  BOOST_CHECK_EQUAL(adjList.size(), 3);
+}
+
 BOOST_AUTO_TEST_CASE(AdjLsaIsBuildableWithOneNodeActive)
 {
   Adjacent adjacencyA("/router/A");
@@ -100,6 +100,25 @@ BOOST_AUTO_TEST_CASE(CompareFaceId)
   BOOST_CHECK(adjacent1.compareFaceId(adjacent2.getFaceId()));
 }
 
+BOOST_AUTO_TEST_CASE(TopologyCosts)
+{
+  Adjacent adjacent1("name1", ndn::FaceUri("udp4://10.0.0.1:8000"), 10,
+                     Adjacent::STATUS_ACTIVE, 0, 0);
+  BOOST_CHECK_EQUAL(adjacent1.getTopologyCost("latency"), 10);
+
+  adjacent1.setTopologyCost("latency", 25);
+  adjacent1.setTopologyCost("bulk", 3);
+  BOOST_CHECK_EQUAL(adjacent1.getTopologyCost("latency"), 25);
+  BOOST_CHECK_THROW(adjacent1.setTopologyCost("latency", -1), ndn::tlv::Error);
+
+  Adjacent adjacent2(adjacent1.wireEncode());
+  BOOST_CHECK(adjacent1 == adjacent2);
+  BOOST_CHECK_EQUAL(adjacent2.getTopologyCost("bulk"), 3);
+
+  adjacent2.setTopologyCost("bulk", 4);
+  BOOST_CHECK(adjacent1 != adjacent2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
@@ -0,0 +1,173 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "admission-controller.hpp"
+#include "conf-parameter.hpp"
+
+#include "tests/io-key-chain-fixture.hpp"
+#include "tests/test-common.hpp"
+
+namespace nlsr::tests {
+
+using Result = AdmissionController::Result;
+
+class AdmissionControllerFixture : public IoKeyChainFixture
+{
+public:
+  AdmissionController&
+  makeController()
+  {
+    controller = std::make_unique<AdmissionController>(m_io, conf, [this] { return lag; });
+    return *controller;
+  }
+
+  std::function<void()>
+  record(const std::string& what)
+  {
+    return [this, what] { handled.push_back(what); };
+  }
+
+public:
+  ndn::DummyClientFace face{m_io, m_keyChain};
+  ConfParameter conf{face, m_keyChain};
+  ndn::time::nanoseconds lag{0};
+  std::unique_ptr<AdmissionController> controller;
+  std::vector<std::string> handled;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestAdmissionController, AdmissionControllerFixture)
+
+BOOST_AUTO_TEST_CASE(Priority)
+{
+  auto& admission = makeController();
+  BOOST_CHECK(admission.enqueue(AdmissionClass::DATASET, 1, 4_s, record("dataset")) == Result::ADMITTED);
+  BOOST_CHECK(admission.enqueue(AdmissionClass::LSA, 2, 4_s, record("lsa")) == Result::ADMITTED);
+  BOOST_CHECK(admission.enqueue(AdmissionClass::HELLO, 3, 4_s, record("hello")) == Result::ADMITTED);
+  BOOST_CHECK_EQUAL(admission.getQueueSize(AdmissionClass::LSA), 1);
+  BOOST_CHECK(handled.empty());
+
+  advanceClocks(1_ms);
+  std::vector<std::string> expected{"hello", "lsa", "dataset"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(handled.begin(), handled.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(admission.getQueueSize(AdmissionClass::LSA), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Batches)
+{
+  auto& admission = makeController();
+  for (size_t i = 0; i < AdmissionController::DRAIN_BATCH; ++i) {
+    admission.enqueue(AdmissionClass::LSA, 1, 4_s, record("lsa"));
+  }
+  admission.enqueue(AdmissionClass::DATASET, 1, 4_s, record("dataset"));
+
+  // a Hello arriving after the first batch overtakes the remaining dataset Interest
+  admission.drain();
+  BOOST_CHECK_EQUAL(handled.size(), AdmissionController::DRAIN_BATCH);
+  admission.enqueue(AdmissionClass::HELLO, 2, 4_s, record("hello"));
+
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(handled.size(), AdmissionController::DRAIN_BATCH + 2);
+  BOOST_CHECK_EQUAL(handled[AdmissionController::DRAIN_BATCH], "hello");
+  BOOST_CHECK_EQUAL(handled.back(), "dataset");
+}
+
+BOOST_AUTO_TEST_CASE(RateLimit)
+{
+  conf.setAdmissionSourceRate(10);
+  conf.setAdmissionSourceBurst(2);
+  auto& admission = makeController();
+
+  BOOST_CHECK(admission.enqueue(AdmissionClass::LSA, 1, 4_s, record("lsa")) == Result::ADMITTED);
+  BOOST_CHECK(admission.enqueue(AdmissionClass::DATASET, 1, 4_s, record("dataset")) == Result::ADMITTED);
+  BOOST_CHECK(admission.enqueue(AdmissionClass::LSA, 1, 4_s, record("lsa")) == Result::RATE_LIMITED);
+  // limits apply per source, and never to Hello
+  BOOST_CHECK(admission.enqueue(AdmissionClass::LSA, 2, 4_s, record("lsa")) == Result::ADMITTED);
+  BOOST_CHECK(admission.enqueue(AdmissionClass::HELLO, 1, 4_s, record("hello")) == Result::ADMITTED);
+
+  advanceClocks(100_ms);
+  BOOST_CHECK(admission.enqueue(AdmissionClass::LSA, 1, 4_s, record("lsa")) == Result::ADMITTED);
+  BOOST_CHECK(admission.enqueue(AdmissionClass::LSA, 1, 4_s, record("lsa")) == Result::RATE_LIMITED);
+}
+
+BOOST_AUTO_TEST_CASE(Shedding)
+{
+  conf.setAdmissionShedLag(100);
+  auto& admission = makeController();
+
+  lag = 150_ms;
+  BOOST_CHECK(admission.enqueue(AdmissionClass::DATASET, 1, 4_s, record("dataset")) == Result::SHED);
+  BOOST_CHECK(admission.enqueue(AdmissionClass::LSA, 1, 4_s, record("lsa")) == Result::ADMITTED);
+
+  lag = 250_ms;
+  BOOST_CHECK(admission.enqueue(AdmissionClass::LSA, 1, 4_s, record("lsa")) == Result::SHED);
+  BOOST_CHECK(admission.enqueue(AdmissionClass::HELLO, 1, 4_s, record("hello")) == Result::ADMITTED);
+
+  // time spent waiting in the queues counts as lag as well
+  lag = 0_ns;
+  auto& backlogged = makeController();
+  BOOST_CHECK(backlogged.enqueue(AdmissionClass::LSA, 1, 4_s, record("lsa")) == Result::ADMITTED);
+  m_steadyClock->advance(150_ms);
+  BOOST_CHECK(backlogged.enqueue(AdmissionClass::DATASET, 1, 4_s, record("dataset")) == Result::SHED);
+
+  conf.setAdmissionShedLag(0);
+  lag = 1_s;
+  auto& unlimited = makeController();
+  BOOST_CHECK(unlimited.enqueue(AdmissionClass::DATASET, 1, 4_s, record("dataset")) == Result::ADMITTED);
+}
+
+BOOST_AUTO_TEST_CASE(QueueFullAndExpired)
+{
+  conf.setAdmissionMaxQueueLength(2);
+  auto& admission = makeController();
+
+  // the Hello handler takes long enough for the LSA Interest to expire meanwhile
+  admission.enqueue(AdmissionClass::HELLO, 1, 4_s, [this] {
+    handled.push_back("hello");
+    m_steadyClock->advance(1_s);
+  });
+  BOOST_CHECK(admission.enqueue(AdmissionClass::LSA, 1, 500_ms, record("lsa")) == Result::ADMITTED);
+  BOOST_CHECK(admission.enqueue(AdmissionClass::LSA, 1, 4_s, record("lsa")) == Result::ADMITTED);
+  BOOST_CHECK(admission.enqueue(AdmissionClass::LSA, 1, 4_s, record("lsa")) == Result::QUEUE_FULL);
+
+  advanceClocks(1_ms);
+  std::vector<std::string> expected{"hello", "lsa"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(handled.begin(), handled.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(InterestFilter)
+{
+  auto& admission = makeController();
+  ndn::Name received;
+  face.setInterestFilter("/ndn/site/%C1.Router/this-router/nlsr/INFO",
+    admission.wrap(AdmissionClass::HELLO, [&] (const auto&, const auto& interest) {
+      received = interest.getName();
+    }));
+  advanceClocks(10_ms);
+
+  face.receive(ndn::Interest("/ndn/site/%C1.Router/this-router/nlsr/INFO/neighbor"));
+  BOOST_CHECK(received.empty());
+  advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(received, "/ndn/site/%C1.Router/this-router/nlsr/INFO/neighbor");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nlsr::tests
@@ -293,6 +293,20 @@ BOOST_AUTO_TEST_CASE(DefaultValuesGeneral)
   BOOST_CHECK_EQUAL(processConfigurationString(config), false);
 }
 
+BOOST_AUTO_TEST_CASE(LsaEncoding)
+{
+  BOOST_REQUIRE(processConfigurationString(SECTION_GENERAL));
+  BOOST_CHECK_EQUAL(conf.isLsaEncodingCompact(), false);
+
+  std::string config = SECTION_GENERAL;
+  boost::replace_all(config, "sync-protocol psync\n", "sync-protocol psync\n  lsa-encoding compact\n");
+  BOOST_REQUIRE(processConfigurationString(config));
+  BOOST_CHECK_EQUAL(conf.isLsaEncodingCompact(), true);
+
+  boost::replace_all(config, "lsa-encoding compact", "lsa-encoding gzip");
+  BOOST_CHECK_EQUAL(processConfigurationString(config), false);
+}
+
 BOOST_AUTO_TEST_CASE(DefaultValuesNeighbors)
 {
   std::string config = SECTION_NEIGHBORS;
@@ -364,6 +378,224 @@ BOOST_AUTO_TEST_CASE(DefaultValuesHyperbolic)
   BOOST_CHECK_EQUAL(conf.getHyperbolicState(), HYPERBOLIC_STATE_DEFAULT);
 }
 
+BOOST_AUTO_TEST_CASE(Metrics)
+{
+  const std::string SECTION_METRICS =
+  "metrics\n"
+  "{\n"
+  "  prometheus-file /tmp/nlsr.prom\n"
+  "  prometheus-file-interval 30\n"
+  "  prometheus-socket /tmp/nlsr-metrics.sock\n"
+  "  event-loop-heartbeat 250\n"
+  "  slow-handler-threshold 20\n"
+  "}\n\n";
+
+  BOOST_REQUIRE(processConfigurationString(SECTION_METRICS));
+  BOOST_CHECK_EQUAL(conf.getMetricsFile(), "/tmp/nlsr.prom");
+  BOOST_CHECK_EQUAL(conf.getMetricsFileInterval(), 30_s);
+  BOOST_CHECK_EQUAL(conf.getMetricsSocket(), "/tmp/nlsr-metrics.sock");
+  BOOST_CHECK_EQUAL(conf.getEventLoopHeartbeat(), 250_ms);
+  BOOST_CHECK_EQUAL(conf.getSlowHandlerThreshold(), 20_ms);
+
+  std::string config = SECTION_METRICS;
+  commentOut("prometheus-file-interval", config);
+  commentOut("event-loop-heartbeat", config);
+  commentOut("slow-handler-threshold", config);
+  BOOST_REQUIRE(processConfigurationString(config));
+  BOOST_CHECK_EQUAL(conf.getMetricsFileInterval(), ndn::time::seconds(METRICS_FILE_INTERVAL_DEFAULT));
+  BOOST_CHECK_EQUAL(conf.getEventLoopHeartbeat(),
+                    ndn::time::milliseconds(EVENT_LOOP_HEARTBEAT_DEFAULT));
+  BOOST_CHECK_EQUAL(conf.getSlowHandlerThreshold(),
+                    ndn::time::milliseconds(SLOW_HANDLER_THRESHOLD_DEFAULT));
+}
+
+BOOST_AUTO_TEST_CASE(Admission)
+{
+  const std::string SECTION_ADMISSION =
+  "admission\n"
+  "{\n"
+  "  shed-lag 0\n"
+  "  per-source-rate 20\n"
+  "  per-source-burst 40\n"
+  "  max-queue-length 64\n"
+  "}\n\n";
+
+  BOOST_REQUIRE(processConfigurationString(SECTION_ADMISSION));
+  BOOST_CHECK_EQUAL(conf.getAdmissionShedLag(), 0_ms);
+  BOOST_CHECK_EQUAL(conf.getAdmissionSourceRate(), 20);
+  BOOST_CHECK_EQUAL(conf.getAdmissionSourceBurst(), 40);
+  BOOST_CHECK_EQUAL(conf.getAdmissionMaxQueueLength(), 64);
+
+  std::string config = SECTION_ADMISSION;
+  commentOut("shed-lag", config);
+  commentOut("per-source-rate", config);
+  BOOST_REQUIRE(processConfigurationString(config));
+  BOOST_CHECK_EQUAL(conf.getAdmissionShedLag(), ndn::time::milliseconds(ADMISSION_SHED_LAG_DEFAULT));
+  BOOST_CHECK_EQUAL(conf.getAdmissionSourceRate(), ADMISSION_SOURCE_RATE_DEFAULT);
+
+  config = SECTION_ADMISSION;
+  boost::replace_all(config, "max-queue-length 64", "max-queue-length 0");
+  BOOST_CHECK(!processConfigurationString(config));
+}
+
+BOOST_AUTO_TEST_CASE(Readvertise)
+{
+  const std::string SECTION_READVERTISE =
+  "readvertise\n"
+  "{\n"
+  "  hold-down 10\n"
+  "  max-changes-per-second 5\n"
+  "  aggregate /ndn/site/a\n"
+  "  aggregate /ndn/site/b\n"
+  "}\n\n";
+
+  BOOST_REQUIRE(processConfigurationString(SECTION_READVERTISE));
+  BOOST_CHECK_EQUAL(conf.getReadvertiseHoldDown(), 10_s);
+  BOOST_CHECK_EQUAL(conf.getReadvertiseMaxChangesPerSecond(), 5);
+  std::vector<ndn::Name> expected{"/ndn/site/a", "/ndn/site/b"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(conf.getReadvertiseAggregates().begin(),
+                                conf.getReadvertiseAggregates().end(),
+                                expected.begin(), expected.end());
+
+  std::string config = SECTION_READVERTISE;
+  boost::replace_all(config, "hold-down 10", "hold-down 9999");
+  BOOST_CHECK(!processConfigurationString(config));
+}
+
+BOOST_AUTO_TEST_CASE(Areas)
+{
+  std::string config = SECTION_GENERAL;
+  boost::replace_all(config, "  state-dir /tmp\n", "  area 0\n  area edge-1\n  state-dir /tmp\n");
+
+  BOOST_REQUIRE(processConfigurationString(config));
+  std::vector<std::string> expected{"0", "edge-1"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(conf.getAreas().begin(), conf.getAreas().end(),
+                                expected.begin(), expected.end());
+  BOOST_CHECK(conf.isAreaBorderRouter());
+}
+
+BOOST_AUTO_TEST_CASE(AreaBorderRouterWithoutBackbone)
+{
+  std::string config = SECTION_GENERAL;
+  boost::replace_all(config, "  state-dir /tmp\n", "  area 1\n  area 2\n  state-dir /tmp\n");
+  BOOST_CHECK(!processConfigurationString(config));
+}
+
+BOOST_AUTO_TEST_CASE(InvalidArea)
+{
+  std::string config = SECTION_GENERAL;
+  boost::replace_all(config, "  state-dir /tmp\n", "  area 1\n  area 1\n  state-dir /tmp\n");
+  BOOST_CHECK(!processConfigurationString(config));
+
+  config = SECTION_GENERAL;
+  boost::replace_all(config, "  state-dir /tmp\n", "  area a/b\n  state-dir /tmp\n");
+  BOOST_CHECK(!processConfigurationString(config));
+}
+
+BOOST_AUTO_TEST_CASE(AreasWithHyperbolic)
+{
+  std::string config = CONFIG_HYPERBOLIC;
+  boost::replace_all(config, "  state-dir /tmp\n", "  area 1\n  state-dir /tmp\n");
+  BOOST_CHECK(!processConfigurationString(config));
+}
+
+BOOST_AUTO_TEST_CASE(Topologies)
+{
+  const std::string SECTION_TOPOLOGIES =
+  "topologies\n"
+  "{\n"
+  "  topology\n"
+  "  {\n"
+  "    name latency\n"
+  "    prefix /ndn/edu/memphis/video\n"
+  "  }\n"
+  "  topology\n"
+  "  {\n"
+  "    name hops\n"
+  "    metric hop-count\n"
+  "    prefix /ndn/edu/memphis/chat\n"
+  "    prefix /ndn/edu/memphis/voice\n"
+  "  }\n"
+  "}\n\n";
+
+  std::string neighbors = SECTION_NEIGHBORS;
+  boost::replace_all(neighbors, "    link-cost 30\n", "    link-cost 30\n    topology-cost latency 12\n");
+
+  BOOST_REQUIRE(processConfigurationString(neighbors + SECTION_TOPOLOGIES));
+  BOOST_REQUIRE_EQUAL(conf.getTopologies().size(), 2);
+  BOOST_CHECK_EQUAL(conf.getTopologies()[0].name, "latency");
+  BOOST_CHECK(conf.getTopologies()[0].metric == TopologyMetric::LINK_COST);
+  BOOST_CHECK_EQUAL(conf.getTopologies()[1].name, "hops");
+  BOOST_CHECK(conf.getTopologies()[1].metric == TopologyMetric::HOP_COUNT);
+  BOOST_CHECK_EQUAL(conf.getTopologies()[1].prefixes.size(), 2);
+
+  Adjacent mira = conf.getAdjacencyList().getAdjacent("/ndn/memphis.edu/cs/mira");
+  BOOST_CHECK_EQUAL(mira.getTopologyCost("latency"), 12);
+  BOOST_CHECK_EQUAL(mira.getTopologyCost("hops"), 30);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidTopologies)
+{
+  const std::string SECTION_TOPOLOGIES =
+  "topologies\n"
+  "{\n"
+  "  topology\n"
+  "  {\n"
+  "    name latency\n"
+  "    metric link-cost\n"
+  "  }\n"
+  "}\n\n";
+
+  std::string config = SECTION_TOPOLOGIES;
+  boost::replace_all(config, "metric link-cost", "metric bandwidth");
+  BOOST_CHECK(!processConfigurationString(config));
+
+  config = SECTION_TOPOLOGIES;
+  boost::replace_all(config, "name latency", "name a/b");
+  BOOST_CHECK(!processConfigurationString(config));
+
+  config = SECTION_TOPOLOGIES;
+  boost::replace_all(config, "  }\n", "  }\n  topology\n  {\n    name latency\n  }\n");
+  BOOST_CHECK(!processConfigurationString(config));
+
+  BOOST_CHECK(!processConfigurationString(SECTION_HYPERBOLIC_ON + SECTION_TOPOLOGIES));
+}
+
+BOOST_AUTO_TEST_CASE(NoTransit)
+{
+  BOOST_REQUIRE(processConfigurationString(SECTION_NEIGHBORS));
+  BOOST_CHECK(!conf.isNoTransit());
+
+  std::string neighbors = SECTION_NEIGHBORS;
+  boost::replace_all(neighbors, "  adj-lsa-build-interval 10\n",
+                     "  adj-lsa-build-interval 10\n  no-transit on\n");
+  BOOST_REQUIRE(processConfigurationString(neighbors));
+  BOOST_CHECK(conf.isNoTransit());
+
+  boost::replace_all(neighbors, "no-transit on", "no-transit maybe");
+  BOOST_CHECK(!processConfigurationString(neighbors));
+}
+
+BOOST_AUTO_TEST_CASE(HelloFaceUri)
+{
+  std::string neighbors = SECTION_NEIGHBORS;
+  boost::replace_all(neighbors, "    link-cost 30\n",
+                     "    link-cost 30\n    hello-face-uri udp4://224.0.23.170:56363\n");
+  BOOST_REQUIRE(processConfigurationString(neighbors));
+
+  Adjacent castor = conf.getAdjacencyList().getAdjacent("/ndn/memphis.edu/cs/castor");
+  BOOST_CHECK(!castor.isHelloMulticast());
+  Adjacent mira = conf.getAdjacencyList().getAdjacent("/ndn/memphis.edu/cs/mira");
+  BOOST_CHECK(mira.isHelloMulticast());
+  BOOST_CHECK_EQUAL(mira.getHelloFaceUri(), ndn::FaceUri("udp4://224.0.23.170:56363"));
+
+  // a unicast face cannot reach every neighbor on the segment
+  neighbors = SECTION_NEIGHBORS;
+  boost::replace_all(neighbors, "    link-cost 30\n",
+                     "    link-cost 30\n    hello-face-uri udp4://10.0.0.3:6363\n");
+  BOOST_CHECK(!processConfigurationString(neighbors));
+}
+
 BOOST_AUTO_TEST_CASE(OutOfRangeValue)
 {
   const std::string SECTION_FIB_OUT_OF_RANGE =
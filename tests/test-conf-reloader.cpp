@@ -0,0 +1,157 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "conf-reloader.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/io-key-chain-fixture.hpp"
+
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+namespace nlsr::tests {
+
+class ConfReloaderFixture : public IoKeyChainFixture
+{
+public:
+  ConfReloaderFixture()
+    : face(m_io, m_keyChain)
+    , running(face, m_keyChain)
+    , candidate(face, m_keyChain)
+  {
+    for (auto* conf : {&running, &candidate}) {
+      conf->getAdjacencyList().insert(Adjacent("/ndn/site/%C1.Router/a",
+                                               ndn::FaceUri("udp4://10.0.0.1:6363"),
+                                               10, Adjacent::STATUS_INACTIVE, 0, 0));
+      conf->getAdjacencyList().insert(Adjacent("/ndn/site/%C1.Router/b",
+                                               ndn::FaceUri("udp4://10.0.0.2:6363"),
+                                               10, Adjacent::STATUS_INACTIVE, 0, 0));
+      conf->getNamePrefixList().insert("/prefix/1");
+      conf->getNamePrefixList().insert("/prefix/2");
+    }
+  }
+
+public:
+  ndn::DummyClientFace face;
+  ConfParameter running;
+  ConfParameter candidate;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestConfReloader, ConfReloaderFixture)
+
+BOOST_AUTO_TEST_CASE(Unchanged)
+{
+  ConfReloader reloader(running);
+  auto diff = reloader.computeDiff(candidate);
+  BOOST_CHECK(diff.empty());
+  BOOST_CHECK(diff.ignoredOptions.empty());
+}
+
+BOOST_AUTO_TEST_CASE(Neighbors)
+{
+  ConfReloader reloader(running);
+
+  // runtime changes of the running list are not configuration changes
+  running.getAdjacencyList().findAdjacent(ndn::Name("/ndn/site/%C1.Router/a"))->setLinkCost(42);
+
+  candidate.getAdjacencyList().findAdjacent(ndn::Name("/ndn/site/%C1.Router/a"))->setLinkCost(20);
+  candidate.getAdjacencyList().erase("/ndn/site/%C1.Router/b");
+  candidate.getAdjacencyList().insert(Adjacent("/ndn/site/%C1.Router/c",
+                                               ndn::FaceUri("udp4://10.0.0.3:6363"),
+                                               10, Adjacent::STATUS_INACTIVE, 0, 0));
+
+  auto diff = reloader.computeDiff(candidate);
+  BOOST_REQUIRE_EQUAL(diff.changedNeighbors.size(), 1);
+  BOOST_CHECK_EQUAL(diff.changedNeighbors.front().getName(), "/ndn/site/%C1.Router/a");
+  BOOST_CHECK_EQUAL(diff.changedNeighbors.front().getLinkCost(), 20);
+  BOOST_REQUIRE_EQUAL(diff.removedNeighbors.size(), 1);
+  BOOST_CHECK_EQUAL(diff.removedNeighbors.front(), "/ndn/site/%C1.Router/b");
+  BOOST_REQUIRE_EQUAL(diff.addedNeighbors.size(), 1);
+  BOOST_CHECK_EQUAL(diff.addedNeighbors.front().getName(), "/ndn/site/%C1.Router/c");
+  BOOST_CHECK(!diff.areTimersChanged);
+
+  reloader.commit(candidate);
+  BOOST_CHECK(reloader.computeDiff(candidate).empty());
+}
+
+BOOST_AUTO_TEST_CASE(FaceUriChanged)
+{
+  ConfReloader reloader(running);
+  candidate.getAdjacencyList().erase("/ndn/site/%C1.Router/b");
+  candidate.getAdjacencyList().insert(Adjacent("/ndn/site/%C1.Router/b",
+                                               ndn::FaceUri("udp4://10.0.0.9:6363"),
+                                               10, Adjacent::STATUS_INACTIVE, 0, 0));
+
+  auto diff = reloader.computeDiff(candidate);
+  BOOST_CHECK_EQUAL(diff.removedNeighbors.size(), 1);
+  BOOST_CHECK_EQUAL(diff.addedNeighbors.size(), 1);
+  BOOST_CHECK(diff.changedNeighbors.empty());
+}
+
+BOOST_AUTO_TEST_CASE(Prefixes)
+{
+  ConfReloader reloader(running);
+
+  // prefixes advertised at runtime are not part of the configuration
+  running.getNamePrefixList().insert("/prefix/runtime");
+
+  candidate.getNamePrefixList().erase("/prefix/1");
+  candidate.getNamePrefixList().insert("/prefix/3");
+
+  auto diff = reloader.computeDiff(candidate);
+  BOOST_REQUIRE_EQUAL(diff.addedPrefixes.size(), 1);
+  BOOST_CHECK_EQUAL(diff.addedPrefixes.front(), "/prefix/3");
+  BOOST_REQUIRE_EQUAL(diff.removedPrefixes.size(), 1);
+  BOOST_CHECK_EQUAL(diff.removedPrefixes.front(), "/prefix/1");
+}
+
+BOOST_AUTO_TEST_CASE(Timers)
+{
+  ConfReloader reloader(running);
+  candidate.setInfoInterestInterval(HELLO_INTERVAL_MAX);
+  candidate.setRoutingCalcInterval(ROUTING_CALC_INTERVAL_MIN);
+
+  auto diff = reloader.computeDiff(candidate);
+  BOOST_CHECK(diff.areTimersChanged);
+  BOOST_CHECK(!diff.empty());
+
+  reloader.commit(candidate);
+  BOOST_CHECK_EQUAL(running.getInfoInterestInterval(), HELLO_INTERVAL_MAX);
+  BOOST_CHECK_EQUAL(running.getRoutingCalcInterval(), ROUTING_CALC_INTERVAL_MIN);
+  BOOST_CHECK(reloader.computeDiff(candidate).empty());
+}
+
+BOOST_AUTO_TEST_CASE(RestartRequired)
+{
+  ConfReloader reloader(running);
+  candidate.setRouterName("/other");
+  candidate.buildRouterAndSyncUserPrefix();
+  candidate.setHyperbolicState(HYPERBOLIC_STATE_ON);
+
+  auto diff = reloader.computeDiff(candidate);
+  BOOST_CHECK(diff.empty());
+  std::vector<std::string> expected{"general.router", "hyperbolic"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(diff.ignoredOptions.begin(), diff.ignoredOptions.end(),
+                                expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nlsr::tests
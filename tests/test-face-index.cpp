@@ -0,0 +1,66 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face-index.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace nlsr::tests {
+
+BOOST_AUTO_TEST_SUITE(TestFaceIndex)
+
+BOOST_AUTO_TEST_CASE(Basic)
+{
+  FaceIndex index;
+
+  ndn::nfd::FaceStatus face1;
+  face1.setFaceId(1)
+    .setRemoteUri("udp4://192.168.0.100:6363");
+  ndn::nfd::FaceStatus face2;
+  face2.setFaceId(2)
+    .setRemoteUri("udp4://192.168.0.101:6363");
+  index.reset({face1, face2});
+
+  BOOST_CHECK_EQUAL(index.size(), 2);
+  BOOST_CHECK_EQUAL(index.getFaceId("udp4://192.168.0.100:6363"), 1);
+  BOOST_CHECK_EQUAL(index.getFaceId("udp4://192.168.0.102:6363"), 0);
+
+  // the most recent face to a remote endpoint is returned
+  index.insert("udp4://192.168.0.100:6363", 3);
+  BOOST_CHECK_EQUAL(index.getFaceId("udp4://192.168.0.100:6363"), 3);
+  BOOST_CHECK_EQUAL(index.size(), 3);
+
+  // destroying the older face does not hide the newer one
+  index.erase(1);
+  BOOST_CHECK_EQUAL(index.getFaceId("udp4://192.168.0.100:6363"), 3);
+
+  index.erase(2);
+  BOOST_CHECK_EQUAL(index.getFaceId("udp4://192.168.0.101:6363"), 0);
+  BOOST_CHECK_EQUAL(index.size(), 1);
+
+  index.reset({face2});
+  BOOST_CHECK(!index.contains(3));
+  BOOST_CHECK(index.contains(2));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nlsr::tests
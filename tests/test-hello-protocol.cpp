@@ -148,6 +148,165 @@ BOOST_AUTO_TEST_CASE(CheckHelloDataValidatedSignal) // # 5157
   BOOST_CHECK_EQUAL(adjList.getStatusOfNeighbor(adj1.getName()), Adjacent::STATUS_ACTIVE);
 }
 
+BOOST_AUTO_TEST_CASE(MulticastHello)
+{
+  conf.setInfoInterestInterval(60);
+  conf.setInterestRetryNumber(3);
+  conf.setAdjLsaBuildInterval(10);
+
+  const ndn::Name LAN_NEIGHBOR("/ndn/site/%C1.Router/router-lan");
+  Adjacent adj(LAN_NEIGHBOR, ndn::FaceUri("udp4://10.0.0.3:6363"), 10,
+               Adjacent::STATUS_INACTIVE, 0, 300);
+  adj.setHelloFaceUri(ndn::FaceUri("udp4://224.0.23.170:56363"));
+  adjList.insert(adj);
+
+  helloProtocol.startMulticastHello();
+  this->advanceClocks(10_ms);
+
+  // one Hello Interest on the shared segment, carrying the Hello Data of this router
+  int nMulticastHellos = 0;
+  for (const auto& interest : face.sentInterests) {
+    if (!conf.getHelloPrefix().isPrefixOf(interest.getName())) {
+      continue;
+    }
+    ++nMulticastHellos;
+    BOOST_REQUIRE(interest.hasApplicationParameters());
+    ndn::Data data(interest.getApplicationParameters().blockFromValue());
+    BOOST_CHECK_EQUAL(data.getName().getPrefix(-1),
+                      ndn::Name(conf.getRouterPrefix()).append(HelloProtocol::NLSR_COMPONENT)
+                        .append(HelloProtocol::INFO_COMPONENT)
+                        .append(HelloProtocol::MULTICAST_COMPONENT));
+  }
+  BOOST_CHECK_EQUAL(nMulticastHellos, 1);
+
+  // no unicast Hello to a neighbor on a shared segment
+  helloProtocol.sendHelloInterest(LAN_NEIGHBOR);
+  this->advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(checkHelloInterests(LAN_NEIGHBOR), 0);
+
+  ndn::Name dataName(LAN_NEIGHBOR);
+  dataName.append(HelloProtocol::NLSR_COMPONENT)
+          .append(HelloProtocol::INFO_COMPONENT)
+          .append(HelloProtocol::MULTICAST_COMPONENT);
+  helloProtocol.onContentValidated(ndn::Data(ndn::Name(dataName).appendVersion()));
+  BOOST_CHECK_EQUAL(adjList.getStatusOfNeighbor(LAN_NEIGHBOR), Adjacent::STATUS_ACTIVE);
+
+  // heard during the first interval, then silent for two more
+  this->advanceClocks(1_s, 180);
+  BOOST_CHECK_EQUAL(adjList.getStatusOfNeighbor(LAN_NEIGHBOR), Adjacent::STATUS_ACTIVE);
+  BOOST_CHECK_EQUAL(nlsr.m_lsdb.m_isBuildAdjLsaScheduled, false);
+
+  // down after hello-retries intervals without Hello
+  this->advanceClocks(1_s, 60);
+  BOOST_CHECK_EQUAL(adjList.getStatusOfNeighbor(LAN_NEIGHBOR), Adjacent::STATUS_INACTIVE);
+  BOOST_CHECK_EQUAL(nlsr.m_lsdb.m_isBuildAdjLsaScheduled, true);
+}
+
+BOOST_AUTO_TEST_CASE(ReceiveMulticastHello)
+{
+  conf.setInfoInterestInterval(60);
+  conf.getValidator().load("trust-anchor\n{\n  type any\n}\n", "test-hello-protocol");
+
+  const ndn::Name LAN_NEIGHBOR("/ndn/site/%C1.Router/router-lan");
+  Adjacent adj(LAN_NEIGHBOR, ndn::FaceUri("udp4://10.0.0.3:6363"), 10,
+               Adjacent::STATUS_INACTIVE, 0, 300);
+  adj.setHelloFaceUri(ndn::FaceUri("udp4://224.0.23.170:56363"));
+  adjList.insert(adj);
+
+  helloProtocol.startMulticastHello();
+  this->advanceClocks(10_ms);
+  face.sentInterests.clear();
+
+  // Hello of the neighbor: /localhop/<network>/nlsr/HELLO,
+  // carrying its Hello Data /<neighbor>/nlsr/INFO/multicast/<version>
+  ndn::Name dataName(LAN_NEIGHBOR);
+  dataName.append(HelloProtocol::NLSR_COMPONENT)
+          .append(HelloProtocol::INFO_COMPONENT)
+          .append(HelloProtocol::MULTICAST_COMPONENT)
+          .appendVersion();
+  ndn::Data data(dataName);
+  m_keyChain.sign(data);
+  ndn::Interest interest(conf.getHelloPrefix());
+  interest.setApplicationParameters(data.wireEncode());
+  face.receive(interest);
+  this->advanceClocks(10_ms);
+
+  BOOST_CHECK_EQUAL(helloProtocol.m_heardMulticastNeighbors.count(LAN_NEIGHBOR), 1);
+  BOOST_CHECK_EQUAL(adjList.getStatusOfNeighbor(LAN_NEIGHBOR), Adjacent::STATUS_ACTIVE);
+  BOOST_CHECK_EQUAL(adjList.findAdjacent(LAN_NEIGHBOR)->getTraffic().nReceivedPackets, 1);
+
+  // the neighbor was down: this router answers with its own multicast Hello right away
+  auto reply = std::find_if(face.sentInterests.begin(), face.sentInterests.end(),
+                            [&] (const auto& i) {
+                              return conf.getHelloPrefix().isPrefixOf(i.getName());
+                            });
+  BOOST_REQUIRE(reply != face.sentInterests.end());
+  BOOST_REQUIRE(reply->hasApplicationParameters());
+  ndn::Data replyData(reply->getApplicationParameters().blockFromValue());
+  BOOST_CHECK_EQUAL(replyData.getName().getPrefix(-1),
+                    ndn::Name(conf.getRouterPrefix()).append(HelloProtocol::NLSR_COMPONENT)
+                      .append(HelloProtocol::INFO_COMPONENT)
+                      .append(HelloProtocol::MULTICAST_COMPONENT));
+  BOOST_CHECK(replyData.getName()[-1].isVersion());
+
+  // a Hello of a router that is not a multicast neighbor is ignored
+  ndn::Name strangerName("/ndn/site/%C1.Router/stranger");
+  strangerName.append(HelloProtocol::NLSR_COMPONENT)
+              .append(HelloProtocol::INFO_COMPONENT)
+              .append(HelloProtocol::MULTICAST_COMPONENT)
+              .appendVersion();
+  ndn::Data stranger(strangerName);
+  m_keyChain.sign(stranger);
+  ndn::Interest strangerHello(conf.getHelloPrefix());
+  strangerHello.setApplicationParameters(stranger.wireEncode());
+  face.receive(strangerHello);
+  this->advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(helloProtocol.m_heardMulticastNeighbors.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ReplayedMulticastHello)
+{
+  conf.setInfoInterestInterval(60);
+  conf.getValidator().load("trust-anchor\n{\n  type any\n}\n", "test-hello-protocol");
+
+  const ndn::Name LAN_NEIGHBOR("/ndn/site/%C1.Router/router-lan");
+  Adjacent adj(LAN_NEIGHBOR, ndn::FaceUri("udp4://10.0.0.3:6363"), 10,
+               Adjacent::STATUS_INACTIVE, 0, 300);
+  adj.setHelloFaceUri(ndn::FaceUri("udp4://224.0.23.170:56363"));
+  adjList.insert(adj);
+
+  helloProtocol.startMulticastHello();
+  this->advanceClocks(10_ms);
+
+  auto makeHello = [&] (uint64_t version) {
+    ndn::Name dataName(LAN_NEIGHBOR);
+    dataName.append(HelloProtocol::NLSR_COMPONENT)
+            .append(HelloProtocol::INFO_COMPONENT)
+            .append(HelloProtocol::MULTICAST_COMPONENT)
+            .appendVersion(version);
+    ndn::Data data(dataName);
+    m_keyChain.sign(data);
+    ndn::Interest interest(conf.getHelloPrefix());
+    interest.setApplicationParameters(data.wireEncode());
+    return interest;
+  };
+
+  face.receive(makeHello(100));
+  this->advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(helloProtocol.m_heardMulticastNeighbors.count(LAN_NEIGHBOR), 1);
+
+  // a replayed or older Hello does not count as hearing from the neighbor
+  helloProtocol.onMulticastHelloInterval();
+  face.receive(makeHello(100));
+  face.receive(makeHello(99));
+  this->advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(helloProtocol.m_heardMulticastNeighbors.count(LAN_NEIGHBOR), 0);
+
+  face.receive(makeHello(101));
+  this->advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(helloProtocol.m_heardMulticastNeighbors.count(LAN_NEIGHBOR), 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
@@ -20,6 +20,7 @@
  */
 
 #include "nlsr.hpp"
+#include "area.hpp"
 #include "security/certificate-store.hpp"
 
 #include "tests/io-key-chain-fixture.hpp"
@@ -47,7 +48,8 @@ public:
     , confParam(face, m_keyChain)
     , confProcessor(confParam, SyncProtocol::PSYNC, HYPERBOLIC_STATE_OFF,
                     "/ndn/", "/edu/test-site", "/%C1.Router/router1")
-    , lsdb(face, m_keyChain, confParam)
+    , admission(m_io, confParam)
+    , lsdb(face, m_keyChain, confParam, stats, admission)
     , ROOT_CERT_PATH(std::filesystem::current_path() / "root.cert")
   {
     rootId = m_keyChain.createIdentity(rootIdName);
@@ -90,6 +92,8 @@ public:
   ndn::security::pib::Identity rootId, siteIdentity, opIdentity, routerId;
   ConfParameter confParam;
   DummyConfFileProcessor confProcessor;
+  Statistics stats;
+  AdmissionController admission;
   Lsdb lsdb;
 
   const std::filesystem::path ROOT_CERT_PATH;
@@ -153,6 +157,49 @@ BOOST_AUTO_TEST_CASE(DoNotValidateIncorrectLSA)
                                     });
 }
 
+BOOST_AUTO_TEST_CASE(ValidateSummaryLSA)
+{
+  // /<lsaPrefix>/<site>/<router>/%C1.Summary/<area>/NAME/<seqNo>/<version>/<segmentNo>
+  ndn::Name lsaDataName = confParam.getLsaPrefix();
+  ndn::Name router = confParam.getSiteName();
+  router.append(confParam.getRouterName());
+  lsaDataName.append(area::makeSummaryOrigin(router, "1"));
+  lsaDataName.append(boost::lexical_cast<std::string>(Lsa::Type::NAME));
+  lsaDataName.appendNumber(lsdb.m_sequencingManager.getNameLsaSeq());
+  lsaDataName.appendNumber(1).appendNumber(1);
+
+  ndn::Data data(lsaDataName);
+  data.setFreshnessPeriod(10_s);
+  m_keyChain.sign(data, confParam.getSigningInfo());
+
+  confParam.getValidator().validate(data,
+                                    [] (const Data&) { BOOST_CHECK(true); },
+                                    [] (const Data&, const ndn::security::ValidationError& e) {
+                                      BOOST_ERROR(e);
+                                    });
+}
+
+BOOST_AUTO_TEST_CASE(DoNotValidateSummaryLSAOfOtherRouter)
+{
+  // Summary of another router, signed with the key of this router
+  ndn::Name lsaDataName = confParam.getLsaPrefix();
+  lsaDataName.append(confParam.getSiteName());
+  lsaDataName.append(area::makeSummaryOrigin("/%C1.Router/router2", "1"));
+  lsaDataName.append(boost::lexical_cast<std::string>(Lsa::Type::NAME));
+  lsaDataName.appendNumber(1);
+  lsaDataName.appendNumber(1).appendNumber(1);
+
+  ndn::Data data(lsaDataName);
+  data.setFreshnessPeriod(10_s);
+  m_keyChain.sign(data, confParam.getSigningInfo());
+
+  confParam.getValidator().validate(data,
+                                    [] (const Data&) { BOOST_CHECK(false); },
+                                    [] (const Data&, const ndn::security::ValidationError&) {
+                                      BOOST_CHECK(true);
+                                    });
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
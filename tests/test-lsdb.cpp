@@ -20,6 +20,7 @@
  */
 
 #include "lsdb.hpp"
+#include "admission-controller.hpp"
 #include "lsa/lsa.hpp"
 #include "name-prefix-list.hpp"
 
@@ -41,7 +42,8 @@ public:
     : face(m_io, m_keyChain, {true, true})
     , conf(face, m_keyChain)
     , confProcessor(conf)
-    , lsdb(face, m_keyChain, conf)
+    , admission(m_io, conf)
+    , lsdb(face, m_keyChain, conf, stats, admission)
   {
     m_keyChain.createIdentity("/ndn/site/%C1.Router/this-router");
 
@@ -98,6 +100,8 @@ public:
   ndn::DummyClientFace face;
   ConfParameter conf;
   DummyConfFileProcessor confProcessor;
+  Statistics stats;
+  AdmissionController admission;
   Lsdb lsdb;
 
   LsdbUpdate updateTypeCheck = LsdbUpdate::INSTALLED;
@@ -208,7 +212,9 @@ BOOST_AUTO_TEST_CASE(LsdbSegmentedData)
             )CONF";
   conf2.getValidator().load(config, "config-file-from-string");
 
-  Lsdb lsdb2(face2, m_keyChain, conf2);
+  Statistics stats2;
+  AdmissionController admission2(m_io, conf2);
+  Lsdb lsdb2(face2, m_keyChain, conf2, stats2, admission2);
 
   advanceClocks(ndn::time::milliseconds(10), 10);
 
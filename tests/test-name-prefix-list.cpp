@@ -140,6 +140,41 @@ BOOST_AUTO_TEST_CASE(OperatorEquals)
   BOOST_CHECK_EQUAL(list1, list2);
 }
 
+/*
+  Names are kept in canonical order regardless of insertion order, and
+  mergeFrom reports the names added and removed in a single pass.
+ */
+BOOST_AUTO_TEST_CASE(MergeFrom)
+{
+  NamePrefixList list{"/c", "/a", "/d"};
+  list.insert("/b", "readvertise", 5);
+  BOOST_TEST(list.getNames() == (std::list<ndn::Name>{"/a", "/b", "/c", "/d"}),
+             boost::test_tools::per_element());
+
+  NamePrefixList other;
+  other.insert(PrefixInfo("/b", 7));
+  other.insert(PrefixInfo("/d", 0));
+  other.insert(PrefixInfo("/e", 3));
+
+  std::vector<PrefixInfo> added;
+  std::vector<PrefixInfo> removed;
+  BOOST_CHECK(list.mergeFrom(other,
+                             [&] (const PrefixInfo& info) { added.push_back(info); },
+                             [&] (const PrefixInfo& info) { removed.push_back(info); }));
+  BOOST_TEST(added == (std::vector<PrefixInfo>{{"/e", 3}}), boost::test_tools::per_element());
+  BOOST_TEST(removed == (std::vector<PrefixInfo>{{"/a", 0}, {"/c", 0}}),
+             boost::test_tools::per_element());
+
+  // Names present on both sides keep their cost and sources
+  BOOST_CHECK_EQUAL(list.getPrefixInfoForName("/b").getCost(), 5);
+  BOOST_TEST(list.getSources("/b") == (std::set<std::string>{"readvertise"}),
+             boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(list.size(), 3);
+
+  NamePrefixList copy = list;
+  BOOST_CHECK(!list.mergeFrom(copy, [] (const auto&) {}, [] (const auto&) {}));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
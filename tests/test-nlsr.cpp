@@ -20,12 +20,19 @@
  */
 
 #include "nlsr.hpp"
+#include "conf-file-processor.hpp"
 #include "logger.hpp"
 
 #include "tests/io-key-chain-fixture.hpp"
 #include "tests/test-common.hpp"
 
+#include <ndn-cxx/lp/nack.hpp>
 #include <ndn-cxx/mgmt/nfd/face-event-notification.hpp>
+#include <ndn-cxx/util/logging.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
 
 namespace nlsr::tests {
 
@@ -595,6 +602,192 @@ BOOST_AUTO_TEST_CASE(FaceDatasetPeriodicFetch)
   BOOST_CHECK_EQUAL(nNameMatches, 2);
 }
 
+BOOST_AUTO_TEST_CASE(FaceDatasetNoPeriodicFetch)
+{
+  ndn::Name datasetPrefix("/localhost/nfd/faces/list");
+  auto countFetches = [&] {
+    return std::count_if(m_face.sentInterests.begin(), m_face.sentInterests.end(),
+                         [&] (const auto& interest) { return datasetPrefix.isPrefixOf(interest.getName()); });
+  };
+
+  int fetchInterval(1);
+  conf.setFaceDatasetFetchInterval(fetchInterval);
+
+  this->advanceClocks(100_ms, 5);
+  BOOST_CHECK_EQUAL(countFetches(), 1);
+
+  ndn::nfd::FaceStatus payload;
+  payload.setFaceId(25401)
+    .setRemoteUri("udp4://192.168.0.100:6363");
+  this->sendDataset(datasetPrefix, payload);
+  this->advanceClocks(100_ms, 5);
+
+  // Once the dataset has been received, face notifications keep the face table up to date
+  this->advanceClocks(1_s, 10 * fetchInterval);
+  BOOST_CHECK_EQUAL(countFetches(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(FaceResyncAfterNotificationGap)
+{
+  ndn::Name datasetPrefix("/localhost/nfd/faces/list");
+  auto countFetches = [&] {
+    return std::count_if(m_face.sentInterests.begin(), m_face.sentInterests.end(),
+                         [&] (const auto& interest) { return datasetPrefix.isPrefixOf(interest.getName()); });
+  };
+
+  Adjacent neighborA("/ndn/neighborA", ndn::FaceUri("udp4://192.168.0.100:6363"),
+                     25, Adjacent::STATUS_INACTIVE, 0, 0);
+  neighbors.insert(neighborA);
+
+  this->advanceClocks(100_ms, 5);
+  ndn::nfd::FaceStatus payload;
+  payload.setFaceId(25401)
+    .setRemoteUri("udp4://192.168.0.100:6363");
+  this->sendDataset(datasetPrefix, payload);
+  this->advanceClocks(100_ms, 5);
+  BOOST_CHECK_EQUAL(neighbors.getAdjacent("/ndn/neighborA").getFaceId(), 25401);
+  BOOST_CHECK_EQUAL(countFetches(), 1);
+
+  // Notifications may have been lost: NLSR must fetch the dataset again
+  auto it = std::find_if(m_face.sentInterests.rbegin(), m_face.sentInterests.rend(),
+                         [] (const auto& interest) {
+                           return ndn::Name("/localhost/nfd/faces/events").isPrefixOf(interest.getName());
+                         });
+  BOOST_REQUIRE(it != m_face.sentInterests.rend());
+  ndn::lp::Nack nack(*it);
+  nack.setReason(ndn::lp::NackReason::NO_ROUTE);
+  m_face.receive(nack);
+
+  this->advanceClocks(100_ms, 20);
+  BOOST_CHECK_EQUAL(countFetches(), 2);
+
+  // The face was destroyed while notifications were not being received
+  ndn::nfd::FaceStatus otherFace;
+  otherFace.setFaceId(25402)
+    .setRemoteUri("udp4://192.168.0.101:6363");
+  this->sendDataset(datasetPrefix, otherFace);
+  this->advanceClocks(100_ms, 5);
+  BOOST_CHECK_EQUAL(neighbors.getAdjacent("/ndn/neighborA").getFaceId(), 0);
+}
+
+static std::string
+makeReloadConf(int helloInterval, const std::string& neighbor, const std::string& prefix,
+               int syncInterestLifetime)
+{
+  return "general\n"
+         "{\n"
+         "  network /ndn\n"
+         "  site /site\n"
+         "  router /%C1.Router/this-router\n"
+         "  sync-interest-lifetime " + std::to_string(syncInterestLifetime) + "\n"
+         "  state-dir /tmp\n"
+         "}\n"
+         "neighbors\n"
+         "{\n"
+         "  hello-interval " + std::to_string(helloInterval) + "\n"
+         "  neighbor\n"
+         "  {\n"
+         "    name " + neighbor + "\n"
+         "    face-uri udp4://10.0.0.1:6363\n"
+         "    link-cost 20\n"
+         "  }\n"
+         "}\n"
+         "hyperbolic\n"
+         "{\n"
+         "  state off\n"
+         "}\n"
+         "advertising\n"
+         "{\n"
+         "  prefix " + prefix + "\n"
+         "}\n";
+}
+
+BOOST_AUTO_TEST_CASE(ReloadConfiguration)
+{
+  const std::string confFile = "unit-test-nlsr-reload.conf";
+  auto writeConf = [&] (const std::string& content) {
+    std::ofstream(confFile) << content;
+  };
+  auto isAdvertised = [] (const ConfParameter& conf, const ndn::Name& prefix) {
+    auto names = conf.getNamePrefixList().getNames();
+    return std::find(names.begin(), names.end(), prefix) != names.end();
+  };
+
+  writeConf(makeReloadConf(60, "/ndn/site/%C1.Router/a", "/prefix/old", 10000));
+  ConfParameter conf2(m_face, m_keyChain, confFile);
+  BOOST_REQUIRE(ConfFileProcessor(conf2).processConfFile());
+  Nlsr nlsr2(m_face, m_keyChain, conf2);
+
+  BOOST_CHECK_EQUAL(conf2.getInfoInterestInterval(), 60);
+  BOOST_CHECK(conf2.getAdjacencyList().isNeighbor("/ndn/site/%C1.Router/a"));
+  BOOST_CHECK(isAdvertised(conf2, "/prefix/old"));
+
+  std::ostringstream log;
+  ndn::util::Logging::setLevel("nlsr.Nlsr", ndn::util::LogLevel::WARN);
+  ndn::util::Logging::setDestination(log, true);
+
+  // neighbor a is replaced by b, /prefix/old by /prefix/new, and the sync Interest
+  // lifetime, which cannot change at runtime, is modified as well
+  writeConf(makeReloadConf(30, "/ndn/site/%C1.Router/b", "/prefix/new", 20000));
+  BOOST_CHECK(nlsr2.reloadConfiguration());
+  this->advanceClocks(10_ms);
+  ndn::util::Logging::flush();
+
+  BOOST_CHECK_EQUAL(conf2.getInfoInterestInterval(), 30);
+  BOOST_CHECK(!conf2.getAdjacencyList().isNeighbor("/ndn/site/%C1.Router/a"));
+  BOOST_CHECK(conf2.getAdjacencyList().isNeighbor("/ndn/site/%C1.Router/b"));
+  BOOST_CHECK(!isAdvertised(conf2, "/prefix/old"));
+  BOOST_CHECK(isAdvertised(conf2, "/prefix/new"));
+
+  BOOST_CHECK_EQUAL(conf2.getSyncInterestLifetime(), 10000_ms);
+  BOOST_CHECK(log.str().find("general.sync-interest-lifetime") != std::string::npos);
+
+  // an invalid file leaves the running configuration untouched
+  writeConf("general\n{\n");
+  BOOST_CHECK(!nlsr2.reloadConfiguration());
+  BOOST_CHECK_EQUAL(conf2.getInfoInterestInterval(), 30);
+  BOOST_CHECK(conf2.getAdjacencyList().isNeighbor("/ndn/site/%C1.Router/b"));
+
+  ndn::util::Logging::setLevel("nlsr.Nlsr", ndn::util::LogLevel::NONE);
+  ndn::util::Logging::setDestination(std::clog, true);
+  std::remove(confFile.data());
+}
+
+BOOST_AUTO_TEST_CASE(ReloadReAddedNeighbor)
+{
+  const std::string confFile = "unit-test-nlsr-reload.conf";
+  const std::string neighbor = "/ndn/site/%C1.Router/a";
+  auto writeConf = [&] (const std::string& neighborName) {
+    std::ofstream(confFile) << makeReloadConf(60, neighborName, "/prefix", 10000);
+  };
+
+  writeConf(neighbor);
+  ConfParameter conf2(m_face, m_keyChain, confFile);
+  BOOST_REQUIRE(ConfFileProcessor(conf2).processConfFile());
+  Nlsr nlsr2(m_face, m_keyChain, conf2);
+  auto& linkCostManager = nlsr2.getLinkCostManager();
+  linkCostManager.onNeighborStatusChanged(neighbor, Adjacent::STATUS_ACTIVE);
+
+  // the neighbor is removed and added back before its pending RTT measurement fires
+  writeConf("/ndn/site/%C1.Router/b");
+  BOOST_CHECK(nlsr2.reloadConfiguration());
+  writeConf(neighbor);
+  BOOST_CHECK(nlsr2.reloadConfiguration());
+  linkCostManager.onNeighborStatusChanged(neighbor, Adjacent::STATUS_ACTIVE);
+
+  // measurements are at least 10 seconds apart, so a single chain probes once
+  m_face.sentInterests.clear();
+  this->advanceClocks(100_ms, 16_s);
+  ndn::Name probePrefix = ndn::Name(neighbor).append("link-cost").append("rtt-probe");
+  auto nProbes = std::count_if(m_face.sentInterests.begin(), m_face.sentInterests.end(),
+                               [&] (const ndn::Interest& interest) {
+                                 return probePrefix.isPrefixOf(interest.getName());
+                               });
+  BOOST_CHECK_EQUAL(nProbes, 1);
+
+  std::remove(confFile.data());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
@@ -23,9 +23,12 @@
 
 #include "tests/boost-test.hpp"
 
+#include <atomic>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <system_error>
+#include <thread>
 
 namespace nlsr::tests {
 
@@ -53,6 +56,13 @@ public:
     m_seqManager.initiateSeqNoFromFile();
   }
 
+  std::string
+  readFile()
+  {
+    std::ifstream inputFile(m_seqFile);
+    return std::string(std::istreambuf_iterator<char>(inputFile), {});
+  }
+
   void
   checkSeqNumbers(const uint64_t& name, const uint64_t& adj, const uint64_t& cor)
   {
@@ -96,6 +106,67 @@ BOOST_AUTO_TEST_CASE(CorruptFile)
   checkSeqNumbers(10, 10, 0);
 }
 
+BOOST_AUTO_TEST_CASE(BlockReservation)
+{
+  writeToFile("NameLsaSeq 100\nAdjLsaSeq 100\nCorLsaSeq 0");
+  initiateFromFile();
+  checkSeqNumbers(110, 110, 0);
+
+  // past the bounds on disk after a restart: the new reservation is written right away
+  m_seqManager.increaseNameLsaSeq();
+  m_seqManager.writeSeqNoToFile();
+  BOOST_CHECK_EQUAL(readFile(), "NameLsaSeq 1111\nAdjLsaSeq 1110\nCorLsaSeq 0");
+
+  // numbers are then handed out from memory until half of the block is used
+  writeToFile("unchanged");
+  for (int i = 0; i < 500; ++i) {
+    m_seqManager.increaseNameLsaSeq();
+    m_seqManager.writeSeqNoToFile();
+  }
+  m_seqManager.flush();
+  BOOST_CHECK_EQUAL(readFile(), "unchanged");
+
+  m_seqManager.increaseNameLsaSeq();
+  m_seqManager.writeSeqNoToFile();
+  m_seqManager.flush();
+  BOOST_CHECK_EQUAL(readFile(), "NameLsaSeq 1612\nAdjLsaSeq 1110\nCorLsaSeq 0");
+
+  // a restart resumes from the reserved bounds
+  initiateFromFile();
+  checkSeqNumbers(1622, 1120, 0);
+}
+
+BOOST_AUTO_TEST_CASE(SlowReservation)
+{
+  writeToFile("NameLsaSeq 100\nAdjLsaSeq 100\nCorLsaSeq 0");
+  initiateFromFile();
+  m_seqManager.setNameLsaSeq(600);
+  m_seqManager.writeSeqNoToFile();
+  BOOST_CHECK_EQUAL(readFile(), "NameLsaSeq 1600\nAdjLsaSeq 1110\nCorLsaSeq 0");
+
+  // the next reservation is queued behind a stalled write
+  std::promise<void> unblock;
+  m_seqManager.m_ioWorker.post([isUnblocked = unblock.get_future().share()] {
+    isUnblocked.wait();
+  });
+  m_seqManager.setNameLsaSeq(1101);
+  m_seqManager.writeSeqNoToFile();
+  BOOST_CHECK_EQUAL(readFile(), "NameLsaSeq 1600\nAdjLsaSeq 1110\nCorLsaSeq 0");
+
+  // numbers past the bound on disk are not handed out until the new one is written
+  std::atomic<bool> hasUnblocked{false};
+  std::thread unblocker([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    hasUnblocked = true;
+    unblock.set_value();
+  });
+  m_seqManager.setNameLsaSeq(1601);
+  m_seqManager.writeSeqNoToFile();
+  BOOST_CHECK(hasUnblocked);
+  BOOST_CHECK_EQUAL(readFile(), "NameLsaSeq 2101\nAdjLsaSeq 1110\nCorLsaSeq 0");
+  unblocker.join();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
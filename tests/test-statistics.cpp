@@ -30,6 +30,8 @@
 
 #include <boost/lexical_cast.hpp>
 
+#include <sstream>
+
 namespace nlsr::tests {
 
 class StatisticsFixture : public IoKeyChainFixture
@@ -42,7 +44,7 @@ public:
     , nlsr(face, m_keyChain, conf)
     , lsdb(nlsr.m_lsdb)
     , hello(nlsr.m_helloProtocol)
-    , collector(nlsr.m_statsCollector)
+    , statistics(nlsr.m_statistics)
   {
     // Otherwise code coverage node fails with default 60 seconds lifetime
     conf.setSyncInterestLifetime(1000);
@@ -63,7 +65,7 @@ public:
    * \param sentDataType is the Statistics::PacketType data being sent upon interest process
    *
    * This is a general function that can be used for all three types of lsa. Calling processInterest()
-   * from lsdb will cause the statsCollector to increment the incoming interest type and increment the
+   * from lsdb will cause the Statistics to increment the incoming interest type and increment the
    * outgoing data type.
    */
   void
@@ -73,15 +75,15 @@ public:
                                    Statistics::PacketType receivedInterestType,
                                    Statistics::PacketType sentDataType)
   {
-    size_t rcvBefore = collector.getStatistics().get(receivedInterestType);
-    size_t sentBefore = collector.getStatistics().get(sentDataType);
+    size_t rcvBefore = statistics.get(receivedInterestType);
+    size_t sentBefore = statistics.get(sentDataType);
 
     ndn::Name interestName = ndn::Name(ndn::Name(interestPrefix + lsaType).appendNumber(seqNo));
     lsdb.processInterest(ndn::Name(), ndn::Interest(interestName));
     this->advanceClocks(ndn::time::milliseconds(1), 10);
 
-    BOOST_CHECK_EQUAL(collector.getStatistics().get(receivedInterestType), rcvBefore + 1);
-    BOOST_CHECK_EQUAL(collector.getStatistics().get(sentDataType), sentBefore + 1);
+    BOOST_CHECK_EQUAL(statistics.get(receivedInterestType), rcvBefore + 1);
+    BOOST_CHECK_EQUAL(statistics.get(sentDataType), sentBefore + 1);
   }
 
   /*!
@@ -101,13 +103,13 @@ public:
                             uint32_t seqNo,
                             Statistics::PacketType statsType)
   {
-    size_t sentBefore = collector.getStatistics().get(statsType);
+    size_t sentBefore = statistics.get(statsType);
 
     lsdb.expressInterest(ndn::Name(prefix + lsaType).appendNumber(seqNo), 0, 0,
                          ndn::time::steady_clock::time_point::min());
     this->advanceClocks(ndn::time::milliseconds(1), 10);
 
-    BOOST_CHECK_EQUAL(collector.getStatistics().get(statsType), sentBefore + 1);
+    BOOST_CHECK_EQUAL(statistics.get(statsType), sentBefore + 1);
   }
 
 public:
@@ -118,7 +120,7 @@ public:
 
   Lsdb& lsdb;
   HelloProtocol& hello;
-  StatsCollector& collector;
+  Statistics& statistics;
 };
 
 BOOST_FIXTURE_TEST_SUITE(TestStatistics, StatisticsFixture)
@@ -145,6 +147,56 @@ BOOST_AUTO_TEST_CASE(StatsReset)
   BOOST_CHECK_EQUAL(stats.get(Statistics::PacketType::SENT_HELLO_INTEREST), 0);
 }
 
+BOOST_AUTO_TEST_CASE(NeighborTraffic)
+{
+  AdjacencyList adjacencies;
+  adjacencies.insert(Adjacent("/ndn/router/a"));
+  adjacencies.insert(Adjacent("/ndn/router/b"));
+  adjacencies.insert(Adjacent("/ndn/router/c"));
+
+  auto& a = adjacencies.findAdjacent(ndn::Name("/ndn/router/a"))->getTraffic();
+  a.recordSent(100);
+  a.recordReceived(40);
+  adjacencies.findAdjacent(ndn::Name("/ndn/router/b"))->getTraffic().recordReceived(60);
+
+  BOOST_CHECK_EQUAL(a.nSentPackets, 1);
+  BOOST_CHECK_EQUAL(a.nSentBytes, 100);
+  BOOST_CHECK_EQUAL(a.nReceivedBytes, 40);
+  BOOST_CHECK(adjacencies.findAdjacent(ndn::Name("/ndn/router/c"))->getTraffic().isEmpty());
+
+  Statistics stats;
+  std::ostringstream os;
+  printStatistics(os, stats, adjacencies);
+  BOOST_CHECK(os.str().find("/ndn/router/a") != std::string::npos);
+  BOOST_CHECK(os.str().find("/ndn/router/b") != std::string::npos);
+  // Neighbors without traffic are not listed
+  BOOST_CHECK(os.str().find("/ndn/router/c") == std::string::npos);
+
+  os.str("");
+  os << stats;
+  BOOST_CHECK(os.str().find("NEIGHBORS") == std::string::npos);
+}
+
+// Rates only account for packets recorded within the sliding window.
+BOOST_AUTO_TEST_CASE(SlidingWindow)
+{
+  SlidingWindowRate rate;
+  const double windowSeconds = SlidingWindowRate::WINDOW.count();
+
+  rate.record(1000, ndn::time::steady_clock::now());
+  rate.record(500, ndn::time::steady_clock::now());
+  BOOST_CHECK_CLOSE(rate.getPacketRate(ndn::time::steady_clock::now()), 2 / windowSeconds, 0.001);
+  BOOST_CHECK_CLOSE(rate.getByteRate(ndn::time::steady_clock::now()), 1500 / windowSeconds, 0.001);
+
+  this->advanceClocks(SlidingWindowRate::SLOT_DURATION);
+  rate.record(100, ndn::time::steady_clock::now());
+  BOOST_CHECK_CLOSE(rate.getPacketRate(ndn::time::steady_clock::now()), 3 / windowSeconds, 0.001);
+
+  this->advanceClocks(SlidingWindowRate::WINDOW);
+  BOOST_CHECK_EQUAL(rate.getPacketRate(ndn::time::steady_clock::now()), 0);
+  BOOST_CHECK_EQUAL(rate.getByteRate(ndn::time::steady_clock::now()), 0);
+}
+
 /*
  * This tests hello interests and hello data statistical collection by constructing an adjacency lsa
  * and calling functions that trigger the sending and receiving hello of interests/data.
@@ -164,7 +216,18 @@ BOOST_AUTO_TEST_CASE(SendHelloInterest)
   hello.expressInterest(otherName, 1);
   this->advanceClocks(ndn::time::milliseconds(1), 10);
 
-  BOOST_CHECK_EQUAL(collector.getStatistics().get(Statistics::PacketType::SENT_HELLO_INTEREST), 1);
+  BOOST_CHECK_EQUAL(statistics.get(Statistics::PacketType::SENT_HELLO_INTEREST), 1);
+
+  auto adjacent = conf.getAdjacencyList().findAdjacent(other.getName());
+  BOOST_REQUIRE(adjacent != conf.getAdjacencyList().end());
+  const auto* traffic = &adjacent->getTraffic();
+  auto helloInterest = std::find_if(face.sentInterests.begin(), face.sentInterests.end(),
+                                    [&] (const auto& i) { return i.getName() == otherName; });
+  BOOST_REQUIRE(helloInterest != face.sentInterests.end());
+  BOOST_CHECK_EQUAL(traffic->nSentPackets, 1);
+  BOOST_CHECK_EQUAL(traffic->nSentBytes, helloInterest->wireEncode().size());
+  size_t helloInterestBytes = traffic->nSentBytes;
+  BOOST_CHECK_EQUAL(traffic->nReceivedPackets, 0);
 
   ndn::Name thisName(conf.getRouterPrefix());
   thisName.append("NLSR");
@@ -176,8 +239,13 @@ BOOST_AUTO_TEST_CASE(SendHelloInterest)
 
   this->advanceClocks(ndn::time::milliseconds(1), 10);
 
-  BOOST_CHECK_EQUAL(collector.getStatistics().get(Statistics::PacketType::RCV_HELLO_INTEREST), 1);
-  BOOST_CHECK_EQUAL(collector.getStatistics().get(Statistics::PacketType::SENT_HELLO_DATA), 1);
+  BOOST_CHECK_EQUAL(statistics.get(Statistics::PacketType::RCV_HELLO_INTEREST), 1);
+  BOOST_CHECK_EQUAL(statistics.get(Statistics::PacketType::SENT_HELLO_DATA), 1);
+
+  BOOST_CHECK_EQUAL(traffic->nReceivedPackets, 1);
+  BOOST_CHECK_EQUAL(traffic->nReceivedBytes, interest.wireEncode().size());
+  BOOST_CHECK_EQUAL(traffic->nSentPackets, 2);
+  BOOST_CHECK_GT(traffic->nSentBytes, helloInterestBytes);
 
   // Receive Hello Data
   ndn::Name dataName = otherName;
@@ -185,7 +253,7 @@ BOOST_AUTO_TEST_CASE(SendHelloInterest)
   ndn::Data data(dataName);
   hello.onContentValidated(data);
 
-  BOOST_CHECK_EQUAL(collector.getStatistics().get(Statistics::PacketType::RCV_HELLO_DATA), 1);
+  BOOST_CHECK_EQUAL(statistics.get(Statistics::PacketType::RCV_HELLO_DATA), 1);
 }
 
 /*
@@ -210,7 +278,7 @@ BOOST_AUTO_TEST_CASE(LsdbSendLsaInterest)
                             seqNo, Statistics::PacketType::SENT_NAME_LSA_INTEREST);
 
   // 3 total lsa interests were sent
-  BOOST_CHECK_EQUAL(collector.getStatistics().get(Statistics::PacketType::SENT_LSA_INTEREST), 3);
+  BOOST_CHECK_EQUAL(statistics.get(Statistics::PacketType::SENT_LSA_INTEREST), 3);
 }
 
 /*
@@ -279,10 +347,10 @@ BOOST_AUTO_TEST_CASE(LsdbReceiveInterestSendData)
                                    Statistics::PacketType::SENT_COORD_LSA_DATA);
 
   // 3 different lsa type interests should be received
-  BOOST_CHECK_EQUAL(collector.getStatistics().get(Statistics::PacketType::RCV_LSA_INTEREST), 3);
+  BOOST_CHECK_EQUAL(statistics.get(Statistics::PacketType::RCV_LSA_INTEREST), 3);
 
   // data should have been sent 3x, once per lsa type
-  BOOST_CHECK_EQUAL(collector.getStatistics().get(Statistics::PacketType::SENT_LSA_DATA), 3);
+  BOOST_CHECK_EQUAL(statistics.get(Statistics::PacketType::SENT_LSA_DATA), 3);
 }
 
 /*
@@ -302,7 +370,7 @@ BOOST_AUTO_TEST_CASE(LsdbReceiveData)
   lsdb.installLsa(std::make_shared<AdjLsa>(aLsa));
 
   lsdb.afterFetchLsa(aLsa.wireEncode().getBuffer(), adjInterest);
-  BOOST_CHECK_EQUAL(collector.getStatistics().get(Statistics::PacketType::RCV_ADJ_LSA_DATA), 1);
+  BOOST_CHECK_EQUAL(statistics.get(Statistics::PacketType::RCV_ADJ_LSA_DATA), 1);
 
   // coordinate lsa
   ndn::Name coordInterest("/localhop/ndn/nlsr/LSA/cs/%C1.Router/router1/COORDINATE/");
@@ -312,7 +380,7 @@ BOOST_AUTO_TEST_CASE(LsdbReceiveData)
   lsdb.installLsa(std::make_shared<CoordinateLsa>(cLsa));
 
   lsdb.afterFetchLsa(cLsa.wireEncode().getBuffer(), coordInterest);
-  BOOST_CHECK_EQUAL(collector.getStatistics().get(Statistics::PacketType::RCV_COORD_LSA_DATA), 1);
+  BOOST_CHECK_EQUAL(statistics.get(Statistics::PacketType::RCV_COORD_LSA_DATA), 1);
 
   // name lsa
   ndn::Name interestName("/localhop/ndn/nlsr/LSA/cs/%C1.Router/router1/NAME/");
@@ -321,10 +389,10 @@ BOOST_AUTO_TEST_CASE(LsdbReceiveData)
   lsdb.installLsa(std::make_shared<NameLsa>(nlsa));
 
   lsdb.afterFetchLsa(nlsa.wireEncode().getBuffer(), interestName);
-  BOOST_CHECK_EQUAL(collector.getStatistics().get(Statistics::PacketType::RCV_NAME_LSA_DATA), 1);
+  BOOST_CHECK_EQUAL(statistics.get(Statistics::PacketType::RCV_NAME_LSA_DATA), 1);
 
   // 3 lsa data types should be received
-  BOOST_CHECK_EQUAL(collector.getStatistics().get(Statistics::PacketType::RCV_LSA_DATA), 3);
+  BOOST_CHECK_EQUAL(statistics.get(Statistics::PacketType::RCV_LSA_DATA), 3);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,158 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "update/prefix-journal.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <filesystem>
+
+namespace nlsr::tests {
+
+using update::PrefixJournal;
+
+class PrefixJournalFixture
+{
+public:
+  PrefixJournalFixture()
+  {
+    writeConfFile();
+    std::filesystem::remove(confFile + ".journal");
+  }
+
+  ~PrefixJournalFixture()
+  {
+    std::filesystem::remove(confFile);
+    std::filesystem::remove(confFile + ".journal");
+  }
+
+  void
+  writeConfFile()
+  {
+    std::ofstream(confFile) << "general\n"
+                               "{\n"
+                               "  network /ndn\n"
+                               "}\n"
+                               "advertising\n"
+                               "{\n"
+                               "  ; configured prefixes\n"
+                               "  prefix /a       ; first\n"
+                               "  prefix /b\n"
+                               "}\n";
+  }
+
+  std::vector<std::string>
+  readLines(const std::string& fileName)
+  {
+    std::ifstream input(fileName);
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(input, line)) {
+      lines.push_back(line);
+    }
+    return lines;
+  }
+
+public:
+  const std::string confFile = "/tmp/nlsr-prefix-journal-test.conf";
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestPrefixJournal, PrefixJournalFixture)
+
+BOOST_AUTO_TEST_CASE(Rewrite)
+{
+  auto lines = readLines(confFile);
+  BOOST_CHECK(PrefixJournal::parseAdvertising(lines) == (std::set<ndn::Name>{"/a", "/b"}));
+
+  auto rewritten = PrefixJournal::rewriteAdvertising(lines, {"/a", "/c"});
+  std::vector<std::string> expected{
+    "general", "{", "  network /ndn", "}",
+    "advertising", "{",
+    "  prefix /c",
+    "  ; configured prefixes",
+    "  prefix /a       ; first",
+    "}",
+  };
+  BOOST_CHECK_EQUAL_COLLECTIONS(rewritten.begin(), rewritten.end(), expected.begin(), expected.end());
+
+  // A missing section is created
+  std::vector<std::string> general(lines.begin(), lines.begin() + 4);
+  rewritten = PrefixJournal::rewriteAdvertising(general, {"/c"});
+  BOOST_REQUIRE_EQUAL(rewritten.size(), 8);
+  BOOST_CHECK_EQUAL(rewritten[4], "advertising");
+  BOOST_CHECK_EQUAL(rewritten[6], "  prefix /c");
+}
+
+BOOST_AUTO_TEST_CASE(AppendAndReplay)
+{
+  {
+    PrefixJournal journal(confFile);
+    BOOST_CHECK(journal.load().empty());
+    BOOST_CHECK(journal.contains("/a"));
+    BOOST_CHECK_EQUAL(journal.add("/a"), false);
+    BOOST_CHECK_EQUAL(journal.add("/c"), true);
+    BOOST_CHECK_EQUAL(journal.remove("/b"), true);
+    BOOST_CHECK_EQUAL(journal.remove("/d"), false);
+    journal.flush();
+
+    // Only the journal is written until compaction
+    auto records = readLines(confFile + ".journal");
+    BOOST_CHECK_EQUAL(records.size(), 2);
+    BOOST_CHECK(PrefixJournal::parseAdvertising(readLines(confFile)) ==
+                (std::set<ndn::Name>{"/a", "/b"}));
+
+    journal.compact();
+    journal.flush();
+    BOOST_CHECK(PrefixJournal::parseAdvertising(readLines(confFile)) ==
+                (std::set<ndn::Name>{"/a", "/c"}));
+  }
+
+  // NLSR recreates the dynamic configuration file at startup; the journal restores the changes
+  writeConfFile();
+  std::ofstream(confFile + ".journal", std::ios::app) << "+ /e\n"
+                                                        "garbage\n"
+                                                        "- /e\n"
+                                                        "+ /f\n";
+  PrefixJournal journal(confFile);
+  auto changes = journal.load();
+  std::map<ndn::Name, bool> expected{{"/b", false}, {"/c", true}, {"/f", true}};
+  BOOST_CHECK(changes == expected);
+  BOOST_CHECK(!journal.contains("/e"));
+  BOOST_CHECK(journal.load().empty());
+}
+
+BOOST_AUTO_TEST_CASE(Linear)
+{
+  PrefixJournal journal(confFile);
+  for (size_t i = 0; i < 2 * PrefixJournal::COMPACTION_THRESHOLD + 1; ++i) {
+    BOOST_CHECK(journal.add(ndn::Name("/p").appendNumber(i)));
+  }
+  journal.flush();
+
+  // Compactions already folded most records into the configuration file
+  BOOST_CHECK_LT(readLines(confFile + ".journal").size(), 3 * PrefixJournal::COMPACTION_THRESHOLD);
+  BOOST_CHECK_GE(PrefixJournal::parseAdvertising(readLines(confFile)).size(),
+                 PrefixJournal::COMPACTION_THRESHOLD);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nlsr::tests
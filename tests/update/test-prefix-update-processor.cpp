@@ -21,11 +21,13 @@
 
 #include "update/prefix-update-processor.hpp"
 #include "nlsr.hpp"
+#include "tlv-nlsr.hpp"
 
 #include "tests/io-key-chain-fixture.hpp"
 #include "tests/test-common.hpp"
 
 #include <ndn-cxx/mgmt/nfd/control-parameters.hpp>
+#include <ndn-cxx/mgmt/nfd/control-response.hpp>
 #include <ndn-cxx/security/interest-signer.hpp>
 #include <ndn-cxx/security/signing-helpers.hpp>
 
@@ -169,7 +171,7 @@ BOOST_AUTO_TEST_CASE(Basic)
 
   face.receive(advertiseInterest);
 
-  this->advanceClocks(ndn::time::milliseconds(10));
+  this->advanceClocks(NAME_LSA_BUILD_DELAY + 10_ms);
 
   NamePrefixList& namePrefixList = conf.getNamePrefixList();
 
@@ -189,7 +191,7 @@ BOOST_AUTO_TEST_CASE(Basic)
                                                     ndn::security::signingByIdentity(opIdentity));
 
   face.receive(withdrawInterest);
-  this->advanceClocks(ndn::time::milliseconds(10));
+  this->advanceClocks(NAME_LSA_BUILD_DELAY + 10_ms);
 
   BOOST_CHECK_EQUAL(namePrefixList.size(), 0);
 
@@ -197,6 +199,109 @@ BOOST_AUTO_TEST_CASE(Basic)
   BOOST_CHECK(nameLsaSeqNoBeforeInterest < nlsr.m_lsdb.m_sequencingManager.getNameLsaSeq());
 }
 
+BOOST_AUTO_TEST_CASE(Bulk)
+{
+  std::vector<PrefixInfo> prefixes{{"/bulk/a", 0}, {"/bulk/b", 10}, {"/bulk/c", 20}};
+  ndn::security::InterestSigner signer(m_keyChain);
+
+  auto makeCommand = [&] (const std::string& verb, const ndn::Block& list) {
+    ndn::Name command("/localhost/nlsr/prefix-update");
+    command.append(verb);
+    command.append(ndn::tlv::GenericNameComponent, ndn::nfd::ControlParameters().wireEncode());
+    command.append(ndn::tlv::GenericNameComponent, list);
+    return signer.makeCommandInterest(command, ndn::security::signingByIdentity(opIdentity));
+  };
+
+  uint64_t nameLsaSeqNoBeforeInterest = nlsr.m_lsdb.m_sequencingManager.getNameLsaSeq();
+  face.receive(makeCommand("advertise-bulk", update::CommandProcessor::encodePrefixList(prefixes)));
+  this->advanceClocks(NAME_LSA_BUILD_DELAY + 10_ms);
+
+  // All prefixes are applied with a single Name LSA origination
+  BOOST_REQUIRE_EQUAL(namePrefixList.size(), 3);
+  BOOST_CHECK_EQUAL(namePrefixList.getPrefixInfoForName("/bulk/b").getCost(), 10);
+  BOOST_CHECK_EQUAL(nlsr.m_lsdb.m_sequencingManager.getNameLsaSeq(), nameLsaSeqNoBeforeInterest + 1);
+  BOOST_CHECK(wasRoutingUpdatePublished());
+
+  // A malformed list is rejected as a whole
+  ndn::Block malformed(nlsr::tlv::PrefixList);
+  malformed.push_back(PrefixInfo("/bulk/d", 0).wireEncode());
+  malformed.push_back(ndn::makeStringBlock(nlsr::tlv::PrefixInfo, "bogus"));
+  malformed.encode();
+  face.receive(makeCommand("advertise-bulk", malformed));
+  this->advanceClocks(NAME_LSA_BUILD_DELAY + 10_ms);
+  BOOST_CHECK_EQUAL(namePrefixList.size(), 3);
+
+  nameLsaSeqNoBeforeInterest = nlsr.m_lsdb.m_sequencingManager.getNameLsaSeq();
+  prefixes.pop_back();
+  face.receive(makeCommand("withdraw-bulk", update::CommandProcessor::encodePrefixList(prefixes)));
+  this->advanceClocks(NAME_LSA_BUILD_DELAY + 10_ms);
+
+  BOOST_REQUIRE_EQUAL(namePrefixList.size(), 1);
+  BOOST_CHECK_EQUAL(namePrefixList.getNames().front(), "/bulk/c");
+  BOOST_CHECK_EQUAL(nlsr.m_lsdb.m_sequencingManager.getNameLsaSeq(), nameLsaSeqNoBeforeInterest + 1);
+}
+
+BOOST_AUTO_TEST_CASE(Coalescing)
+{
+  ndn::security::InterestSigner signer(m_keyChain);
+  auto makeCommand = [&] (const ndn::Name& prefix, uint64_t flags = 0) {
+    ndn::nfd::ControlParameters parameters;
+    parameters.setName(prefix);
+    if (flags != 0) {
+      parameters.setFlags(flags);
+    }
+    ndn::Name command("/localhost/nlsr/prefix-update/advertise");
+    command.append(ndn::tlv::GenericNameComponent, parameters.wireEncode());
+    return signer.makeCommandInterest(command, ndn::security::signingByIdentity(opIdentity));
+  };
+  auto getResponses = [&] {
+    std::vector<ndn::Data> responses;
+    std::copy_if(face.sentData.begin(), face.sentData.end(), std::back_inserter(responses),
+                 [] (const auto& data) {
+                   return ndn::Name("/localhost/nlsr/prefix-update").isPrefixOf(data.getName());
+                 });
+    return responses;
+  };
+
+  // A burst of changes produces a single Name LSA version
+  uint64_t nameLsaSeqNoBeforeInterest = nlsr.m_lsdb.m_sequencingManager.getNameLsaSeq();
+  for (int i = 0; i < 5; ++i) {
+    face.receive(makeCommand(ndn::Name("/burst").appendNumber(i)));
+    this->advanceClocks(NAME_LSA_BUILD_DELAY / 5);
+  }
+  BOOST_CHECK_EQUAL(getResponses().size(), 5);
+  BOOST_CHECK(nlsr.m_lsdb.isNameLsaBuildScheduled());
+  BOOST_CHECK_EQUAL(nlsr.m_lsdb.m_sequencingManager.getNameLsaSeq(), nameLsaSeqNoBeforeInterest);
+
+  this->advanceClocks(NAME_LSA_BUILD_DELAY);
+  BOOST_CHECK(!nlsr.m_lsdb.isNameLsaBuildScheduled());
+  BOOST_CHECK_EQUAL(nlsr.m_lsdb.m_sequencingManager.getNameLsaSeq(), nameLsaSeqNoBeforeInterest + 1);
+
+  // Sustained churn cannot postpone the build past the maximum wait
+  nameLsaSeqNoBeforeInterest = nlsr.m_lsdb.m_sequencingManager.getNameLsaSeq();
+  auto step = NAME_LSA_BUILD_DELAY / 2;
+  for (int i = 0; i * step < NAME_LSA_BUILD_MAX_WAIT + NAME_LSA_BUILD_DELAY; ++i) {
+    face.receive(makeCommand(ndn::Name("/churn").appendNumber(i)));
+    this->advanceClocks(step);
+  }
+  BOOST_CHECK_GT(nlsr.m_lsdb.m_sequencingManager.getNameLsaSeq(), nameLsaSeqNoBeforeInterest);
+
+  // With WAIT_FOR_PUBLICATION_FLAG, the response is sent after the LSA is built
+  this->advanceClocks(NAME_LSA_BUILD_MAX_WAIT);
+  face.sentData.clear();
+  nameLsaSeqNoBeforeInterest = nlsr.m_lsdb.m_sequencingManager.getNameLsaSeq();
+  face.receive(makeCommand("/wait", update::WAIT_FOR_PUBLICATION_FLAG));
+  this->advanceClocks(NAME_LSA_BUILD_DELAY / 2);
+  BOOST_CHECK_EQUAL(getResponses().size(), 0);
+
+  this->advanceClocks(NAME_LSA_BUILD_DELAY);
+  auto responses = getResponses();
+  BOOST_REQUIRE_EQUAL(responses.size(), 1);
+  BOOST_CHECK_EQUAL(nlsr.m_lsdb.m_sequencingManager.getNameLsaSeq(), nameLsaSeqNoBeforeInterest + 1);
+  ndn::nfd::ControlResponse response(responses.front().getContent().blockFromValue());
+  BOOST_CHECK_EQUAL(response.getCode(), 200);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
@@ -0,0 +1,121 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "update/readvertise-policy.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/io-fixture.hpp"
+
+namespace nlsr::tests {
+
+using update::ReadvertisePolicy;
+using Result = ReadvertisePolicy::Result;
+
+class ReadvertisePolicyFixture : public IoFixture
+{
+public:
+  ReadvertisePolicyFixture()
+    : policy(m_io, [this] (const ndn::Name& prefix, bool isAdvertise, double) {
+        changes.push_back((isAdvertise ? "+" : "-") + prefix.toUri());
+      })
+  {
+  }
+
+public:
+  std::vector<std::string> changes;
+  ReadvertisePolicy policy;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestReadvertisePolicy, ReadvertisePolicyFixture)
+
+BOOST_AUTO_TEST_CASE(Passthrough)
+{
+  BOOST_CHECK(policy.registerPrefix("/a", 0) == Result::APPLIED);
+  BOOST_CHECK(policy.registerPrefix("/a", 0) == Result::UNCHANGED);
+  BOOST_CHECK(policy.unregisterPrefix("/a") == Result::APPLIED);
+  // not registered through the policy, withdrawn anyway
+  BOOST_CHECK(policy.unregisterPrefix("/b") == Result::APPLIED);
+
+  std::vector<std::string> expected{"+/a", "-/a", "-/b"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(changes.begin(), changes.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(HoldDown)
+{
+  policy.setHoldDown(5_s);
+
+  BOOST_CHECK(policy.registerPrefix("/a", 0) == Result::APPLIED);
+  BOOST_CHECK(policy.unregisterPrefix("/a") == Result::DEFERRED);
+  advanceClocks(100_ms, 20);
+
+  // the producer came back before the hold-down expired
+  BOOST_CHECK(policy.registerPrefix("/a", 0) == Result::UNCHANGED);
+  advanceClocks(1_s, 10);
+  BOOST_CHECK_EQUAL(changes.size(), 1);
+
+  BOOST_CHECK(policy.unregisterPrefix("/a") == Result::DEFERRED);
+  advanceClocks(1_s, 6);
+  std::vector<std::string> expected{"+/a", "-/a"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(changes.begin(), changes.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(Aggregation)
+{
+  policy.addAggregate("/agg");
+
+  BOOST_CHECK(policy.registerPrefix("/agg/x", 0) == Result::APPLIED);
+  BOOST_CHECK(policy.registerPrefix("/agg/y", 0) == Result::UNCHANGED);
+  BOOST_CHECK(policy.registerPrefix("/agg/y", 0) == Result::UNCHANGED);
+  BOOST_CHECK(policy.registerPrefix("/other", 0) == Result::APPLIED);
+  BOOST_CHECK(policy.unregisterPrefix("/agg/x") == Result::UNCHANGED);
+  BOOST_CHECK(policy.unregisterPrefix("/agg/x") == Result::UNCHANGED);
+  BOOST_CHECK(policy.unregisterPrefix("/agg/y") == Result::APPLIED);
+
+  std::vector<std::string> expected{"+/agg", "+/other", "-/agg"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(changes.begin(), changes.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(RateLimit)
+{
+  policy.setMaxChangesPerSecond(2);
+
+  BOOST_CHECK(policy.registerPrefix("/p1", 0) == Result::APPLIED);
+  BOOST_CHECK(policy.registerPrefix("/p2", 0) == Result::APPLIED);
+  BOOST_CHECK(policy.registerPrefix("/p3", 0) == Result::DEFERRED);
+  BOOST_CHECK(policy.registerPrefix("/p4", 0) == Result::DEFERRED);
+  BOOST_CHECK(policy.registerPrefix("/p5", 0) == Result::DEFERRED);
+  BOOST_CHECK_EQUAL(policy.getQueueSize(), 3);
+
+  // undoing a queued change drops it without consuming a token
+  BOOST_CHECK(policy.unregisterPrefix("/p5") == Result::UNCHANGED);
+
+  advanceClocks(100_ms, 6);
+  BOOST_CHECK_EQUAL(changes.size(), 3);
+  advanceClocks(100_ms, 5);
+  BOOST_CHECK_EQUAL(policy.getQueueSize(), 0);
+
+  std::vector<std::string> expected{"+/p1", "+/p2", "+/p3", "+/p4"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(changes.begin(), changes.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nlsr::tests
@@ -57,6 +57,7 @@ public:
     destination << source.rdbuf();
     source.close();
     destination.close();
+    std::filesystem::remove(testConfFile + ".journal");
 
     conf.setConfFileNameDynamic(testConfFile);
     siteIdentity = m_keyChain.createIdentity(siteIdentityName);
@@ -117,6 +118,10 @@ public:
   bool
   checkPrefix(const std::string prefixName)
   {
+    auto& journal = nlsr.m_prefixUpdateProcessor.getJournal();
+    journal.compact();
+    journal.flush();
+
     bpt::ptree m_savePrefix;
     bpt::read_info(testConfFile, m_savePrefix);
 
@@ -230,6 +235,39 @@ BOOST_AUTO_TEST_CASE(PrefixStillSavedAfterJustWithdrawn)
   BOOST_CHECK_EQUAL(checkPrefix("/prefix/to/save"), false);
 }
 
+BOOST_AUTO_TEST_CASE(CompactCommand)
+{
+  face.receive(advertiseWithdraw("/prefix/to/save", "advertise", true));
+  this->advanceClocks(ndn::time::milliseconds(10));
+  auto& journal = nlsr.m_prefixUpdateProcessor.getJournal();
+  journal.flush();
+
+  auto isInConfFile = [this] (const std::string& prefixName) {
+    bpt::ptree pt;
+    bpt::read_info(testConfFile, pt);
+    for (const auto& section : pt.get_child("advertising")) {
+      if (section.second.get_value<std::string>() == prefixName) {
+        return true;
+      }
+    }
+    return false;
+  };
+  // the save is only journaled until the operator asks for compaction
+  BOOST_CHECK_EQUAL(isInConfFile("/prefix/to/save"), false);
+  face.sentData.clear();
+
+  ndn::Name compactCommand("/localhost/nlsr/prefix-update/compact");
+  compactCommand.append(ndn::tlv::GenericNameComponent, ndn::nfd::ControlParameters().wireEncode());
+  ndn::security::InterestSigner signer(m_keyChain);
+  face.receive(signer.makeCommandInterest(compactCommand,
+                                          ndn::security::signingByIdentity(opIdentity)));
+  this->advanceClocks(ndn::time::milliseconds(10));
+  BOOST_CHECK_EQUAL(getResponseCode(), 200);
+
+  journal.flush();
+  BOOST_CHECK_EQUAL(isInConfFile("/prefix/to/save"), true);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace nlsr::tests
@@ -0,0 +1,155 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2025,  The University of Memphis,
+ *                           Regents of the University of California,
+ *                           Arizona Board of Regents.
+ *
+ * This file is part of NLSR (Named-data Link State Routing).
+ * See AUTHORS.md for complete list of NLSR authors and contributors.
+ *
+ * NLSR is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NLSR is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NLSR, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "utility/arena.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace nlsr::tests {
+
+using util::Arena;
+using util::ArenaVector;
+
+BOOST_AUTO_TEST_SUITE(TestArena)
+
+BOOST_AUTO_TEST_CASE(Alignment)
+{
+  Arena arena(64);
+
+  arena.allocate(1, 1);
+  auto p = reinterpret_cast<uintptr_t>(arena.allocate(8, 8));
+  BOOST_CHECK_EQUAL(p % 8, 0);
+  arena.allocate(3, 1);
+  p = reinterpret_cast<uintptr_t>(arena.allocate(16, alignof(std::max_align_t)));
+  BOOST_CHECK_EQUAL(p % alignof(std::max_align_t), 0);
+  BOOST_CHECK_EQUAL(arena.getUsedBytes(), 28);
+}
+
+BOOST_AUTO_TEST_CASE(Growth)
+{
+  Arena arena(64);
+
+  auto p1 = static_cast<char*>(arena.allocate(48, 1));
+  auto p2 = static_cast<char*>(arena.allocate(48, 1));
+  // larger than the next block
+  auto p3 = static_cast<char*>(arena.allocate(1000, 1));
+  std::fill_n(p1, 48, 'a');
+  std::fill_n(p2, 48, 'b');
+  std::fill_n(p3, 1000, 'c');
+  BOOST_CHECK_EQUAL(p1[47], 'a');
+  BOOST_CHECK_EQUAL(p2[0], 'b');
+  BOOST_CHECK_EQUAL(arena.getUsedBytes(), 1096);
+  BOOST_CHECK_GE(arena.getCapacity(), 1096);
+}
+
+BOOST_AUTO_TEST_CASE(Reset)
+{
+  Arena arena(64);
+  arena.allocate(48, 1);
+  arena.allocate(48, 1);
+  arena.allocate(1000, 1);
+  size_t capacity = arena.getCapacity();
+
+  arena.reset();
+  BOOST_CHECK_EQUAL(arena.getUsedBytes(), 0);
+  BOOST_CHECK_EQUAL(arena.getCapacity(), capacity);
+
+  // the blocks were merged: the same working set needs no new block
+  auto first = static_cast<char*>(arena.allocate(48, 1));
+  arena.allocate(48, 1);
+  arena.allocate(1000, 1);
+  BOOST_CHECK_EQUAL(arena.getCapacity(), capacity);
+
+  // a single block is reused from its start
+  arena.reset();
+  BOOST_CHECK_EQUAL(arena.allocate(48, 1), first);
+}
+
+BOOST_AUTO_TEST_CASE(MarkRelease)
+{
+  Arena arena(64);
+  auto kept = static_cast<char*>(arena.allocate(16, 1));
+  std::fill_n(kept, 16, 'k');
+  auto mark = arena.mark();
+
+  // each iteration grows past the first block, then returns to the mark
+  size_t capacity = 0;
+  for (int i = 0; i < 10; ++i) {
+    util::ArenaScope scope(arena);
+    auto p = static_cast<char*>(arena.allocate(200, 1));
+    std::fill_n(p, 200, 'x');
+    arena.allocate(500, 1);
+    BOOST_CHECK_EQUAL(arena.getUsedBytes(), 716);
+    if (i == 0) {
+      capacity = arena.getCapacity();
+    }
+    // the blocks added by the first iteration are reused
+    BOOST_CHECK_EQUAL(arena.getCapacity(), capacity);
+  }
+  BOOST_CHECK_EQUAL(arena.getUsedBytes(), 16);
+  BOOST_CHECK_EQUAL(kept[15], 'k');
+
+  arena.release(mark);
+  BOOST_CHECK_EQUAL(arena.getUsedBytes(), 16);
+  // the next allocation follows the objects allocated before the mark
+  BOOST_CHECK_EQUAL(static_cast<char*>(arena.allocate(1, 1)), kept + 16);
+
+  // a mark taken on an empty arena releases everything
+  Arena empty(64);
+  auto start = empty.mark();
+  empty.allocate(1000, 1);
+  empty.release(start);
+  BOOST_CHECK_EQUAL(empty.getUsedBytes(), 0);
+  auto capacityAfterRelease = empty.getCapacity();
+  empty.allocate(1000, 1);
+  BOOST_CHECK_EQUAL(empty.getCapacity(), capacityAfterRelease);
+}
+
+BOOST_AUTO_TEST_CASE(Containers)
+{
+  Arena arena(64);
+  {
+    ArenaVector<int> v(arena);
+    for (int i = 0; i < 1000; ++i) {
+      v.push_back(i);
+    }
+    BOOST_CHECK_EQUAL(v.size(), 1000);
+    BOOST_CHECK_EQUAL(v[999], 999);
+    BOOST_CHECK(v.get_allocator().getArena() == &arena);
+
+    ArenaVector<int> copy(v, arena);
+    BOOST_CHECK(copy == v);
+  }
+  BOOST_CHECK_GE(arena.getUsedBytes(), 2 * 1000 * sizeof(int));
+
+  util::ArenaMap<int, double> m(arena);
+  m[3] = 1.5;
+  m[1] = 2.5;
+  BOOST_CHECK_EQUAL(m.begin()->first, 1);
+  BOOST_CHECK_EQUAL(m.size(), 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nlsr::tests
@@ -24,6 +24,9 @@
 #include "config.hpp"
 #include "version.hpp"
 #include "src/publisher/dataset-interest-handler.hpp"
+#include "src/route/topology-change.hpp"
+#include "src/tlv-nlsr.hpp"
+#include "src/update/command-processor.hpp"
 
 #include <ndn-cxx/data.hpp>
 #include <ndn-cxx/encoding/block.hpp>
@@ -39,9 +42,13 @@
 #include <ndn-cxx/util/segment-fetcher.hpp>
 
 #include <boost/algorithm/string/replace.hpp>
+#include <boost/algorithm/string/trim.hpp>
 #include <boost/property_tree/info_parser.hpp>
 
+#include <fstream>
 #include <iostream>
+#include <optional>
+#include <sstream>
 
 namespace nlsrc {
 
@@ -49,12 +56,20 @@ const ndn::Name LOCALHOST_PREFIX("/localhost");
 const ndn::PartialName LSDB_SUFFIX("nlsr/lsdb");
 const ndn::PartialName NAME_UPDATE_SUFFIX("nlsr/prefix-update");
 const ndn::PartialName RT_SUFFIX("nlsr/routing-table");
+const ndn::PartialName METRICS_SUFFIX("nlsr/metrics");
+const ndn::PartialName STATISTICS_SUFFIX("nlsr/statistics");
+const ndn::PartialName MEMORY_SUFFIX("nlsr/memory");
+const ndn::PartialName WHATIF_SUFFIX("nlsr/whatif");
 
 const uint32_t ERROR_CODE_TIMEOUT = 10060;
 const uint32_t RESPONSE_CODE_SUCCESS = 200;
 const uint32_t RESPONSE_CODE_NO_EFFECT = 204;
 const uint32_t RESPONSE_CODE_SAVE_OR_DELETE = 205;
 
+// Encoded size of the prefix list carried by one bulk command, leaving room
+// for the rest of the command name and the signature within MAX_NDN_PACKET_SIZE
+const size_t MAX_BULK_LIST_SIZE = 4096;
+
 Nlsrc::Nlsrc(std::string programName, ndn::Face& face)
   : m_programName(std::move(programName))
   , m_routerPrefix(LOCALHOST_PREFIX)
@@ -68,12 +83,13 @@ Nlsrc::printUsage() const
 {
   const std::string help(R"EOT(Usage:
 @NLSRC@ [-h | -V]
-@NLSRC@ [-R <router prefix> [-c <nlsr.conf path> | -k]] COMMAND [<Command Options>]
+@NLSRC@ [-R <router prefix> [-c <nlsr.conf path> | -k]] [-w] COMMAND [<Command Options>]
        -h print usage and exit
        -V print version and exit
        -R target a remote NLSR instance
        -c verify response with nlsr.conf security.validator policy
        -k do not verify response (insecure)
+       -w on advertise/withdraw, wait until the updated Name LSA is published
 
    COMMAND can be one of the following:
        lsdb
@@ -82,14 +98,29 @@ Nlsrc::printUsage() const
            display routing table status
        status
            display all NLSR status (lsdb & routingtable)
+       metrics
+           display NLSR metrics in the Prometheus text format
+       statistics
+           display packet counters and per-neighbor traffic
+       memory
+           display estimated memory usage per subsystem
+       whatif <change>...
+           display the routes that would change, without changing anything; a change is
+           link-down <router> <router> | link-cost <router> <router> <cost> | router-down <router>
        advertise <name>
            advertise a name prefix through NLSR
        advertise <name> save
            advertise and save the name prefix to the conf file
+       advertise -f <file | -> [save]
+           advertise every name prefix listed in a file or on stdin
        withdraw <name>
            remove a name prefix advertised through NLSR
        withdraw <name> delete
            withdraw and delete the name prefix from the conf file
+       withdraw -f <file | -> [delete]
+           withdraw every name prefix listed in a file or on stdin
+       compact
+           fold the saved and deleted name prefixes into the conf file
 )EOT");
   boost::algorithm::replace_all_copy(std::ostream_iterator<char>(std::cout),
                                      help, "@NLSRC@", m_programName);
@@ -160,6 +191,52 @@ Nlsrc::getStatus(const std::string& command)
   runNextStep();
 }
 
+static std::optional<std::vector<nlsr::TopologyChange>>
+parseTopologyChanges(ndn::span<std::string> args)
+{
+  std::vector<nlsr::TopologyChange> changes;
+  size_t i = 0;
+  auto nextRouter = [&] {
+    if (i == args.size()) {
+      throw std::invalid_argument("missing router name");
+    }
+    return ndn::Name(args[i++]);
+  };
+  while (i < args.size()) {
+    const std::string& kind = args[i++];
+    try {
+      if (kind == "link-down") {
+        auto router = nextRouter();
+        changes.push_back(nlsr::TopologyChange::makeLinkDown(router, nextRouter()));
+      }
+      else if (kind == "link-cost") {
+        auto router = nextRouter();
+        auto otherRouter = nextRouter();
+        if (i == args.size()) {
+          throw std::invalid_argument("missing link cost");
+        }
+        size_t pos = 0;
+        double cost = std::stod(args[i], &pos);
+        if (pos != args[i++].size() || cost < 0) {
+          throw std::invalid_argument("invalid link cost");
+        }
+        changes.push_back(nlsr::TopologyChange::makeLinkCost(router, otherRouter, cost));
+      }
+      else if (kind == "router-down") {
+        changes.push_back(nlsr::TopologyChange::makeRouterDown(nextRouter()));
+      }
+      else {
+        throw std::invalid_argument("unknown change '" + kind + "'");
+      }
+    }
+    catch (const std::exception& e) {
+      std::cerr << "ERROR: whatif: " << e.what() << std::endl;
+      return std::nullopt;
+    }
+  }
+  return changes;
+}
+
 bool
 Nlsrc::dispatch(ndn::span<std::string> subcommand)
 {
@@ -167,6 +244,25 @@ Nlsrc::dispatch(ndn::span<std::string> subcommand)
     return false;
   }
 
+  if ((subcommand[0] == "advertise" || subcommand[0] == "withdraw") &&
+      subcommand.size() >= 3 && subcommand[1] == "-f") {
+    bool isAdvertise = subcommand[0] == "advertise";
+    bool flag = false;
+    if (subcommand.size() == 4) {
+      if (subcommand[3] != (isAdvertise ? "save" : "delete")) {
+        return false;
+      }
+      flag = true;
+    }
+    else if (subcommand.size() != 3) {
+      return false;
+    }
+    sendBulkPrefixUpdate(subcommand[2],
+                         ndn::Name::Component(isAdvertise ? "advertise-bulk" : "withdraw-bulk"),
+                         flag);
+    return true;
+  }
+
   if (subcommand[0] == "advertise") {
     switch (subcommand.size()) {
       case 2:
@@ -197,6 +293,53 @@ Nlsrc::dispatch(ndn::span<std::string> subcommand)
     return false;
   }
 
+  if (subcommand[0] == "compact") {
+    if (subcommand.size() != 1) {
+      return false;
+    }
+    compactJournal();
+    return true;
+  }
+
+  if (subcommand[0] == "metrics") {
+    if (subcommand.size() != 1) {
+      return false;
+    }
+    fetchText(METRICS_SUFFIX, nlsr::tlv::Metrics);
+    return true;
+  }
+
+  if (subcommand[0] == "statistics") {
+    if (subcommand.size() != 1) {
+      return false;
+    }
+    fetchText(STATISTICS_SUFFIX, nlsr::tlv::Statistics);
+    return true;
+  }
+
+  if (subcommand[0] == "memory") {
+    if (subcommand.size() != 1) {
+      return false;
+    }
+    fetchText(MEMORY_SUFFIX, nlsr::tlv::Memory);
+    return true;
+  }
+
+  if (subcommand[0] == "whatif") {
+    if (subcommand.size() == 1) {
+      return false;
+    }
+    auto changes = parseTopologyChanges(subcommand.subspan(1));
+    if (!changes) {
+      m_exitCode = 1;
+      return true;
+    }
+    ndn::PartialName suffix(WHATIF_SUFFIX);
+    suffix.append(ndn::tlv::GenericNameComponent, nlsr::TopologyChange::encodeList(*changes));
+    fetchText(suffix, nlsr::tlv::WhatIf);
+    return true;
+  }
+
   if (subcommand[0] == "lsdb" || subcommand[0] == "routing" || subcommand[0] == "status") {
     if (subcommand.size() != 1) {
       return false;
@@ -242,11 +385,8 @@ Nlsrc::sendNamePrefixUpdate(const ndn::Name& name,
                             const std::string& info,
                             bool flag)
 {
-  ndn::nfd::ControlParameters parameters;
+  auto parameters = makePrefixUpdateParameters(flag);
   parameters.setName(name);
-  if (flag) {
-    parameters.setFlags(1);
-  }
 
   auto paramWire = parameters.wireEncode();
   ndn::Name commandName = m_routerPrefix;
@@ -265,6 +405,38 @@ Nlsrc::sendNamePrefixUpdate(const ndn::Name& name,
                          std::bind(&Nlsrc::onTimeout, this, ERROR_CODE_TIMEOUT, "Timeout"));
 }
 
+void
+Nlsrc::compactJournal()
+{
+  auto paramWire = ndn::nfd::ControlParameters().wireEncode();
+  ndn::Name commandName = m_routerPrefix;
+  commandName.append(NAME_UPDATE_SUFFIX);
+  commandName.append("compact");
+  commandName.append(paramWire.begin(), paramWire.end());
+
+  ndn::security::InterestSigner signer(m_keyChain);
+  auto commandInterest = signer.makeCommandInterest(commandName,
+                           ndn::security::signingByIdentity(m_keyChain.getPib().getDefaultIdentity()));
+  commandInterest.setMustBeFresh(true);
+
+  m_face.expressInterest(commandInterest,
+                         std::bind(&Nlsrc::onControlResponse, this, "(Compact)", _2),
+                         std::bind(&Nlsrc::onTimeout, this, ERROR_CODE_TIMEOUT, "Nack"),
+                         std::bind(&Nlsrc::onTimeout, this, ERROR_CODE_TIMEOUT, "Timeout"));
+}
+
+ndn::nfd::ControlParameters
+Nlsrc::makePrefixUpdateParameters(bool flag) const
+{
+  ndn::nfd::ControlParameters parameters;
+  uint64_t flags = (flag ? nlsr::update::PREFIX_FLAG : 0) |
+                   (m_wantWaitForPublication ? nlsr::update::WAIT_FOR_PUBLICATION_FLAG : 0);
+  if (flags != 0) {
+    parameters.setFlags(flags);
+  }
+  return parameters;
+}
+
 void
 Nlsrc::onControlResponse(const std::string& info, const ndn::Data& data)
 {
@@ -297,6 +469,155 @@ Nlsrc::onControlResponse(const std::string& info, const ndn::Data& data)
   m_exitCode = 0;
 }
 
+static std::optional<std::vector<nlsr::PrefixInfo>>
+readPrefixList(std::istream& is, const std::string& source)
+{
+  std::vector<nlsr::PrefixInfo> prefixes;
+  std::string line;
+  for (size_t lineNo = 1; std::getline(is, line); ++lineNo) {
+    boost::algorithm::trim(line);
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+
+    std::istringstream iss(line);
+    std::string uri;
+    std::string costString;
+    std::string extra;
+    iss >> uri >> costString >> extra;
+    try {
+      if (!extra.empty()) {
+        throw std::invalid_argument("too many fields");
+      }
+      size_t pos = 0;
+      double cost = costString.empty() ? 0 : std::stod(costString, &pos);
+      if (pos != costString.size() || cost < 0) {
+        throw std::invalid_argument("invalid cost");
+      }
+      prefixes.emplace_back(ndn::Name(uri), cost);
+    }
+    catch (const std::exception& e) {
+      std::cerr << "ERROR: " << source << ":" << lineNo << ": " << e.what() << std::endl;
+      return std::nullopt;
+    }
+  }
+  return prefixes;
+}
+
+void
+Nlsrc::sendBulkPrefixUpdate(const std::string& path,
+                            const ndn::Name::Component& verb,
+                            bool flag)
+{
+  std::optional<std::vector<nlsr::PrefixInfo>> prefixes;
+  if (path == "-") {
+    prefixes = readPrefixList(std::cin, "<stdin>");
+  }
+  else {
+    std::ifstream ifs(path);
+    if (!ifs) {
+      std::cerr << "ERROR: cannot open '" << path << "'" << std::endl;
+      m_exitCode = 1;
+      return;
+    }
+    prefixes = readPrefixList(ifs, path);
+  }
+  if (!prefixes) {
+    m_exitCode = 1;
+    return;
+  }
+  if (prefixes->empty()) {
+    std::cerr << "ERROR: no name prefixes in '" << path << "'" << std::endl;
+    m_exitCode = 1;
+    return;
+  }
+
+  // Batches are sent one after another so that NLSR sees increasing command timestamps
+  // from m_signer
+  std::vector<nlsr::PrefixInfo> batch;
+  size_t batchSize = 0;
+  size_t first = 1;
+  auto flush = [&] {
+    std::string info = "(" + verb.toUri() + ": prefixes " + std::to_string(first) + "-" +
+                       std::to_string(first + batch.size() - 1) + ")";
+    m_fetchSteps.push_back([this, batch, verb, info, flag] {
+      sendPrefixBatch(batch, verb, info, flag);
+    });
+    first += batch.size();
+    batch.clear();
+    batchSize = 0;
+  };
+  for (const auto& prefix : *prefixes) {
+    size_t size = prefix.wireEncode().size();
+    if (!batch.empty() && batchSize + size > MAX_BULK_LIST_SIZE) {
+      flush();
+    }
+    batch.push_back(prefix);
+    batchSize += size;
+  }
+  flush();
+
+  runNextStep();
+}
+
+void
+Nlsrc::sendPrefixBatch(const std::vector<nlsr::PrefixInfo>& batch,
+                       const ndn::Name::Component& verb,
+                       const std::string& info,
+                       bool flag)
+{
+  auto parameters = makePrefixUpdateParameters(flag);
+
+  auto paramWire = parameters.wireEncode();
+  ndn::Name commandName = m_routerPrefix;
+  commandName.append(NAME_UPDATE_SUFFIX);
+  commandName.append(verb);
+  commandName.append(paramWire.begin(), paramWire.end());
+  commandName.append(ndn::tlv::GenericNameComponent,
+                     nlsr::update::CommandProcessor::encodePrefixList(batch));
+
+  auto commandInterest = m_signer.makeCommandInterest(commandName,
+                           ndn::security::signingByIdentity(m_keyChain.getPib().getDefaultIdentity()));
+  commandInterest.setMustBeFresh(true);
+
+  m_face.expressInterest(commandInterest,
+                         std::bind(&Nlsrc::onBulkControlResponse, this, info, _2),
+                         std::bind(&Nlsrc::onTimeout, this, ERROR_CODE_TIMEOUT, "Nack"),
+                         std::bind(&Nlsrc::onTimeout, this, ERROR_CODE_TIMEOUT, "Timeout"));
+}
+
+void
+Nlsrc::onBulkControlResponse(const std::string& info, const ndn::Data& data)
+{
+  if (data.getMetaInfo().getType() == ndn::tlv::ContentType_Nack) {
+    std::cerr << "ERROR: Run-time advertise/withdraw disabled" << std::endl;
+    m_exitCode = 1;
+    return;
+  }
+
+  ndn::nfd::ControlResponse response;
+  try {
+    response.wireDecode(data.getContent().blockFromValue());
+  }
+  catch (const std::exception& e) {
+    std::cerr << "ERROR: Control response decoding error" << std::endl;
+    m_exitCode = 1;
+    return;
+  }
+
+  uint32_t code = response.getCode();
+  if (code != RESPONSE_CODE_SUCCESS && code != RESPONSE_CODE_NO_EFFECT &&
+      code != RESPONSE_CODE_SAVE_OR_DELETE) {
+    std::cerr << response.getText() << std::endl;
+    std::cerr << "Name prefix update error (code: " << code << ") " << info << std::endl;
+    m_exitCode = 1;
+    return;
+  }
+
+  std::cout << "Applied Name prefix update " << info << ": " << response.getText() << std::endl;
+  runNextStep();
+}
+
 void
 Nlsrc::fetchAdjacencyLsas()
 {
@@ -392,6 +713,26 @@ Nlsrc::onFetchSuccess(const ndn::ConstBufferPtr& buf,
   runNextStep();
 }
 
+void
+Nlsrc::fetchText(const ndn::PartialName& suffix, uint32_t tlvType)
+{
+  auto name = m_routerPrefix;
+  name.append(suffix);
+  ndn::Interest interest(name);
+
+  auto fetcher = ndn::SegmentFetcher::start(m_face, interest, *m_validator);
+  fetcher->onComplete.connect([this, tlvType] (const ndn::ConstBufferPtr& buf) {
+    auto [isOk, block] = ndn::Block::fromBuffer(buf);
+    if (!isOk || block.type() != tlvType) {
+      std::cerr << "ERROR: cannot decode TLV-TYPE " << tlvType << std::endl;
+      m_exitCode = 1;
+      return;
+    }
+    std::cout << ndn::readString(block);
+  });
+  fetcher->onError.connect(std::bind(&Nlsrc::onTimeout, this, _1, _2));
+}
+
 void
 Nlsrc::onTimeout(uint32_t errorCode, const std::string& error)
 {
@@ -471,7 +812,7 @@ main(int argc, char** argv)
   int opt;
   const char* confFile = DEFAULT_CONFIG_FILE;
   bool disableValidator = false;
-  while ((opt = ::getopt(argc, argv, "hVR:c:k")) != -1) {
+  while ((opt = ::getopt(argc, argv, "hVR:c:kw")) != -1) {
     switch (opt) {
     case 'h':
       nlsrc.printUsage();
@@ -488,6 +829,9 @@ main(int argc, char** argv)
     case 'k':
       disableValidator = true;
       break;
+    case 'w':
+      nlsrc.setWaitForPublication(true);
+      break;
     default:
       nlsrc.printUsage();
       return 2;
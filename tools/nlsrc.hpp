@@ -23,9 +23,12 @@
 #include "lsa/coordinate-lsa.hpp"
 #include "lsa/name-lsa.hpp"
 #include "route/routing-table.hpp"
+#include "name-prefix-list.hpp"
 
 #include <boost/noncopyable.hpp>
 #include <ndn-cxx/face.hpp>
+#include <ndn-cxx/mgmt/nfd/control-parameters.hpp>
+#include <ndn-cxx/security/interest-signer.hpp>
 #include <ndn-cxx/security/key-chain.hpp>
 #include <ndn-cxx/security/validator.hpp>
 
@@ -56,6 +59,15 @@ public:
   void
   setRouterPrefix(ndn::Name prefix);
 
+  /**
+   * \brief Ask NLSR to reply to prefix updates only once the new Name LSA is published
+   */
+  void
+  setWaitForPublication(bool wantWait)
+  {
+    m_wantWaitForPublication = wantWait;
+  }
+
   void
   disableValidator();
 
@@ -98,6 +110,15 @@ private:
   void
   withdrawName(ndn::Name name, bool wantDelete);
 
+  /**
+   * \brief Asks NLSR to fold the journal of saved and deleted prefixes into its conf file
+   */
+  void
+  compactJournal();
+
+  ndn::nfd::ControlParameters
+  makePrefixUpdateParameters(bool flag) const;
+
   void
   sendNamePrefixUpdate(const ndn::Name& name,
                        const ndn::Name::Component& verb,
@@ -107,6 +128,29 @@ private:
   void
   onControlResponse(const std::string& info, const ndn::Data& data);
 
+  /**
+   * \brief Advertises or withdraws every prefix listed in \p path ("-" for stdin)
+   *
+   * file format, one prefix per line (blank lines and lines starting with '#' are ignored):
+   *   name [cost]
+   *
+   * Prefixes are sent in batches that fit in one command Interest; NLSR builds a
+   * single Name LSA per batch.
+   */
+  void
+  sendBulkPrefixUpdate(const std::string& path,
+                       const ndn::Name::Component& verb,
+                       bool flag);
+
+  void
+  sendPrefixBatch(const std::vector<nlsr::PrefixInfo>& batch,
+                  const ndn::Name::Component& verb,
+                  const std::string& info,
+                  bool flag);
+
+  void
+  onBulkControlResponse(const std::string& info, const ndn::Data& data);
+
 private:
   void
   fetchAdjacencyLsas();
@@ -132,6 +176,11 @@ private:
   void
   fetchFromRt(const std::function<void(const T&)>& recordLsa);
 
+  /*! \brief Fetch a dataset holding a single text block of \p tlvType and print it.
+   */
+  void
+  fetchText(const ndn::PartialName& suffix, uint32_t tlvType);
+
   template<class T>
   void
   onFetchSuccess(const ndn::ConstBufferPtr& data,
@@ -157,6 +206,7 @@ private:
   ndn::Name m_routerPrefix;
   std::unique_ptr<ndn::security::Validator> m_validator;
   ndn::KeyChain m_keyChain;
+  ndn::security::InterestSigner m_signer{m_keyChain};
   ndn::Face& m_face;
 
   struct Router
@@ -169,6 +219,7 @@ private:
   std::string m_rtString;
   std::deque<std::function<void()>> m_fetchSteps;
 
+  bool m_wantWaitForPublication = false;
   int m_exitCode = 0;
 };
 